@@ -37,6 +37,10 @@ pixelix.ws.Client = function(options) {
     this._cmdQueue      = [];
     this._pendingCmd    = null;
     this._onEvent       = null;
+    this._onDisplay     = null;
+    this._display       = null;
+    this._subPeriod     = null;
+    this._isResubscribe = false;
 
     this._sendCmdFromQueue = function() {
         var msg = "";
@@ -90,6 +94,7 @@ pixelix.ws.Client.prototype.connect = function(options) {
             try {
                 wsUrl = options.protocol + "://" + options.hostname + ":" + options.port + options.endpoint;
                 this._socket = new WebSocket(wsUrl);
+                this._socket.binaryType = "arraybuffer";
 
                 this._socket.onopen = function(openEvent) {
                     console.debug("Websocket opened.");
@@ -106,8 +111,12 @@ pixelix.ws.Client.prototype.connect = function(options) {
                 };
 
                 this._socket.onmessage = function(messageEvent) {
-                    console.debug("Websocket message: " + messageEvent.data);
-                    this._onMessage(messageEvent.data);
+                    if ("string" === typeof messageEvent.data) {
+                        console.debug("Websocket message: " + messageEvent.data);
+                        this._onMessage(messageEvent.data);
+                    } else {
+                        this._onBinaryMessage(messageEvent.data);
+                    }
                 }.bind(this);
 
             } catch (exception) {
@@ -156,10 +165,14 @@ pixelix.ws.Client.prototype._onMessage = function(msg) {
                 rsp.name = data[0];
                 this._pendingCmd.resolve(rsp);
             } else if ("GETDISP" === this._pendingCmd.name) {
-                rsp.slotId = data.shift();
-                rsp.data = [];
-                for(index = 0; index < data.length; ++index) {
-                    rsp.data.push(parseInt(data[index], 16));
+                if (null === this._pendingCmd.par) {
+                    rsp.slotId = data.shift();
+                    rsp.data = [];
+                    for(index = 0; index < data.length; ++index) {
+                        rsp.data.push(parseInt(data[index], 16));
+                    }
+                } else {
+                    rsp.period = parseInt(data[0]);
                 }
                 this._pendingCmd.resolve(rsp);
             } else if ("BRIGHTNESS" === this._pendingCmd.name) {
@@ -226,14 +239,186 @@ pixelix.ws.Client.prototype._onMessage = function(msg) {
     return;
 };
 
-pixelix.ws.Client.prototype.getDisplayContent = function() {
+/* Binary display frame flags */
+pixelix.ws.FRAME_FLAG_DELTA         = 0x01;
+pixelix.ws.FRAME_FLAG_SUBSCRIPTION  = 0x02;
+
+/* Decode a binary display frame. A delta frame is applied on the last display content.
+ * Frame header: flags (see FRAME_FLAG_*), slot id, width (16 bit LE), height (16 bit LE)
+ */
+pixelix.ws.decodeFrame = function(buffer, display) {
+    var bytes   = new Uint8Array(buffer);
+    var width   = 0;
+    var height  = 0;
+    var pos     = 6;
+    var index   = 0;
+    var count   = 0;
+    var color   = 0;
+
+    if (6 > bytes.length) {
+        return null;
+    }
+
+    width   = bytes[2] | (bytes[3] << 8);
+    height  = bytes[4] | (bytes[5] << 8);
+
+    if (0 !== (bytes[0] & ~(pixelix.ws.FRAME_FLAG_DELTA | pixelix.ws.FRAME_FLAG_SUBSCRIPTION))) {
+        display = null;
+    } else if ((0 === (bytes[0] & pixelix.ws.FRAME_FLAG_DELTA)) &&
+               ((pos + (width * height * 3)) === bytes.length)) {
+        display = {
+            slotId: bytes[1],
+            width: width,
+            height: height,
+            data: []
+        };
+
+        for(index = 0; index < (width * height); ++index) {
+            display.data.push((bytes[pos] << 16) | (bytes[pos + 1] << 8) | bytes[pos + 2]);
+            pos += 3;
+        }
+    } else if ((0 !== (bytes[0] & pixelix.ws.FRAME_FLAG_DELTA)) &&
+               (null !== display) &&
+               (width === display.width) &&
+               (height === display.height)) {
+
+        display.slotId = bytes[1];
+
+        while(bytes.length > pos) {
+            count = (bytes[pos] & 0x7f) + 1;
+
+            if (0 === (bytes[pos] & 0x80)) {
+                ++pos;
+                index += count;
+            } else {
+                ++pos;
+                while((0 < count) && (display.data.length > index)) {
+                    color = (bytes[pos] << 16) | (bytes[pos + 1] << 8) | bytes[pos + 2];
+                    display.data[index] ^= color;
+                    pos += 3;
+                    ++index;
+                    --count;
+                }
+            }
+        }
+    } else {
+        display = null;
+    }
+
+    return display;
+};
+
+pixelix.ws.Client.prototype._onBinaryMessage = function(buffer) {
+    var rsp             = null;
+    var bytes           = new Uint8Array(buffer);
+    var isSubscription  = (0 < bytes.length) && (0 !== (bytes[0] & pixelix.ws.FRAME_FLAG_SUBSCRIPTION));
+    var isDelta         = (0 < bytes.length) && (0 !== (bytes[0] & pixelix.ws.FRAME_FLAG_DELTA));
+    var isBinaryRsp     = (null !== this._pendingCmd) &&
+                          ("GETDISP" === this._pendingCmd.name) &&
+                          ("BIN" === this._pendingCmd.par);
+
+    /* A single frame request is decoded independent of the subscription. */
+    if (false === isSubscription) {
+        if (false === isBinaryRsp) {
+            console.error("Display frame received, but not requested.");
+        } else {
+            rsp = pixelix.ws.decodeFrame(buffer, null);
+
+            if (null === rsp) {
+                this._pendingCmd.reject();
+            } else {
+                this._pendingCmd.resolve(rsp);
+            }
+
+            this._pendingCmd = null;
+            this._sendCmdFromQueue();
+        }
+    } else {
+        this._display = pixelix.ws.decodeFrame(buffer, this._display);
+
+        if (null === this._display) {
+            /* The delta frame doesn't fit to the local reference. Drop it and
+             * subscribe again, which starts with a full frame.
+             */
+            this._resubscribeDisplayContent();
+        } else {
+            if (false === isDelta) {
+                this._isResubscribe = false;
+            }
+
+            if (null !== this._onDisplay) {
+                this._onDisplay(this._display);
+            }
+        }
+    }
+
+    return;
+};
+
+pixelix.ws.Client.prototype._resubscribeDisplayContent = function() {
+    /* Request it only once, until the full frame is received. */
+    if ((null !== this._subPeriod) &&
+        (false === this._isResubscribe)) {
+        console.warn("Display frame mismatch, subscribe again.");
+
+        this._isResubscribe = true;
+
+        this._sendCmd({
+            name: "GETDISP",
+            par: "SUB;" + this._subPeriod,
+            resolve: function() {},
+            reject: function() {
+                this._isResubscribe = false;
+            }.bind(this)
+        });
+    }
+
+    return;
+};
+
+pixelix.ws.Client.prototype.getDisplayContent = function(options) {
+    var par = null;
+
+    if (("object" === typeof options) &&
+        (true === options.binary)) {
+        par = "BIN";
+    }
+
     return new Promise(function(resolve, reject) {
         if (null === this._socket) {
             reject();
         } else {
             this._sendCmd({
                 name: "GETDISP",
-                par: null,
+                par: par,
+                resolve: resolve,
+                reject: reject
+            });
+        }
+    }.bind(this));
+};
+
+pixelix.ws.Client.prototype.subscribeDisplayContent = function(options) {
+    return new Promise(function(resolve, reject) {
+        if (null === this._socket) {
+            reject();
+        } else if ("number" !== typeof options.period) {
+            reject();
+        } else {
+            if ("function" === typeof options.onDisplayContent) {
+                this._onDisplay = options.onDisplayContent;
+            } else {
+                this._onDisplay = null;
+            }
+
+            /* The first pushed frame is always a full frame. */
+            this._display       = null;
+            this._subPeriod     = options.period;
+            this._isResubscribe = false;
+
+            this._sendCmd({
+                name: "GETDISP",
+                par: "SUB;" + options.period,
                 resolve: resolve,
                 reject: reject
             });
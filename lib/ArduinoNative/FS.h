@@ -47,6 +47,7 @@
 #include <stdio.h>
 #include <Arduino.h>
 #include <time.h>
+#include <sys/stat.h>
 #include <memory>
 
 /******************************************************************************
@@ -80,7 +81,12 @@ public:
     }
 
     size_t write(uint8_t data);
-    size_t write(const uint8_t *buf, size_t size);
+
+    size_t write(const uint8_t *buf, size_t size)
+    {
+        return fwrite(buf, 1, size, m_fd);
+    }
+
     int available();
     
     int read()
@@ -124,7 +130,19 @@ public:
     }
 
     size_t position() const;
-    size_t size() const;
+
+    size_t size() const
+    {
+        struct stat fileStat;
+        size_t      fileSize    = 0U;
+
+        if (0 == fstat(fileno(m_fd), &fileStat))
+        {
+            fileSize = static_cast<size_t>(fileStat.st_size);
+        }
+
+        return fileSize;
+    }
 
     void close()
     {
@@ -137,7 +155,19 @@ public:
         return (nullptr != m_fd);
     }
 
-    time_t getLastWrite();
+    time_t getLastWrite()
+    {
+        struct stat fileStat;
+        time_t      lastWrite   = 0;
+
+        if (0 == fstat(fileno(m_fd), &fileStat))
+        {
+            lastWrite = fileStat.st_mtime;
+        }
+
+        return lastWrite;
+    }
+
     const char* name() const;
 
     boolean isDirectory(void);
@@ -193,8 +223,15 @@ public:
         return exists(path.c_str());
     }
 
-    bool remove(const char* path);
-    bool remove(const String& path);
+    bool remove(const char* path)
+    {
+        return (0 == ::remove(path));
+    }
+
+    bool remove(const String& path)
+    {
+        return remove(path.c_str());
+    }
 
     bool rename(const char* pathFrom, const char* pathTo);
     bool rename(const String& pathFrom, const String& pathTo);
@@ -436,6 +436,46 @@ public:
         return 0 == strncmp(&m_buffer[offset], s2.m_buffer, s2.length());
     }
 
+    /**
+     * Get the index of the last occurrence of a character.
+     *
+     * @param[in] ch    Character
+     *
+     * @return Index of the character. If not found, it will return -1.
+     */
+    int lastIndexOf(char ch) const
+    {
+        int         index   = -1;
+        const char* pos     = nullptr;
+
+        if (nullptr != m_buffer)
+        {
+            pos = strrchr(m_buffer, ch);
+
+            if (nullptr != pos)
+            {
+                index = static_cast<int>(pos - m_buffer);
+            }
+        }
+
+        return index;
+    }
+
+    /**
+     * Remove all characters from the given index to the end.
+     *
+     * @param[in] index Index of the first character to remove
+     */
+    void remove(unsigned int index)
+    {
+        if (length() > index)
+        {
+            m_buffer[index] = '\0';
+        }
+
+        return;
+    }
+
     /**
      * Clear string.
      */
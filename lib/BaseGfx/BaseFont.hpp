@@ -218,6 +218,8 @@ public:
 
                 for(y = 0U; y < glyph->height; ++y)
                 {
+                    int16_t spanBegin = -1;
+
                     for(x = 0U; x < glyph->width; ++x)
                     {
                         /* Every 8 bit, the bitmap offset must be increased. */
@@ -228,14 +230,34 @@ public:
                         }
                         ++bitCnt;
 
-                        /* A 1b in the bitmap row bits must be drawn as single pixel. */
+                        /* The 1b in the bitmap row bits are collected to a span,
+                         * which is drawn at once.
+                         */
                         if (0U != (bitmapRowBits & 0x80U))
                         {
-                            gfx.drawPixel(cursorX + x + glyph->xOffset, cursorY + y + glyph->yOffset, color);
+                            if (0 > spanBegin)
+                            {
+                                spanBegin = x;
+                            }
+                        }
+                        else if (0 <= spanBegin)
+                        {
+                            gfx.fillSpan(cursorX + spanBegin + glyph->xOffset, cursorY + y + glyph->yOffset, x - spanBegin, color);
+                            spanBegin = -1;
+                        }
+                        else
+                        {
+                            /* Nothing to do. */
+                            ;
                         }
 
                         bitmapRowBits <<= 1U;
                     }
+
+                    if (0 <= spanBegin)
+                    {
+                        gfx.fillSpan(cursorX + spanBegin + glyph->xOffset, cursorY + y + glyph->yOffset, x - spanBegin, color);
+                    }
                 }
             }
 
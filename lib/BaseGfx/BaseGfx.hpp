@@ -121,6 +121,70 @@ public:
      */
     virtual void drawPixel(int16_t x, int16_t y, const TColor& color) = 0;
 
+    /**
+     * Get direct read access to a complete pixel row.
+     * The row contains getWidth() pixels, starting at x-coordinate 0.
+     * Canvas without a linear pixel buffer will return nullptr and the
+     * caller shall fall back to getColor().
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr
+     */
+    virtual const TColor* getRow(int16_t y) const
+    {
+        (void)y;
+
+        return nullptr;
+    }
+
+    /**
+     * Fill a horizontal run of pixels with a single color.
+     * The run is clipped to the canvas borders.
+     *
+     * Canvas with direct framebuffer access shall override it, because the
+     * default implementation calls drawPixel() for every single pixel.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     */
+    virtual void fillSpan(int16_t x, int16_t y, uint16_t length, const TColor& color)
+    {
+        uint16_t idx = 0U;
+
+        for(idx = 0U; idx < length; ++idx)
+        {
+            drawPixel(x + idx, y, color);
+        }
+    }
+
+    /**
+     * Draw a horizontal run of pixels from a color buffer.
+     * The run is clipped to the canvas borders.
+     *
+     * Canvas with direct framebuffer access shall override it, because the
+     * default implementation calls drawPixel() for every single pixel.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    virtual void drawSpan(int16_t x, int16_t y, const TColor* colors, uint16_t length)
+    {
+        uint16_t idx = 0U;
+
+        if (nullptr != colors)
+        {
+            for(idx = 0U; idx < length; ++idx)
+            {
+                drawPixel(x + idx, y, colors[idx]);
+            }
+        }
+    }
+
     /**
      * Copy framebuffer content.
      *
@@ -135,9 +199,25 @@ public:
 
         for(y = 0; y < canvasHeight; ++y)
         {
-            for(x = 0; x < canvasWidth; ++x)
+            const TColor* row = nullptr;
+
+            /* The source row can only be used, if it covers the whole destination row. */
+            if ((canvasWidth <= gfx.getWidth()) &&
+                (canvasHeight <= gfx.getHeight()))
+            {
+                row = gfx.getRow(y);
+            }
+
+            if (nullptr != row)
             {
-                drawPixel(x, y, gfx.getColor(x, y));
+                drawSpan(0, y, row, canvasWidth);
+            }
+            else
+            {
+                for(x = 0; x < canvasWidth; ++x)
+                {
+                    drawPixel(x, y, gfx.getColor(x, y));
+                }
             }
         }
     }
@@ -172,12 +252,7 @@ public:
      */
     void drawHLine(int16_t x, int16_t y, uint16_t width, const TColor& color)
     {
-        uint16_t idx = 0U;
-
-        for(idx = 0U; idx < width; ++idx)
-        {
-            drawPixel(x + idx, y, color);
-        }
+        fillSpan(x, y, width, color);
     }
 
     /**
@@ -253,15 +328,11 @@ public:
      */
     void fillRect(int16_t x, int16_t y, uint16_t width, uint16_t height, const TColor& color)
     {
-        int16_t xIndex = 0;
         int16_t yIndex = 0;
 
         for(yIndex = 0; yIndex < height; ++yIndex)
         {
-            for(xIndex = 0; xIndex < width; ++xIndex)
-            {
-                drawPixel(x + xIndex, y + yIndex, color);
-            }
+            fillSpan(x, y + yIndex, width, color);
         }
     }
 
@@ -293,9 +364,18 @@ public:
 
         for(yIndex = 0; yIndex < canvasHeight; ++yIndex)
         {
-            for(xIndex = 0; xIndex < canvasWidth; ++xIndex)
+            const TColor* row = bitmap.getRow(yIndex);
+
+            if (nullptr != row)
+            {
+                drawSpan(x, y + yIndex, row, canvasWidth);
+            }
+            else
             {
-                drawPixel(x + xIndex, y + yIndex, bitmap.getColor(xIndex, yIndex));
+                for(xIndex = 0; xIndex < canvasWidth; ++xIndex)
+                {
+                    drawPixel(x + xIndex, y + yIndex, bitmap.getColor(xIndex, yIndex));
+                }
             }
         }
     }
@@ -307,6 +387,43 @@ protected:
     {
     }
 
+    /**
+     * Clip a horizontal run of pixels to the canvas width.
+     *
+     * @param[inout] x      x-coordinate of the first pixel, clipped to the first visible pixel.
+     * @param[inout] length Number of pixels, reduced to the number of visible pixels.
+     * @param[out] skip     Number of pixels, which are clipped at the begin of the run.
+     * @param[in] width     Canvas width in pixels
+     *
+     * @return If at least one pixel is visible, it will return true otherwise false.
+     */
+    static bool clipSpan(int16_t& x, uint16_t& length, uint16_t& skip, uint16_t width)
+    {
+        bool    isVisible   = false;
+        int32_t start       = x;
+        int32_t end         = start + length;
+
+        if (0 > start)
+        {
+            start = 0;
+        }
+
+        if (width < end)
+        {
+            end = width;
+        }
+
+        if (start < end)
+        {
+            skip        = static_cast<uint16_t>(start - x);
+            x           = static_cast<int16_t>(start);
+            length      = static_cast<uint16_t>(end - start);
+            isVisible   = true;
+        }
+
+        return isVisible;
+    }
+
 private:
 
 };
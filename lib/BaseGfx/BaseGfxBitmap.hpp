@@ -65,6 +65,12 @@
  * Inside a base bitmap it can be drawn with the standard base
  * graphic functionality.
  *
+ * The bitmap keeps track of the area, which was changed since the
+ * dirty area was cleared the last time. Drawing a pixel with the color
+ * it already has, doesn't make it dirty. Because the non-const getColor()
+ * provides write access, every pixel retrieved that way is considered
+ * as dirty.
+ *
  * @tparam TColor The color representation.
  */
 template < typename TColor >
@@ -79,17 +85,251 @@ public:
     {
     }
 
+    /**
+     * Is any pixel changed since the dirty area was cleared the last time?
+     *
+     * @return If the bitmap is dirty, it will return true otherwise false.
+     */
+    bool isDirty() const
+    {
+        return (m_dirtyLeft <= m_dirtyRight);
+    }
+
+    /**
+     * Get the dirty area, which contains all pixels changed since the dirty
+     * area was cleared the last time. The area is clipped to the bitmap.
+     *
+     * @param[out] x        x-coordinate of upper left point
+     * @param[out] y        y-coordinate of upper left point
+     * @param[out] width    Area width in pixel
+     * @param[out] height   Area height in pixel
+     *
+     * @return If the bitmap is dirty, it will return true otherwise false.
+     */
+    bool getDirtyRect(int16_t& x, int16_t& y, uint16_t& width, uint16_t& height) const
+    {
+        bool    isDirtyArea = false;
+        int32_t left        = m_dirtyLeft;
+        int32_t top         = m_dirtyTop;
+        int32_t right       = m_dirtyRight;
+        int32_t bottom      = m_dirtyBottom;
+
+        if (0 > left)
+        {
+            left = 0;
+        }
+
+        if (0 > top)
+        {
+            top = 0;
+        }
+
+        if (this->getWidth() <= right)
+        {
+            right = this->getWidth() - 1;
+        }
+
+        if (this->getHeight() <= bottom)
+        {
+            bottom = this->getHeight() - 1;
+        }
+
+        if ((left <= right) &&
+            (top <= bottom))
+        {
+            x           = static_cast<int16_t>(left);
+            y           = static_cast<int16_t>(top);
+            width       = static_cast<uint16_t>(right - left + 1);
+            height      = static_cast<uint16_t>(bottom - top + 1);
+            isDirtyArea = true;
+        }
+
+        return isDirtyArea;
+    }
+
+    /**
+     * Clear the dirty area, e.g. after the bitmap content was shown.
+     */
+    void clearDirty()
+    {
+        m_dirtyLeft     = INT16_MAX;
+        m_dirtyTop      = INT16_MAX;
+        m_dirtyRight    = INT16_MIN;
+        m_dirtyBottom   = INT16_MIN;
+    }
+
+    /**
+     * Mark the whole bitmap as dirty.
+     * Use it if the pixels were changed without the bitmap being able to notice.
+     */
+    void markDirty()
+    {
+        m_dirtyLeft     = 0;
+        m_dirtyTop      = 0;
+        m_dirtyRight    = INT16_MAX;
+        m_dirtyBottom   = INT16_MAX;
+    }
+
 protected:
 
     /**
      * Constructs a bitmap.
+     * A new bitmap is completely dirty.
+     */
+    BaseGfxBitmap() :
+        m_dirtyLeft(0),
+        m_dirtyTop(0),
+        m_dirtyRight(INT16_MAX),
+        m_dirtyBottom(INT16_MAX)
+    {
+    }
+
+    /**
+     * Extend the dirty area by the given area.
+     * The area is clipped later by getDirtyRect().
+     *
+     * @param[in] x         x-coordinate of upper left point
+     * @param[in] y         y-coordinate of upper left point
+     * @param[in] width     Area width in pixel, shall be greater than 0.
+     * @param[in] height    Area height in pixel, shall be greater than 0.
+     */
+    void markDirtyArea(int16_t x, int16_t y, uint16_t width, uint16_t height)
+    {
+        int32_t right   = x + width - 1;
+        int32_t bottom  = y + height - 1;
+
+        if (INT16_MAX < right)
+        {
+            right = INT16_MAX;
+        }
+
+        if (INT16_MAX < bottom)
+        {
+            bottom = INT16_MAX;
+        }
+
+        if (m_dirtyLeft > x)
+        {
+            m_dirtyLeft = x;
+        }
+
+        if (m_dirtyTop > y)
+        {
+            m_dirtyTop = y;
+        }
+
+        if (m_dirtyRight < right)
+        {
+            m_dirtyRight = static_cast<int16_t>(right);
+        }
+
+        if (m_dirtyBottom < bottom)
+        {
+            m_dirtyBottom = static_cast<int16_t>(bottom);
+        }
+    }
+
+    /**
+     * Store a single pixel in the pixel buffer and mark it dirty,
+     * if its color changed.
+     *
+     * @param[out] pixel    Pixel in the pixel buffer
+     * @param[in] x         x-coordinate of the pixel
+     * @param[in] y         y-coordinate of the pixel
+     * @param[in] color     Color
+     */
+    void storePixel(TColor& pixel, int16_t x, int16_t y, const TColor& color)
+    {
+        if (color != pixel)
+        {
+            markDirtyArea(x, y, 1U, 1U);
+        }
+
+        pixel = color;
+    }
+
+    /**
+     * Fill a horizontal run of pixels in the pixel buffer and mark the
+     * changed pixels dirty.
+     * No out of bounds check!
+     *
+     * @param[out] pixels   First pixel of the run in the pixel buffer
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] color     Color
+     * @param[in] length    Number of pixels
      */
-    BaseGfxBitmap()
+    void storeSpan(TColor* pixels, int16_t x, int16_t y, const TColor& color, uint16_t length)
     {
+        uint16_t idx            = 0U;
+        uint16_t changedBegin   = length;
+        uint16_t changedEnd     = 0U;
+
+        for(idx = 0U; idx < length; ++idx)
+        {
+            if (color != pixels[idx])
+            {
+                if (changedBegin > idx)
+                {
+                    changedBegin = idx;
+                }
+
+                changedEnd = idx + 1U;
+            }
+
+            pixels[idx] = color;
+        }
+
+        if (changedBegin < changedEnd)
+        {
+            markDirtyArea(x + changedBegin, y, changedEnd - changedBegin, 1U);
+        }
+    }
+
+    /**
+     * Copy a horizontal run of pixels into the pixel buffer and mark the
+     * changed pixels dirty.
+     * No out of bounds check!
+     *
+     * @param[out] pixels   First pixel of the run in the pixel buffer
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    void storeSpan(TColor* pixels, int16_t x, int16_t y, const TColor* colors, uint16_t length)
+    {
+        uint16_t idx            = 0U;
+        uint16_t changedBegin   = length;
+        uint16_t changedEnd     = 0U;
+
+        for(idx = 0U; idx < length; ++idx)
+        {
+            if (colors[idx] != pixels[idx])
+            {
+                if (changedBegin > idx)
+                {
+                    changedBegin = idx;
+                }
+
+                changedEnd = idx + 1U;
+            }
+
+            pixels[idx] = colors[idx];
+        }
+
+        if (changedBegin < changedEnd)
+        {
+            markDirtyArea(x + changedBegin, y, changedEnd - changedBegin, 1U);
+        }
     }
 
 private:
 
+    int16_t m_dirtyLeft;    /**< x-coordinate of the most left dirty pixel */
+    int16_t m_dirtyTop;     /**< y-coordinate of the most top dirty pixel */
+    int16_t m_dirtyRight;   /**< x-coordinate of the most right dirty pixel */
+    int16_t m_dirtyBottom;  /**< y-coordinate of the most bottom dirty pixel */
 };
 
 /**
@@ -156,6 +396,8 @@ public:
                     ++idx;
                 }
             }
+
+            BaseGfxBitmap<TColor>::markDirty();
         }
 
         return *this;
@@ -201,6 +443,9 @@ public:
             (height > y))
         {
             pixel = &m_pixels[pixelMap(x, y)];
+
+            /* The caller may change the color. */
+            BaseGfxBitmap<TColor>::markDirtyArea(x, y, 1U, 1U);
         }
 
         return *pixel;
@@ -244,7 +489,70 @@ public:
             (width > x) &&
             (height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            BaseGfxBitmap<TColor>::storePixel(m_pixels[pixelMap(x, y)], x, y, color);
+        }
+    }
+
+    /**
+     * Get direct read access to a complete pixel row.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr, if the row is out of bounds.
+     */
+    const TColor* getRow(int16_t y) const
+    {
+        const TColor* row = nullptr;
+
+        if ((0 <= y) &&
+            (height > y))
+        {
+            row = &m_pixels[pixelMap(0U, y)];
+        }
+
+        return row;
+    }
+
+    /**
+     * Fill a horizontal run of pixels with a single color.
+     * The run is clipped to the bitmap borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const TColor& color)
+    {
+        uint16_t skip = 0U;
+
+        if ((0 <= y) &&
+            (height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, width)))
+        {
+            BaseGfxBitmap<TColor>::storeSpan(&m_pixels[pixelMap(x, y)], x, y, color, length);
+        }
+    }
+
+    /**
+     * Draw a horizontal run of pixels from a color buffer.
+     * The run is clipped to the bitmap borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const TColor* colors, uint16_t length)
+    {
+        uint16_t skip = 0U;
+
+        if ((nullptr != colors) &&
+            (0 <= y) &&
+            (height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, width)))
+        {
+            BaseGfxBitmap<TColor>::storeSpan(&m_pixels[pixelMap(x, y)], x, y, &colors[skip], length);
         }
     }
 
@@ -378,6 +686,8 @@ public:
 
                     m_width     = bitmap.m_width;
                     m_height    = bitmap.m_height;
+
+                    BaseGfxBitmap<TColor>::markDirty();
                 }
             }
         }
@@ -407,6 +717,8 @@ public:
                 m_width     = width;
                 m_height    = height;
 
+                BaseGfxBitmap<TColor>::markDirty();
+
                 isSuccessful = true;
             }
         }
@@ -465,6 +777,9 @@ public:
             (m_height > y))
         {
             pixel = &m_pixels[pixelMap(x, y)];
+
+            /* The caller may change the color. */
+            BaseGfxBitmap<TColor>::markDirtyArea(x, y, 1U, 1U);
         }
 
         return *pixel;
@@ -510,7 +825,73 @@ public:
             (m_width > x) &&
             (m_height > y))
         {
-            m_pixels[pixelMap(x, y)] = color;
+            BaseGfxBitmap<TColor>::storePixel(m_pixels[pixelMap(x, y)], x, y, color);
+        }
+    }
+
+    /**
+     * Get direct read access to a complete pixel row.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr, if the row is out of bounds.
+     */
+    const TColor* getRow(int16_t y) const
+    {
+        const TColor* row = nullptr;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= y) &&
+            (m_height > y))
+        {
+            row = &m_pixels[pixelMap(0U, y)];
+        }
+
+        return row;
+    }
+
+    /**
+     * Fill a horizontal run of pixels with a single color.
+     * The run is clipped to the bitmap borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const TColor& color)
+    {
+        uint16_t skip = 0U;
+
+        if ((nullptr != m_pixels) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, m_width)))
+        {
+            BaseGfxBitmap<TColor>::storeSpan(&m_pixels[pixelMap(x, y)], x, y, color, length);
+        }
+    }
+
+    /**
+     * Draw a horizontal run of pixels from a color buffer.
+     * The run is clipped to the bitmap borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const TColor* colors, uint16_t length)
+    {
+        uint16_t skip = 0U;
+
+        if ((nullptr != m_pixels) &&
+            (nullptr != colors) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, m_width)))
+        {
+            BaseGfxBitmap<TColor>::storeSpan(&m_pixels[pixelMap(x, y)], x, y, &colors[skip], length);
         }
     }
 
@@ -669,6 +1050,9 @@ public:
      */
     TColor& getColor(int16_t x, int16_t y)
     {
+        /* The caller may change the color. */
+        BaseGfxBitmap<TColor>::markDirtyArea(x, y, 1U, 1U);
+
         return m_gfx.getColor(x, y);
     }
 
@@ -694,9 +1078,58 @@ public:
      */
     virtual void drawPixel(int16_t x, int16_t y, const TColor& color)
     {
+        BaseGfxBitmap<TColor>::markDirtyArea(x, y, 1U, 1U);
         m_gfx.drawPixel(x, y, color);
     }
 
+    /**
+     * Get direct read access to a complete pixel row.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr
+     */
+    const TColor* getRow(int16_t y) const
+    {
+        return m_gfx.getRow(y);
+    }
+
+    /**
+     * Fill a horizontal run of pixels with a single color.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const TColor& color)
+    {
+        if (0U < length)
+        {
+            BaseGfxBitmap<TColor>::markDirtyArea(x, y, length, 1U);
+        }
+
+        m_gfx.fillSpan(x, y, length, color);
+    }
+
+    /**
+     * Draw a horizontal run of pixels from a color buffer.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const TColor* colors, uint16_t length)
+    {
+        if (0U < length)
+        {
+            BaseGfxBitmap<TColor>::markDirtyArea(x, y, length, 1U);
+        }
+
+        m_gfx.drawSpan(x, y, colors, length);
+    }
+
 private:
 
     BaseGfx<TColor>&    m_gfx;  /**< Graphic operations, hidden behind bitmap facade. */
@@ -303,6 +303,81 @@ public:
         }
     }
 
+    /**
+     * Get direct read access to a complete pixel row.
+     * Only available if the map window lies completely inside the
+     * underlying canvas.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr
+     */
+    const TColor* getRow(int16_t y) const final
+    {
+        const TColor* row = nullptr;
+
+        if ((nullptr != m_gfx) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (0 <= m_offsX) &&
+            (m_gfx->getWidth() >= (m_offsX + m_width)))
+        {
+            row = m_gfx->getRow(y + m_offsY);
+
+            if (nullptr != row)
+            {
+                row += m_offsX;
+            }
+        }
+
+        return row;
+    }
+
+    /**
+     * Fill a horizontal run of pixels with a single color.
+     * The run is clipped to the map borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Color
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const TColor& color) final
+    {
+        uint16_t skip = 0U;
+
+        if ((nullptr != m_gfx) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, m_width)))
+        {
+            m_gfx->fillSpan(x + m_offsX, y + m_offsY, length, color);
+        }
+    }
+
+    /**
+     * Draw a horizontal run of pixels from a color buffer.
+     * The run is clipped to the map borders.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Color buffer with at least length elements
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const TColor* colors, uint16_t length) final
+    {
+        uint16_t skip = 0U;
+
+        if ((nullptr != m_gfx) &&
+            (nullptr != colors) &&
+            (0 <= y) &&
+            (m_height > y) &&
+            (true == BaseGfx<TColor>::clipSpan(x, length, skip, m_width)))
+        {
+            m_gfx->drawSpan(x + m_offsX, y + m_offsY, colors + skip, length);
+        }
+    }
+
 private:
 
     BaseGfx<TColor>*    m_gfx;      /**< The underlying graphic operations. */
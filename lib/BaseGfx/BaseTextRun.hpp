@@ -0,0 +1,366 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pre-rasterized text run
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __BASE_TEXT_RUN_HPP__
+#define __BASE_TEXT_RUN_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <new>
+#include "BaseGfx.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * A text run is a pre-rasterized text, which can be drawn fast several times,
+ * e.g. while the text is scrolling.
+ *
+ * The text is drawn once into the text run, like into any other canvas. It
+ * keeps only a 1 bit mask of the drawn pixels and a single color per column,
+ * which is sufficient for text with color changes between the characters.
+ * Drawing the text run emits a span for every horizontal run of pixels with
+ * the same color, instead of unpacking every glyph bit by bit.
+ *
+ * @tparam TColor The color representation.
+ */
+template < typename TColor >
+class BaseTextRun : public BaseGfx<TColor>
+{
+public:
+
+    /**
+     * Constructs the text run, but without internal buffer.
+     */
+    BaseTextRun() :
+        BaseGfx<TColor>(),
+        m_mask(nullptr),
+        m_colors(nullptr),
+        m_width(0U),
+        m_height(0U),
+        m_stride(0U)
+    {
+    }
+
+    /**
+     * Destroys the text run.
+     */
+    virtual ~BaseTextRun()
+    {
+        release();
+    }
+
+    /**
+     * Create internal buffers. All pixels are cleared.
+     * If the buffers already exist, it will fail.
+     *
+     * @param[in] width     Text run width in pixels
+     * @param[in] height    Text run height in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height)
+    {
+        bool isSuccessful = false;
+
+        if ((nullptr == m_mask) &&
+            (0U < width) &&
+            (0U < height))
+        {
+            uint16_t stride = (width + 7U) / 8U;
+
+            m_mask      = new(std::nothrow) uint8_t[stride * height];
+            m_colors    = new(std::nothrow) TColor[width];
+
+            if ((nullptr == m_mask) ||
+                (nullptr == m_colors))
+            {
+                release();
+            }
+            else
+            {
+                m_width     = width;
+                m_height    = height;
+                m_stride    = stride;
+
+                clear();
+
+                isSuccessful = true;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Release the internal buffers.
+     */
+    void release()
+    {
+        if (nullptr != m_mask)
+        {
+            delete[] m_mask;
+            m_mask = nullptr;
+        }
+
+        if (nullptr != m_colors)
+        {
+            delete[] m_colors;
+            m_colors = nullptr;
+        }
+
+        m_width     = 0U;
+        m_height    = 0U;
+        m_stride    = 0U;
+    }
+
+    /**
+     * Use this function to determine whether the internal buffers are allocated or not.
+     *
+     * @return If no buffers are allocated, it will return false otherwise true.
+     */
+    bool isAllocated() const
+    {
+        return (nullptr != m_mask);
+    }
+
+    /**
+     * Clear all pixels.
+     */
+    void clear()
+    {
+        if (nullptr != m_mask)
+        {
+            memset(m_mask, 0, m_stride * m_height);
+        }
+    }
+
+    /**
+     * Get the width of the text run in pixels.
+     *
+     * @return Width in pixels
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get the height of the text run in pixels.
+     *
+     * @return Height in pixels
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Get the color of the column at the given position.
+     * Note, the text run keeps one color per column, therefore a change
+     * affects the whole column.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    TColor& getColor(int16_t x, int16_t y)
+    {
+        static TColor   trash;
+        TColor*         color   = &trash;
+
+        if ((nullptr != m_colors) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            color = &m_colors[x];
+        }
+
+        return *color;
+    }
+
+    /**
+     * Get the color of the column at the given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const TColor& getColor(int16_t x, int16_t y) const
+    {
+        static TColor   trash;
+        const TColor*   color   = &trash;
+
+        if ((nullptr != m_colors) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            color = &m_colors[x];
+        }
+
+        return *color;
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     * The color is taken over for the whole column.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const TColor& color)
+    {
+        if ((nullptr != m_mask) &&
+            (0 <= x) &&
+            (0 <= y) &&
+            (m_width > x) &&
+            (m_height > y))
+        {
+            m_mask[y * m_stride + (x / 8)] |= (0x80U >> (x % 8));
+            m_colors[x] = color;
+        }
+    }
+
+    /**
+     * Draw the text run with its top left corner at the given position.
+     * Only the pixels of the text are drawn, the background is kept.
+     *
+     * @param[in] gfx   Graphics interface
+     * @param[in] x     x-coordinate of the top left corner
+     * @param[in] y     y-coordinate of the top left corner
+     */
+    void draw(BaseGfx<TColor>& gfx, int16_t x, int16_t y) const
+    {
+        int32_t colBegin    = 0;
+        int32_t colEnd      = m_width;
+        int32_t row         = 0;
+
+        if (nullptr == m_mask)
+        {
+            return;
+        }
+
+        /* Clip the columns to the canvas. */
+        if (0 > x)
+        {
+            colBegin = -x;
+        }
+
+        if (gfx.getWidth() < (x + colEnd))
+        {
+            colEnd = gfx.getWidth() - x;
+        }
+
+        for(row = 0; row < m_height; ++row)
+        {
+            const uint8_t*  rowMask = &m_mask[row * m_stride];
+            int32_t         dstY    = y + row;
+            int32_t         col     = colBegin;
+
+            /* Row outside the canvas? */
+            if ((0 > dstY) ||
+                (gfx.getHeight() <= dstY))
+            {
+                col = colEnd;
+            }
+
+            while(colEnd > col)
+            {
+                /* Skip empty bytes at once. */
+                if ((0 == (col % 8)) &&
+                    (0U == rowMask[col / 8]))
+                {
+                    col += 8;
+                }
+                else if (0U == (rowMask[col / 8] & (0x80U >> (col % 8))))
+                {
+                    ++col;
+                }
+                else
+                {
+                    int32_t spanBegin = col;
+
+                    /* Collect all following pixels with the same color. */
+                    ++col;
+                    while((colEnd > col) &&
+                          (0U != (rowMask[col / 8] & (0x80U >> (col % 8)))) &&
+                          (m_colors[spanBegin] == m_colors[col]))
+                    {
+                        ++col;
+                    }
+
+                    gfx.fillSpan(x + spanBegin, dstY, col - spanBegin, m_colors[spanBegin]);
+                }
+            }
+        }
+    }
+
+private:
+
+    uint8_t*    m_mask;     /**< 1 bit per pixel mask, row by row, MSB first */
+    TColor*     m_colors;   /**< Color per column */
+    uint16_t    m_width;    /**< Text run width in pixels */
+    uint16_t    m_height;   /**< Text run height in pixels */
+    uint16_t    m_stride;   /**< Number of bytes per mask row */
+
+    BaseTextRun(const BaseTextRun& textRun);
+    BaseTextRun& operator=(const BaseTextRun& textRun);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __BASE_TEXT_RUN_HPP__ */
+
+/** @} */
\ No newline at end of file
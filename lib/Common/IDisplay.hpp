@@ -44,6 +44,7 @@
  * Includes
  *****************************************************************************/
 #include <YAGfx.h>
+#include <YAGfxBitmap.h>
 
 /******************************************************************************
  * Macros
@@ -81,6 +82,19 @@ public:
      */
     virtual void show() = 0;
 
+    /**
+     * Show a finished frame on the physical display. The frame is converted
+     * directly into the physical display buffer, without passing the display
+     * framebuffer, whose content is kept unchanged. This may be synchronous
+     * or asynchronous, but the frame can be modified again after the call
+     * returned.
+     *
+     * The frame shall have the same size as the display.
+     *
+     * @param[in] frame Frame which to show
+     */
+    virtual void show(const YAGfxBitmap& frame) = 0;
+
     /**
      * The display is ready, when the last physical pixel update is finished.
      * A asynchronous display update, triggered by show() can be observed this way.
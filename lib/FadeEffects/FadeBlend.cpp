@@ -0,0 +1,260 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Packed pixel blend kernel for fade effects
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FadeBlend.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static const Color* getSpan(const YAGfxBitmap* bitmap, int16_t x, int16_t y, uint16_t length, Color* buffer);
+static void blendFrame(YAGfx& gfx, const YAGfxBitmap* prev, const YAGfxBitmap* next, uint8_t alpha);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/**
+ * Number of pixels, which are blended at once. Rows which are wider,
+ * will be processed in several chunks.
+ */
+static const uint16_t   CHUNK_SIZE  = 64U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+extern void FadeBlend::blendSpan(Color* dst, const Color* prev, const Color* next, uint16_t length, uint8_t alpha)
+{
+    uint16_t idx = 0U;
+
+    if (nullptr == dst)
+    {
+        return;
+    }
+
+    /* Alpha is mapped from [0; 255] to [0; 256], which allows to divide by 256
+     * with a shift and still leads to the pure next color at max. alpha.
+     */
+    if (ALPHA_PREV == alpha)
+    {
+        for(idx = 0U; idx < length; ++idx)
+        {
+            dst[idx] = (nullptr != prev) ? static_cast<uint32_t>(prev[idx]) : 0U;
+        }
+    }
+    else if (ALPHA_NEXT == alpha)
+    {
+        for(idx = 0U; idx < length; ++idx)
+        {
+            dst[idx] = (nullptr != next) ? static_cast<uint32_t>(next[idx]) : 0U;
+        }
+    }
+    else
+    {
+        uint32_t packedAlpha = static_cast<uint32_t>(alpha) + (alpha >> 7U);
+
+        for(idx = 0U; idx < length; ++idx)
+        {
+            uint32_t prevColor = (nullptr != prev) ? static_cast<uint32_t>(prev[idx]) : 0U;
+            uint32_t nextColor = (nullptr != next) ? static_cast<uint32_t>(next[idx]) : 0U;
+
+            dst[idx] = blendPacked(prevColor, nextColor, packedAlpha);
+        }
+    }
+
+    return;
+}
+
+extern void FadeBlend::blend(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next, uint8_t alpha)
+{
+    blendFrame(gfx, &prev, &next, alpha);
+}
+
+extern void FadeBlend::dim(YAGfx& gfx, const YAGfxBitmap& bitmap, uint8_t intensity)
+{
+    blendFrame(gfx, nullptr, &bitmap, intensity);
+}
+
+extern void FadeBlend::copyRect(YAGfx& gfx, int16_t x, int16_t y, const YAGfxBitmap& bitmap, int16_t srcX, int16_t srcY, uint16_t width, uint16_t height)
+{
+    Color       buffer[CHUNK_SIZE];
+    uint16_t    yIndex  = 0U;
+
+    /* Clip to the source bitmap, the destination clips itself. */
+    if (0 > srcX)
+    {
+        x       -= srcX;
+        width   = (-srcX < width) ? (width + srcX) : 0U;
+        srcX    = 0;
+    }
+
+    if (0 > srcY)
+    {
+        y       -= srcY;
+        height  = (-srcY < height) ? (height + srcY) : 0U;
+        srcY    = 0;
+    }
+
+    if (bitmap.getWidth() < (srcX + width))
+    {
+        width = (bitmap.getWidth() > srcX) ? (bitmap.getWidth() - srcX) : 0U;
+    }
+
+    if (bitmap.getHeight() < (srcY + height))
+    {
+        height = (bitmap.getHeight() > srcY) ? (bitmap.getHeight() - srcY) : 0U;
+    }
+
+    for(yIndex = 0U; yIndex < height; ++yIndex)
+    {
+        uint16_t offset = 0U;
+
+        while(width > offset)
+        {
+            uint16_t        length  = ((width - offset) < CHUNK_SIZE) ? (width - offset) : CHUNK_SIZE;
+            const Color*    span    = getSpan(&bitmap, srcX + offset, srcY + yIndex, length, buffer);
+
+            gfx.drawSpan(x + offset, y + yIndex, span, length);
+
+            offset += length;
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Get read access to a run of pixels of a bitmap.
+ * If the bitmap provides direct row access, no copy is necessary.
+ * Otherwise the pixels are copied to the given buffer.
+ *
+ * @param[in] bitmap    Bitmap or nullptr for black
+ * @param[in] x         x-coordinate of the first pixel
+ * @param[in] y         y-coordinate
+ * @param[in] length    Number of pixels, shall not exceed the buffer size.
+ * @param[out] buffer   Buffer, used if no direct row access is possible.
+ *
+ * @return Pixel run or nullptr for black.
+ */
+static const Color* getSpan(const YAGfxBitmap* bitmap, int16_t x, int16_t y, uint16_t length, Color* buffer)
+{
+    const Color* span = nullptr;
+
+    if (nullptr != bitmap)
+    {
+        const Color* row = bitmap->getRow(y);
+
+        if ((nullptr != row) &&
+            (0 <= x) &&
+            (bitmap->getWidth() >= (x + length)))
+        {
+            span = &row[x];
+        }
+        else
+        {
+            uint16_t idx = 0U;
+
+            for(idx = 0U; idx < length; ++idx)
+            {
+                buffer[idx] = bitmap->getColor(x + idx, y);
+            }
+
+            span = buffer;
+        }
+    }
+
+    return span;
+}
+
+/**
+ * Blend two bitmaps chunk by chunk and draw the result to the graphics interface.
+ *
+ * @param[in] gfx   Graphics interface to draw on
+ * @param[in] prev  Previous bitmap or nullptr for black
+ * @param[in] next  Next bitmap or nullptr for black
+ * @param[in] alpha Alpha value [0; 255] - 0: previous bitmap / 255: next bitmap
+ */
+static void blendFrame(YAGfx& gfx, const YAGfxBitmap* prev, const YAGfxBitmap* next, uint8_t alpha)
+{
+    Color       prevBuffer[CHUNK_SIZE];
+    Color       nextBuffer[CHUNK_SIZE];
+    Color       dstBuffer[CHUNK_SIZE];
+    uint16_t    width       = gfx.getWidth();
+    uint16_t    height      = gfx.getHeight();
+    int16_t     y           = 0;
+
+    for(y = 0; y < height; ++y)
+    {
+        int16_t x = 0;
+
+        while(width > x)
+        {
+            uint16_t        length      = ((width - x) < CHUNK_SIZE) ? (width - x) : CHUNK_SIZE;
+            const Color*    prevSpan    = getSpan(prev, x, y, length, prevBuffer);
+            const Color*    nextSpan    = getSpan(next, x, y, length, nextBuffer);
+
+            FadeBlend::blendSpan(dstBuffer, prevSpan, nextSpan, length, alpha);
+            gfx.drawSpan(x, y, dstBuffer, length);
+
+            x += length;
+        }
+    }
+
+    return;
+}
\ No newline at end of file
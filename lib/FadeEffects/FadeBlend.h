@@ -0,0 +1,146 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Packed pixel blend kernel for fade effects
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __FADE_BLEND_H__
+#define __FADE_BLEND_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/** Blend functions, used by the fade effects to compose the display content. */
+namespace FadeBlend
+{
+
+/** Alpha value, which results in the previous colors only. */
+static const uint8_t    ALPHA_PREV  = 0U;
+
+/** Alpha value, which results in the next colors only. */
+static const uint8_t    ALPHA_NEXT  = UINT8_MAX;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Blend two RGB24 colors, which are packed in a 32-bit value.
+ * The red and blue channel are calculated together in one 32-bit operation,
+ * the green channel in a second one.
+ *
+ * @param[in] prev  Previous color in RGB24 format
+ * @param[in] next  Next color in RGB24 format
+ * @param[in] alpha Alpha value [0; 256] - 0: previous color / 256: next color
+ *
+ * @return Blended color in RGB24 format
+ */
+inline uint32_t blendPacked(uint32_t prev, uint32_t next, uint32_t alpha)
+{
+    const uint32_t  MASK_RB     = 0x00ff00ffU;
+    const uint32_t  MASK_G      = 0x0000ff00U;
+    const uint32_t  INV_ALPHA   = 256U - alpha;
+    uint32_t        rb          = ((prev & MASK_RB) * INV_ALPHA) + ((next & MASK_RB) * alpha);
+    uint32_t        g           = ((prev & MASK_G) * INV_ALPHA) + ((next & MASK_G) * alpha);
+
+    return ((rb >> 8U) & MASK_RB) | ((g >> 8U) & MASK_G);
+}
+
+/**
+ * Blend two color runs and write the result into the destination run.
+ * The source runs are not modified.
+ *
+ * @param[out] dst      Destination color buffer with at least length elements
+ * @param[in] prev      Previous color buffer or nullptr for black
+ * @param[in] next      Next color buffer or nullptr for black
+ * @param[in] length    Number of pixels
+ * @param[in] alpha     Alpha value [0; 255] - 0: previous colors / 255: next colors
+ */
+extern void blendSpan(Color* dst, const Color* prev, const Color* next, uint16_t length, uint8_t alpha);
+
+/**
+ * Blend two bitmaps and draw the result to the graphics interface in a single pass.
+ * The bitmaps shall have at least the size of the graphics interface.
+ *
+ * @param[in] gfx   Graphics interface to draw on
+ * @param[in] prev  Previous bitmap
+ * @param[in] next  Next bitmap
+ * @param[in] alpha Alpha value [0; 255] - 0: previous bitmap / 255: next bitmap
+ */
+extern void blend(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next, uint8_t alpha);
+
+/**
+ * Draw a bitmap with reduced intensity to the graphics interface in a single pass.
+ * This is the same as blending black with the bitmap.
+ * The bitmap shall have at least the size of the graphics interface.
+ *
+ * @param[in] gfx       Graphics interface to draw on
+ * @param[in] bitmap    Bitmap
+ * @param[in] intensity Intensity [0; 255] - 0: black / 255: bitmap
+ */
+extern void dim(YAGfx& gfx, const YAGfxBitmap& bitmap, uint8_t intensity);
+
+/**
+ * Copy a rectangular area of a bitmap to the graphics interface.
+ * The area is clipped to the bitmap and to the graphics interface.
+ *
+ * @param[in] gfx       Graphics interface to draw on
+ * @param[in] x         x-coordinate of the destination upper left point
+ * @param[in] y         y-coordinate of the destination upper left point
+ * @param[in] bitmap    Source bitmap
+ * @param[in] srcX      x-coordinate of the source upper left point
+ * @param[in] srcY      y-coordinate of the source upper left point
+ * @param[in] width     Area width in pixel
+ * @param[in] height    Area height in pixel
+ */
+extern void copyRect(YAGfx& gfx, int16_t x, int16_t y, const YAGfxBitmap& bitmap, int16_t srcX, int16_t srcY, uint16_t width, uint16_t height);
+
+}
+
+#endif  /* __FADE_BLEND_H__ */
+
+/** @} */
\ No newline at end of file
@@ -25,14 +25,14 @@
     DESCRIPTION
 *******************************************************************************/
 /**
- * @brief  HTTP header
+ * @brief  Cross fade effect, which blends the old content into the new one.
  * @author Andreas Merkle <web@blue-andi.de>
  */
 
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "HttpHeader.h"
+#include "FadeCross.h"
 
 /******************************************************************************
  * Compiler Switches
@@ -58,39 +58,44 @@
  * Public Methods
  *****************************************************************************/
 
-HttpHeader& HttpHeader::operator=(const HttpHeader& hdr)
+void FadeCross::init()
 {
-    if (this != &hdr)
-    {
-        m_name = hdr.m_name;
-        m_value = hdr.m_value;
-    }
+    m_state = FADE_STATE_INIT;
+}
 
-    return *this;
+bool FadeCross::fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
+{
+    (void)prev;
+
+    /* The new content is already completely blended in during fading out. */
+    gfx.copy(next);
+
+    return true;
 }
 
-void HttpHeader::parse(const String& line)
+bool FadeCross::fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
-    int idx = line.indexOf(':');
+    bool isFinished = false;
 
-    if (0 <= idx)
+    if (FADE_STATE_OUT != m_state)
     {
-        m_name = line.substring(0, idx);
-        m_value = line.substring(idx + 2);
-
-        /* There may be CRLF at the end, which must be removed. */
-        idx = m_value.indexOf("\r\n");
+        m_state = FADE_STATE_OUT;
+        m_alpha = FadeBlend::ALPHA_PREV;
+    }
 
-        if (0 <= idx)
-        {
-            m_value.remove(idx);
-        }
+    if ((FadeBlend::ALPHA_NEXT - FADING_STEP) <= m_alpha)
+    {
+        FadeBlend::blend(gfx, prev, next, FadeBlend::ALPHA_NEXT);
+        m_state     = FADE_STATE_INIT;
+        isFinished  = true;
+    }
+    else
+    {
+        FadeBlend::blend(gfx, prev, next, m_alpha);
+        m_alpha += FADING_STEP;
     }
-}
 
-String HttpHeader::toString() const
-{
-    return String(m_name + ": " + m_value);
+    return isFinished;
 }
 
 /******************************************************************************
@@ -33,6 +33,7 @@
  * Includes
  *****************************************************************************/
 #include "FadeLinear.h"
+#include "FadeBlend.h"
 
 /******************************************************************************
  * Compiler Switches
@@ -63,7 +64,7 @@ void FadeLinear::init()
     m_state = FADE_STATE_INIT;
 }
 
-bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeLinear::fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
     bool isFinished = false;
 
@@ -78,22 +79,20 @@ bool FadeLinear::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MAX_BRIGHT - FADING_STEP) <= m_intensity)
     {
-        dimBitmap(next, Color::MAX_BRIGHT);
+        FadeBlend::dim(gfx, next, Color::MAX_BRIGHT);
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
     }
     else
     {
-        dimBitmap(next, m_intensity);
+        FadeBlend::dim(gfx, next, m_intensity);
         m_intensity += FADING_STEP;
     }
 
-    gfx.copy(next);
-
     return isFinished;
 }
 
-bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeLinear::fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
     bool isFinished = false;
 
@@ -108,18 +107,16 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
 
     if ((Color::MIN_BRIGHT + FADING_STEP) >= m_intensity)
     {
-        dimBitmap(prev, Color::MIN_BRIGHT);
+        FadeBlend::dim(gfx, prev, Color::MIN_BRIGHT);
         m_state     = FADE_STATE_INIT;
         isFinished  = true;
     }
     else
     {
-        dimBitmap(prev, m_intensity);
+        FadeBlend::dim(gfx, prev, m_intensity);
         m_intensity -= FADING_STEP;
     }
 
-    gfx.copy(prev);
-
     return isFinished;
 }
 
@@ -131,22 +128,6 @@ bool FadeLinear::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
  * Private Methods
  *****************************************************************************/
 
-void FadeLinear::dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity)
-{
-    uint16_t    width   = bitmap.getWidth();
-    uint16_t    height  = bitmap.getHeight();
-    int16_t     x       = 0;
-    int16_t     y       = 0;
-
-    for(y = 0; y < height; ++y)
-    {
-        for(x = 0; x < width; ++x)
-        {
-            bitmap.getColor(x, y).setIntensity(intensity);
-        }
-    }
-}
-
 /******************************************************************************
  * External Functions
  *****************************************************************************/
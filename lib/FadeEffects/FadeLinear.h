@@ -91,7 +91,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    bool fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) final;
+    bool fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) final;
 
     /**
      * Achieves a fade out effect. Call this method as long as the effect is not completed.
@@ -102,7 +102,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    bool fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) final;
+    bool fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) final;
 
     /**
      * Fading step per fadeIn/fadeOut call.
@@ -123,14 +123,6 @@ private:
 
     FadeState   m_state;        /**< Current fading state */
     uint8_t     m_intensity;    /**< Current color intensity [0; 255] - 0: min. bright / 255: max. bright */
-
-    /**
-     * Dim bitmap to a specific intensity.
-     * 
-     * @param[inout] bitmap The bitmap which to dim down/up.
-     * @param[in] intensity The intensity to set.
-     */
-    void dimBitmap(YAGfxBitmap& bitmap, uint8_t intensity);
 };
 
 /******************************************************************************
@@ -33,6 +33,7 @@
  * Includes
  *****************************************************************************/
 #include "FadeMoveX.h"
+#include "FadeBlend.h"
 
 /******************************************************************************
  * Compiler Switches
@@ -63,7 +64,7 @@ void FadeMoveX::init()
     m_state = FADE_STATE_INIT;
 }
 
-bool FadeMoveX::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeMoveX::fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
     (void)prev;
 
@@ -72,11 +73,11 @@ bool FadeMoveX::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
     return true;
 }
 
-bool FadeMoveX::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeMoveX::fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
-    bool    isFinished  = false;
-    int16_t x           = 0;
-    int16_t y           = 0;
+    bool        isFinished  = false;
+    uint16_t    width       = gfx.getWidth();
+    uint16_t    height      = gfx.getHeight();
 
     if (FADE_STATE_OUT != m_state)
     {
@@ -84,21 +85,9 @@ bool FadeMoveX::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
         m_xOffset   = 0;
     }
 
-    for(x = 0; x < (gfx.getWidth() - m_xOffset); ++x)
-    {
-        for(y = 0; y < gfx.getHeight(); ++y)
-        {
-            gfx.drawPixel(x, y, prev.getColor(x + m_xOffset, y));
-        }
-    }
-
-    for(x = gfx.getWidth() - m_xOffset; x < gfx.getWidth(); ++x)
-    {
-        for(y = 0; y < gfx.getHeight(); ++y)
-        {
-            gfx.drawPixel(x, y, next.getColor((x + m_xOffset) - gfx.getWidth(), y));
-        }
-    }
+    /* Previous content moves out on the left side, next content moves in on the right side. */
+    FadeBlend::copyRect(gfx, 0, 0, prev, m_xOffset, 0, width - m_xOffset, height);
+    FadeBlend::copyRect(gfx, width - m_xOffset, 0, next, 0, 0, m_xOffset, height);
 
     ++m_xOffset;
 
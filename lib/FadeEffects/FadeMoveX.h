@@ -93,7 +93,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    bool fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) final;
+    bool fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) final;
 
     /**
      * Achieves a fade out effect. Call this method as long as the effect is not completed.
@@ -104,7 +104,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    bool fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) final;
+    bool fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) final;
 
 private:
 
@@ -33,6 +33,7 @@
  * Includes
  *****************************************************************************/
 #include "FadeMoveY.h"
+#include "FadeBlend.h"
 
 /******************************************************************************
  * Compiler Switches
@@ -63,7 +64,7 @@ void FadeMoveY::init()
     m_state = FADE_STATE_INIT;
 }
 
-bool FadeMoveY::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeMoveY::fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
     (void)prev;
 
@@ -72,11 +73,11 @@ bool FadeMoveY::fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
     return true;
 }
 
-bool FadeMoveY::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
+bool FadeMoveY::fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next)
 {
-    bool    isFinished  = false;
-    int16_t x           = 0;
-    int16_t y           = 0;
+    bool        isFinished  = false;
+    uint16_t    width       = gfx.getWidth();
+    uint16_t    height      = gfx.getHeight();
 
     if (FADE_STATE_OUT != m_state)
     {
@@ -84,21 +85,9 @@ bool FadeMoveY::fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next)
         m_yOffset   = 0;
     }
 
-    for(y = 0; y < (gfx.getHeight() - m_yOffset); ++y)
-    {
-        for(x = 0; x < gfx.getWidth(); ++x)
-        {
-            gfx.drawPixel(x, y, prev.getColor(x , (y + m_yOffset)));
-        }
-    }
-
-    for(y = gfx.getHeight() - m_yOffset; y < gfx.getHeight(); ++y)
-    {
-        for(x = 0; x < gfx.getWidth(); ++x)
-        {
-            gfx.drawPixel(x, y, next.getColor(x, ((y + m_yOffset) - gfx.getHeight())));
-        }
-    }
+    /* Previous content moves out on the top, next content moves in on the bottom. */
+    FadeBlend::copyRect(gfx, 0, 0, prev, 0, m_yOffset, width, height - m_yOffset);
+    FadeBlend::copyRect(gfx, 0, height - m_yOffset, next, 0, 0, width, m_yOffset);
 
     ++m_yOffset;
 
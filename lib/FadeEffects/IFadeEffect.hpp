@@ -57,7 +57,7 @@
 /**
  * Base fade effect interface, used to fade display content in or out.
  * The effect will fade in/out from one framebuffer to another and draws the
- * result directly to the display.
+ * result directly to the display. The framebuffers itself are not modified.
  */
 class IFadeEffect
 {
@@ -84,7 +84,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    virtual bool fadeIn(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) = 0;
+    virtual bool fadeIn(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) = 0;
 
     /**
      * Achieves a fade out effect. Call this method as long as the effect is not completed.
@@ -95,7 +95,7 @@ public:
      *
      * @return If the effect is complete, it will return true otherwise false.
      */
-    virtual bool fadeOut(YAGfx& gfx, YAGfxBitmap& prev, YAGfxBitmap& next) = 0;
+    virtual bool fadeOut(YAGfx& gfx, const YAGfxBitmap& prev, const YAGfxBitmap& next) = 0;
 
 protected:
 
@@ -70,14 +70,42 @@ Display::Display() :
     IDisplay(),
     m_strip(Board::LedMatrix::width * Board::LedMatrix::height, Board::Pin::ledMatrixDataOutPinNo),
     m_topo(Board::LedMatrix::width, Board::LedMatrix::height),
-    m_ledMatrix()
+    m_ledMatrix(),
+    m_topoLut(),
+    m_brightnessLut()
 {
+    int16_t x       = 0;
+    int16_t y       = 0;
+    size_t  index   = 0U;
+
+    /* The panel topology never changes, therefore map every pixel just once. */
+    for(y = 0; y < Board::LedMatrix::height; ++y)
+    {
+        for(x = 0; x < Board::LedMatrix::width; ++x)
+        {
+            m_topoLut[index] = m_topo.Map(x, y);
+            ++index;
+        }
+    }
+
+    updateBrightnessLut(UINT8_MAX);
 }
 
 Display::~Display()
 {
 }
 
+void Display::updateBrightnessLut(uint8_t brightness)
+{
+    const uint16_t  SCALE   = static_cast<uint16_t>(brightness) + 1U;
+    uint16_t        value   = 0U;
+
+    for(value = 0U; value <= UINT8_MAX; ++value)
+    {
+        m_brightnessLut[value] = static_cast<uint8_t>((value * SCALE) >> 8U);
+    }
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -45,7 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <IDisplay.hpp>
-#include <NeoPixelBrightnessBus.h>
+#include <NeoPixelBus.h>
 #include <ColorDef.hpp>
 #include <YAGfxBitmap.h>
 
@@ -97,19 +97,51 @@ public:
      */
     void show() final
     {
-        int16_t x = 0;
-        int16_t y = 0;
+        show(m_ledMatrix);
+        return;
+    }
 
-        for(y = 0; y < m_ledMatrix.getHeight(); ++y)
+    /**
+     * Show a finished frame on the physical display. The frame is converted
+     * directly into the LED strip buffer, the display framebuffer is not used.
+     *
+     * The frame is walked linear and every pixel is written as packed GRB
+     * bytes to its strip position, which is taken from the topology lookup
+     * table. The brightness is applied via lookup table as well.
+     *
+     * @param[in] frame Frame which to show
+     */
+    void show(const YAGfxBitmap& frame) final
+    {
+        uint8_t*    stripPixels = m_strip.Pixels();
+        size_t      index       = 0U;
+        int16_t     x           = 0;
+        int16_t     y           = 0;
+
+        for(y = 0; y < Board::LedMatrix::height; ++y)
         {
-            for(x = 0; x < m_ledMatrix.getWidth(); ++x)
+            const Color* row = nullptr;
+
+            if (Board::LedMatrix::width <= frame.getWidth())
+            {
+                row = frame.getRow(y);
+            }
+
+            for(x = 0; x < Board::LedMatrix::width; ++x)
             {
-                HtmlColor htmlColor = static_cast<uint32_t>(m_ledMatrix.getColor(x, y));
+                const Color&    color   = (nullptr != row) ? row[x] : frame.getColor(x, y);
+                uint32_t        rgb     = static_cast<uint32_t>(color);
+                uint8_t*        grb     = &stripPixels[m_topoLut[index] * BYTES_PER_PIXEL];
+
+                grb[0U] = m_brightnessLut[Color::extractGreen(rgb)];
+                grb[1U] = m_brightnessLut[Color::extractRed(rgb)];
+                grb[2U] = m_brightnessLut[Color::extractBlue(rgb)];
 
-                m_strip.SetPixelColor(m_topo.Map(x, y), htmlColor);
+                ++index;
             }
         }
 
+        m_strip.Dirty();
         m_strip.Show();
         return;
     }
@@ -139,7 +171,7 @@ public:
             (Board::LedMatrix::supplyCurrentMax * brightness) /
             (Board::LedMatrix::maxCurrentPerLed * Board::LedMatrix::width *Board::LedMatrix::height);
 
-        m_strip.SetBrightness(SAFE_BRIGHTNESS);
+        updateBrightnessLut(SAFE_BRIGHTNESS);
         return;
     }
 
@@ -200,10 +232,28 @@ public:
         return m_ledMatrix.getColor(x, y);
     }
 
+    /**
+     * Get direct read access to a complete pixel row.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr
+     */
+    const Color* getRow(int16_t y) const final
+    {
+        return m_ledMatrix.getRow(y);
+    }
+
 private:
 
+    /** Number of pixels of the LED matrix. */
+    static const size_t     PIXEL_COUNT     = Board::LedMatrix::width * Board::LedMatrix::height;
+
+    /** Number of bytes per pixel in the LED strip buffer (GRB). */
+    static const size_t     BYTES_PER_PIXEL = 3U;
+
     /** Pixel representation of the LED matrix */
-    NeoPixelBrightnessBus<NeoGrbFeature, Neo800KbpsMethod>                  m_strip;
+    NeoPixelBus<NeoGrbFeature, Neo800KbpsMethod>                            m_strip;
 
     /** Panel topology, used to map coordinates to the framebuffer. */
     NeoTopology<ColumnMajorAlternatingLayout>                               m_topo;
@@ -214,6 +264,15 @@ private:
      */
     YAGfxStaticBitmap<Board::LedMatrix::width, Board::LedMatrix::height>    m_ledMatrix;
 
+    /**
+     * LED strip pixel index for every framebuffer pixel (row by row),
+     * derived once from the panel topology.
+     */
+    uint16_t                                                                m_topoLut[PIXEL_COUNT];
+
+    /** Brightness adjusted value for every base color value. */
+    uint8_t                                                                 m_brightnessLut[UINT8_MAX + 1U];
+
     /**
      * Construct display.
      */
@@ -227,6 +286,14 @@ private:
     Display(const Display& display);
     Display& operator=(const Display& display);
 
+    /**
+     * Update the brightness lookup table.
+     * The scaling is the same, like the NeoPixelBrightnessBus does.
+     *
+     * @param[in] brightness    Brightness value [0; 255]
+     */
+    void updateBrightnessLut(uint8_t brightness);
+
     /**
      * Draw a single pixel on the display.
      *
@@ -238,6 +305,32 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Fill a horizontal run of pixels on the display with a single color.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Pixel color in RGB888 format
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const Color& color) final
+    {
+        m_ledMatrix.fillSpan(x, y, length, color);
+    }
+
+    /**
+     * Draw a horizontal run of pixels on the display.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Pixel colors in RGB888 format
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const Color* colors, uint16_t length) final
+    {
+        m_ledMatrix.drawSpan(x, y, colors, length);
+    }
 };
 
 /******************************************************************************
@@ -96,6 +96,19 @@ public:
      * or asynchronous.
      */
     void show() final
+    {
+        show(m_ledMatrix);
+        return;
+    }
+
+    /**
+     * Show a finished frame on the physical display. The frame is drawn
+     * directly to the T-Display, the simulated LED matrix framebuffer is
+     * not used.
+     *
+     * @param[in] frame Frame which to show
+     */
+    void show(const YAGfxBitmap& frame) final
     {
         int32_t x = 0;
         int32_t y = 0;
@@ -104,7 +117,7 @@ public:
         {
             for(x = 0; x < MATRIX_WIDTH; ++x)
             {
-                Color       brightnessAdjustedColor = m_ledMatrix.getColor(x, y);
+                Color       brightnessAdjustedColor = frame.getColor(x, y);
                 uint16_t    intensity               = brightnessAdjustedColor.getIntensity();
 
                 intensity *= (static_cast<uint16_t>(m_brightness) + 1U);
@@ -203,6 +216,18 @@ public:
         return m_ledMatrix.getColor(x, y);
     }
 
+    /**
+     * Get direct read access to a complete pixel row.
+     *
+     * @param[in] y y-coordinate
+     *
+     * @return Pixel row or nullptr
+     */
+    const Color* getRow(int16_t y) const final
+    {
+        return m_ledMatrix.getRow(y);
+    }
+
 private:
 
     /** Display matrix width in pixels (not T-Display width) */
@@ -257,6 +282,32 @@ private:
     {
         m_ledMatrix.drawPixel(x, y, color);
     }
+
+    /**
+     * Fill a horizontal run of pixels on the display with a single color.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] length    Number of pixels
+     * @param[in] color     Pixel color in RGB888 format
+     */
+    void fillSpan(int16_t x, int16_t y, uint16_t length, const Color& color) final
+    {
+        m_ledMatrix.fillSpan(x, y, length, color);
+    }
+
+    /**
+     * Draw a horizontal run of pixels on the display.
+     *
+     * @param[in] x         x-coordinate of the first pixel
+     * @param[in] y         y-coordinate
+     * @param[in] colors    Pixel colors in RGB888 format
+     * @param[in] length    Number of pixels
+     */
+    void drawSpan(int16_t x, int16_t y, const Color* colors, uint16_t length) final
+    {
+        m_ledMatrix.drawSpan(x, y, colors, length);
+    }
 };
 
 /******************************************************************************
@@ -0,0 +1,250 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Lock-free frame snapshot
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FrameSnapshot.h"
+
+#include <string.h>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+FrameSnapshot::FrameSnapshot() :
+    m_buffers(),
+    m_latest(NO_BUFFER),
+    m_writeIdx(NO_BUFFER),
+    m_length(0U)
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < BUFFER_COUNT; ++idx)
+    {
+        m_buffers[idx].pixels   = nullptr;
+        m_buffers[idx].info     = 0U;
+        m_buffers[idx].readers  = 0U;
+    }
+}
+
+FrameSnapshot::~FrameSnapshot()
+{
+    destroy();
+}
+
+bool FrameSnapshot::create(size_t length)
+{
+    bool    isSuccessful    = true;
+    uint8_t idx             = 0U;
+
+    destroy();
+
+    if (0U == length)
+    {
+        isSuccessful = false;
+    }
+
+    for(idx = 0U; (idx < BUFFER_COUNT) && (true == isSuccessful); ++idx)
+    {
+        m_buffers[idx].pixels = new(std::nothrow) uint32_t[length];
+
+        if (nullptr == m_buffers[idx].pixels)
+        {
+            isSuccessful = false;
+        }
+    }
+
+    if (false == isSuccessful)
+    {
+        destroy();
+    }
+    else
+    {
+        m_length = length;
+    }
+
+    return isSuccessful;
+}
+
+void FrameSnapshot::destroy()
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < BUFFER_COUNT; ++idx)
+    {
+        if (nullptr != m_buffers[idx].pixels)
+        {
+            delete[] m_buffers[idx].pixels;
+            m_buffers[idx].pixels = nullptr;
+        }
+
+        m_buffers[idx].readers = 0U;
+    }
+
+    m_latest    = NO_BUFFER;
+    m_writeIdx  = NO_BUFFER;
+    m_length    = 0U;
+
+    return;
+}
+
+uint32_t* FrameSnapshot::beginWrite()
+{
+    uint32_t*   pixels  = nullptr;
+    int8_t      latest  = m_latest.load();
+    int8_t      idx     = 0;
+
+    m_writeIdx = NO_BUFFER;
+
+    if (0U < m_length)
+    {
+        /* Find a buffer, which is neither published nor used by a reader.
+         * A reader increments the reference counter, before it checks
+         * whether the buffer is still the published one. Therefore a reader,
+         * which increments it after this check, will notice that the buffer
+         * is not the published one anymore and try again.
+         */
+        for(idx = 0; (idx < static_cast<int8_t>(BUFFER_COUNT)) && (NO_BUFFER == m_writeIdx); ++idx)
+        {
+            if ((latest != idx) &&
+                (0U == m_buffers[idx].readers.load()))
+            {
+                m_writeIdx = idx;
+            }
+        }
+
+        if (NO_BUFFER != m_writeIdx)
+        {
+            pixels = m_buffers[m_writeIdx].pixels;
+        }
+    }
+
+    return pixels;
+}
+
+void FrameSnapshot::endWrite(uint32_t info)
+{
+    if (NO_BUFFER != m_writeIdx)
+    {
+        m_buffers[m_writeIdx].info = info;
+        m_latest.store(m_writeIdx);
+        m_writeIdx = NO_BUFFER;
+    }
+
+    return;
+}
+
+bool FrameSnapshot::read(uint32_t* dst, size_t length, uint32_t& info)
+{
+    bool    isSuccessful    = false;
+    bool    isAcquired      = false;
+    int8_t  idx             = NO_BUFFER;
+
+    if (nullptr != dst)
+    {
+        /* Reference the published buffer. If the writer published a newer
+         * frame meanwhile, the buffer may be overwritten and the newer one
+         * is referenced instead.
+         */
+        while(false == isAcquired)
+        {
+            idx = m_latest.load();
+
+            if (NO_BUFFER == idx)
+            {
+                break;
+            }
+
+            ++m_buffers[idx].readers;
+
+            if (idx == m_latest.load())
+            {
+                isAcquired = true;
+            }
+            else
+            {
+                --m_buffers[idx].readers;
+            }
+        }
+
+        if (true == isAcquired)
+        {
+            const Buffer&   buffer  = m_buffers[idx];
+            size_t          count   = (m_length < length) ? m_length : length;
+
+            memcpy(dst, buffer.pixels, count * sizeof(uint32_t));
+            info = buffer.info;
+
+            --m_buffers[idx].readers;
+
+            isSuccessful = true;
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
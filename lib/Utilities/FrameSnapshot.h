@@ -0,0 +1,173 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Lock-free frame snapshot
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __FRAME_SNAPSHOT_H__
+#define __FRAME_SNAPSHOT_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Lock-free snapshot of the last completed frame.
+ *
+ * A single writer publishes completed frames and any number of readers copy
+ * the latest published one. The writer never waits for a reader and a
+ * reader never waits for the writer. Every reader holds a reference to the
+ * buffer it copies from, the writer only fills buffers, which are neither
+ * published nor referenced.
+ *
+ * With up to MAX_READERS readers at the same time, the writer always finds
+ * a free buffer. With more, the writer may drop a frame, but it will still
+ * not block.
+ */
+class FrameSnapshot
+{
+public:
+
+    /** Max. number of readers at the same time, without dropping frames. */
+    static const uint8_t    MAX_READERS     = 2U;
+
+    /**
+     * Constructs an empty frame snapshot.
+     */
+    FrameSnapshot();
+
+    /**
+     * Destroys the frame snapshot.
+     */
+    ~FrameSnapshot();
+
+    /**
+     * Allocate the frame buffers.
+     * Don't call it, while the snapshot is in use.
+     *
+     * @param[in] length    Frame length in pixels
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(size_t length);
+
+    /**
+     * Release the frame buffers.
+     * Don't call it, while the snapshot is in use.
+     */
+    void destroy();
+
+    /**
+     * Get frame length in pixels.
+     *
+     * @return Frame length in pixels
+     */
+    size_t getLength() const
+    {
+        return m_length;
+    }
+
+    /**
+     * Get a free frame buffer, which the writer can fill.
+     * Only a single writer is supported.
+     *
+     * @return Frame buffer with getLength() pixels. If no frame buffer is available, it will return nullptr.
+     */
+    uint32_t* beginWrite();
+
+    /**
+     * Publish the frame buffer, which was filled after beginWrite().
+     *
+     * @param[in] info  Additional information, which belongs to the frame.
+     */
+    void endWrite(uint32_t info);
+
+    /**
+     * Copy the latest published frame.
+     * If the destination is smaller than the frame, only the first pixels will be copied.
+     *
+     * @param[out] dst      Destination buffer
+     * @param[in] length    Destination buffer length in pixels
+     * @param[out] info     Additional information, which belongs to the frame.
+     *
+     * @return If a frame was copied, it will return true otherwise false.
+     */
+    bool read(uint32_t* dst, size_t length, uint32_t& info);
+
+private:
+
+    /** Number of frame buffers: One for every reader, the published one and the one for the writer. */
+    static const uint8_t    BUFFER_COUNT    = MAX_READERS + 2U;
+
+    /** Invalid frame buffer index */
+    static const int8_t     NO_BUFFER       = -1;
+
+    /**
+     * A single frame buffer.
+     */
+    struct Buffer
+    {
+        uint32_t*               pixels;     /**< Pixels in RGB24 format */
+        uint32_t                info;       /**< Additional frame information */
+        std::atomic<uint32_t>   readers;    /**< Number of readers, which reference the buffer */
+    };
+
+    Buffer              m_buffers[BUFFER_COUNT];    /**< Frame buffers */
+    std::atomic<int8_t> m_latest;                   /**< Index of the latest published frame buffer */
+    int8_t              m_writeIdx;                 /**< Index of the frame buffer, which the writer fills */
+    size_t              m_length;                   /**< Frame length in pixels */
+
+    FrameSnapshot(const FrameSnapshot& snapshot);
+    FrameSnapshot& operator=(const FrameSnapshot& snapshot);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __FRAME_SNAPSHOT_H__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,304 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary framebuffer codec
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "FramebufferCodec.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void writeHeader(uint8_t* buffer, uint8_t flags, uint8_t slotId, uint16_t width, uint16_t height);
+static void writePixel(uint8_t* buffer, uint32_t color);
+static uint32_t readPixel(const uint8_t* buffer);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Control byte flag, which marks a run of changed pixels. */
+static const uint8_t    RUN_CHANGED = 0x80U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+extern size_t FramebufferCodec::encodeFull(uint8_t* buffer, size_t bufferSize, uint8_t slotId, uint16_t width, uint16_t height, const uint32_t* frame, bool isSubscription)
+{
+    size_t size = 0U;
+
+    if ((nullptr != buffer) &&
+        (nullptr != frame) &&
+        (getFullFrameSize(width, height) <= bufferSize))
+    {
+        const size_t    PIXELS  = static_cast<size_t>(width) * static_cast<size_t>(height);
+        size_t          index   = 0U;
+
+        writeHeader(buffer, (true == isSubscription) ? FRAME_FLAG_SUBSCRIPTION : 0U, slotId, width, height);
+        size = HEADER_SIZE;
+
+        for(index = 0U; index < PIXELS; ++index)
+        {
+            writePixel(&buffer[size], frame[index]);
+            size += BYTES_PER_PIXEL;
+        }
+    }
+
+    return size;
+}
+
+extern size_t FramebufferCodec::encodeDelta(uint8_t* buffer, size_t bufferSize, uint8_t slotId, uint16_t width, uint16_t height, const uint32_t* frame, const uint32_t* refFrame)
+{
+    size_t size = 0U;
+
+    if ((nullptr != buffer) &&
+        (nullptr != frame) &&
+        (nullptr != refFrame) &&
+        (HEADER_SIZE <= bufferSize))
+    {
+        const size_t    PIXELS      = static_cast<size_t>(width) * static_cast<size_t>(height);
+        size_t          index       = 0U;
+        size_t          skipped     = 0U;
+        bool            isOverflow  = false;
+
+        writeHeader(buffer, FRAME_FLAG_DELTA | FRAME_FLAG_SUBSCRIPTION, slotId, width, height);
+        size = HEADER_SIZE;
+
+        while((PIXELS > index) && (false == isOverflow))
+        {
+            if (frame[index] == refFrame[index])
+            {
+                ++skipped;
+                ++index;
+            }
+            else
+            {
+                size_t  runLength   = 0U;
+                size_t  runBegin    = index;
+
+                /* Flush the unchanged pixels in front of the changed ones. */
+                while((0U < skipped) && (false == isOverflow))
+                {
+                    size_t count = (MAX_RUN_LENGTH < skipped) ? MAX_RUN_LENGTH : skipped;
+
+                    if (bufferSize <= size)
+                    {
+                        isOverflow = true;
+                    }
+                    else
+                    {
+                        buffer[size] = static_cast<uint8_t>(count - 1U);
+                        ++size;
+                        skipped -= count;
+                    }
+                }
+
+                /* Determine the run of changed pixels. */
+                while((PIXELS > index) &&
+                      (MAX_RUN_LENGTH > runLength) &&
+                      (frame[index] != refFrame[index]))
+                {
+                    ++runLength;
+                    ++index;
+                }
+
+                if ((false == isOverflow) &&
+                    ((size + 1U + (runLength * BYTES_PER_PIXEL)) <= bufferSize))
+                {
+                    buffer[size] = RUN_CHANGED | static_cast<uint8_t>(runLength - 1U);
+                    ++size;
+
+                    for(index = runBegin; index < (runBegin + runLength); ++index)
+                    {
+                        writePixel(&buffer[size], frame[index] ^ refFrame[index]);
+                        size += BYTES_PER_PIXEL;
+                    }
+                }
+                else
+                {
+                    isOverflow = true;
+                }
+            }
+        }
+
+        if (true == isOverflow)
+        {
+            size = 0U;
+        }
+    }
+
+    return size;
+}
+
+extern bool FramebufferCodec::decode(const uint8_t* buffer, size_t bufferSize, uint8_t& slotId, uint16_t width, uint16_t height, uint32_t* frame)
+{
+    bool isSuccessful = false;
+
+    if ((nullptr != buffer) &&
+        (nullptr != frame) &&
+        (HEADER_SIZE <= bufferSize) &&
+        (0U == (buffer[0] & ~(FRAME_FLAG_DELTA | FRAME_FLAG_SUBSCRIPTION))) &&
+        (width == static_cast<uint16_t>(buffer[2] | (buffer[3] << 8U))) &&
+        (height == static_cast<uint16_t>(buffer[4] | (buffer[5] << 8U))))
+    {
+        const size_t    PIXELS  = static_cast<size_t>(width) * static_cast<size_t>(height);
+        size_t          pos     = HEADER_SIZE;
+        size_t          index   = 0U;
+
+        if (0U == (buffer[0] & FRAME_FLAG_DELTA))
+        {
+            if (getFullFrameSize(width, height) == bufferSize)
+            {
+                for(index = 0U; index < PIXELS; ++index)
+                {
+                    frame[index] = readPixel(&buffer[pos]);
+                    pos += BYTES_PER_PIXEL;
+                }
+
+                isSuccessful = true;
+            }
+        }
+        else
+        {
+            isSuccessful = true;
+
+            while((bufferSize > pos) && (true == isSuccessful))
+            {
+                uint8_t control = buffer[pos];
+                size_t  count   = static_cast<size_t>(control & (~RUN_CHANGED)) + 1U;
+
+                ++pos;
+
+                if (PIXELS < (index + count))
+                {
+                    isSuccessful = false;
+                }
+                else if (0U == (control & RUN_CHANGED))
+                {
+                    index += count;
+                }
+                else if (bufferSize < (pos + (count * BYTES_PER_PIXEL)))
+                {
+                    isSuccessful = false;
+                }
+                else
+                {
+                    while(0U < count)
+                    {
+                        frame[index] ^= readPixel(&buffer[pos]);
+                        pos += BYTES_PER_PIXEL;
+                        ++index;
+                        --count;
+                    }
+                }
+            }
+        }
+
+        if (true == isSuccessful)
+        {
+            slotId = buffer[1];
+        }
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Write the frame header.
+ *
+ * @param[out] buffer   Destination buffer with at least HEADER_SIZE bytes
+ * @param[in] flags     Frame flags
+ * @param[in] slotId    Slot id
+ * @param[in] width     Framebuffer width in pixel
+ * @param[in] height    Framebuffer height in pixel
+ */
+static void writeHeader(uint8_t* buffer, uint8_t flags, uint8_t slotId, uint16_t width, uint16_t height)
+{
+    buffer[0] = flags;
+    buffer[1] = slotId;
+    buffer[2] = static_cast<uint8_t>((width >> 0U) & 0xffU);
+    buffer[3] = static_cast<uint8_t>((width >> 8U) & 0xffU);
+    buffer[4] = static_cast<uint8_t>((height >> 0U) & 0xffU);
+    buffer[5] = static_cast<uint8_t>((height >> 8U) & 0xffU);
+}
+
+/**
+ * Write a single pixel in RGB order.
+ *
+ * @param[out] buffer   Destination buffer with at least BYTES_PER_PIXEL bytes
+ * @param[in] color     Color in RGB24 format
+ */
+static void writePixel(uint8_t* buffer, uint32_t color)
+{
+    buffer[0] = static_cast<uint8_t>((color >> 16U) & 0xffU);
+    buffer[1] = static_cast<uint8_t>((color >> 8U) & 0xffU);
+    buffer[2] = static_cast<uint8_t>((color >> 0U) & 0xffU);
+}
+
+/**
+ * Read a single pixel in RGB order.
+ *
+ * @param[in] buffer    Source buffer with at least BYTES_PER_PIXEL bytes
+ *
+ * @return Color in RGB24 format
+ */
+static uint32_t readPixel(const uint8_t* buffer)
+{
+    return (static_cast<uint32_t>(buffer[0]) << 16U) |
+           (static_cast<uint32_t>(buffer[1]) << 8U) |
+           (static_cast<uint32_t>(buffer[2]) << 0U);
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary framebuffer codec
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __FRAMEBUFFER_CODEC_H__
+#define __FRAMEBUFFER_CODEC_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Binary framebuffer codec, used to transfer the display content.
+ *
+ * Every frame starts with a header:
+ * - Byte 0: Frame flags
+ *   - Bit 0 (FRAME_FLAG_DELTA): Set for a delta frame, cleared for a full frame.
+ *   - Bit 1 (FRAME_FLAG_SUBSCRIPTION): Set for a frame which is pushed to a
+ *     subscriber, cleared for the response to a single request.
+ *   - All other bits are reserved and cleared.
+ * - Byte 1: Slot id
+ * - Byte 2-3: Width in pixel (little endian)
+ * - Byte 4-5: Height in pixel (little endian)
+ *
+ * A full frame contains every pixel as RGB (3 bytes), starting with the
+ * row y = 0 and from x = 0 to N. Then the next row and etc.
+ *
+ * A delta frame contains the pixels, which changed in comparison to a
+ * reference frame, which is the last frame pushed to the subscriber.
+ * It is a sequence of runs, each starting with a control byte:
+ * - Bit 7 cleared: The next (control + 1) pixels are unchanged.
+ * - Bit 7 set: The next ((control & 0x7f) + 1) pixels follow, each as
+ *   RGB (3 bytes), XOR'ed with the reference pixel.
+ * Unchanged pixels at the end of the frame are not encoded.
+ */
+namespace FramebufferCodec
+{
+
+/** Frame flag: Delta frame, otherwise full frame */
+static const uint8_t    FRAME_FLAG_DELTA        = 0x01U;
+
+/** Frame flag: Frame of a subscription, otherwise the response to a single request */
+static const uint8_t    FRAME_FLAG_SUBSCRIPTION = 0x02U;
+
+/** Frame header size in bytes */
+static const size_t     HEADER_SIZE             = 6U;
+
+/** Number of bytes per encoded pixel */
+static const size_t     BYTES_PER_PIXEL         = 3U;
+
+/** Max. number of pixels in a single run. */
+static const uint16_t   MAX_RUN_LENGTH          = 128U;
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * Get the size of a full frame in bytes.
+ * A delta frame, which is not smaller, shall be replaced by a full frame.
+ *
+ * @param[in] width     Framebuffer width in pixel
+ * @param[in] height    Framebuffer height in pixel
+ *
+ * @return Full frame size in bytes
+ */
+inline size_t getFullFrameSize(uint16_t width, uint16_t height)
+{
+    return HEADER_SIZE + (static_cast<size_t>(width) * static_cast<size_t>(height) * BYTES_PER_PIXEL);
+}
+
+/**
+ * Encode a full frame.
+ *
+ * @param[out] buffer           Destination buffer
+ * @param[in] bufferSize        Destination buffer size in bytes
+ * @param[in] slotId            Slot id
+ * @param[in] width             Framebuffer width in pixel
+ * @param[in] height            Framebuffer height in pixel
+ * @param[in] frame             Framebuffer with width * height pixels in RGB24 format
+ * @param[in] isSubscription    Is the frame pushed to a subscriber?
+ *
+ * @return Frame size in bytes. If the buffer is too small, it will return 0.
+ */
+extern size_t encodeFull(uint8_t* buffer, size_t bufferSize, uint8_t slotId, uint16_t width, uint16_t height, const uint32_t* frame, bool isSubscription);
+
+/**
+ * Encode a delta frame, which contains only the changes in comparison to
+ * the reference frame. A delta frame is always pushed to a subscriber.
+ *
+ * @param[out] buffer       Destination buffer
+ * @param[in] bufferSize    Destination buffer size in bytes
+ * @param[in] slotId        Slot id
+ * @param[in] width         Framebuffer width in pixel
+ * @param[in] height        Framebuffer height in pixel
+ * @param[in] frame         Framebuffer with width * height pixels in RGB24 format
+ * @param[in] refFrame      Reference framebuffer with width * height pixels in RGB24 format
+ *
+ * @return Frame size in bytes. If nothing changed, only the header will be
+ *  encoded. If the buffer is too small, it will return 0.
+ */
+extern size_t encodeDelta(uint8_t* buffer, size_t bufferSize, uint8_t slotId, uint16_t width, uint16_t height, const uint32_t* frame, const uint32_t* refFrame);
+
+/**
+ * Decode a full or delta frame. A delta frame is applied to the given
+ * framebuffer, which shall contain the reference frame. Frames with
+ * reserved flags are rejected.
+ *
+ * @param[in] buffer        Encoded frame
+ * @param[in] bufferSize    Encoded frame size in bytes
+ * @param[out] slotId       Slot id
+ * @param[in] width         Framebuffer width in pixel
+ * @param[in] height        Framebuffer height in pixel
+ * @param[inout] frame      Framebuffer with width * height pixels in RGB24 format
+ *
+ * @return If successful decoded, it will return true otherwise false.
+ */
+extern bool decode(const uint8_t* buffer, size_t bufferSize, uint8_t& slotId, uint16_t width, uint16_t height, uint32_t* frame);
+
+}
+
+#endif  /* __FRAMEBUFFER_CODEC_H__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,516 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP response header parser
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "HttpRspParser.h"
+
+#include <string.h>
+#include <strings.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/* Only the header fields, which are evaluated by the HTTP client. */
+const char* HttpRspParser::NEEDED_HEADERS[] =
+{
+    "Connection",
+    "Content-Length",
+    "Content-Type",
+    "ETag",
+    "Last-Modified",
+    "Transfer-Encoding"
+};
+
+const uint8_t HttpRspParser::NEEDED_HEADERS_NUM     = sizeof(NEEDED_HEADERS) / sizeof(NEEDED_HEADERS[0]);
+
+/* Length of "Transfer-Encoding". */
+const uint8_t HttpRspParser::NEEDED_HEADER_MAX_LEN  = 17U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+void HttpRspParser::reset()
+{
+    m_buffer[0]         = '\0';
+    m_length            = 0U;
+    m_state             = STATE_VERSION;
+    m_statusCode        = 0U;
+    m_statusCodeDigits  = 0U;
+    m_reason            = 0U;
+    m_headerCount       = 0U;
+    m_valueEnd          = 0U;
+    m_isLastSkipped     = false;
+
+    return;
+}
+
+HttpRspParser::Result HttpRspParser::parse(const char* data, size_t len, size_t& index)
+{
+    Result result = RESULT_PENDING;
+
+    if (nullptr == data)
+    {
+        m_state = STATE_ERROR;
+    }
+
+    while((len > index) &&
+          (STATE_COMPLETE != m_state) &&
+          (STATE_ERROR != m_state))
+    {
+        char c = data[index];
+
+        ++index;
+
+        /* RFC7230 - 3.5. Message Parsing Robustness
+         * A recipient MAY recognize a single LF as a line terminator
+         * and ignore any preceding CR.
+         */
+        if ('\r' == c)
+        {
+            /* Nothing to do. */
+            ;
+        }
+        /* A string terminator would truncate the stored strings. */
+        else if ('\0' == c)
+        {
+            m_state = STATE_ERROR;
+        }
+        else if (STATE_LINE_START > m_state)
+        {
+            parseStatusLine(c);
+        }
+        else
+        {
+            parseHeaderLine(c);
+        }
+    }
+
+    if (STATE_COMPLETE == m_state)
+    {
+        result = RESULT_COMPLETE;
+    }
+    else if (STATE_ERROR == m_state)
+    {
+        result = RESULT_ERROR;
+    }
+    else
+    {
+        result = RESULT_PENDING;
+    }
+
+    return result;
+}
+
+const char* HttpRspParser::getHeaderName(uint8_t idx) const
+{
+    const char* name = nullptr;
+
+    if (m_headerCount > idx)
+    {
+        name = &m_buffer[m_headers[idx].name];
+    }
+
+    return name;
+}
+
+const char* HttpRspParser::getHeaderValue(uint8_t idx) const
+{
+    const char* value = nullptr;
+
+    if (m_headerCount > idx)
+    {
+        value = &m_buffer[m_headers[idx].value];
+    }
+
+    return value;
+}
+
+const char* HttpRspParser::getHeader(const char* name) const
+{
+    const char* value   = nullptr;
+    uint8_t     idx     = 0U;
+
+    if (nullptr != name)
+    {
+        for(idx = 0U; (idx < m_headerCount) && (nullptr == value); ++idx)
+        {
+            if (0 == strcasecmp(&m_buffer[m_headers[idx].name], name))
+            {
+                value = &m_buffer[m_headers[idx].value];
+            }
+        }
+    }
+
+    return value;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+void HttpRspParser::parseStatusLine(char c)
+{
+    /* Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF */
+    switch(m_state)
+    {
+    case STATE_VERSION:
+        if (' ' == c)
+        {
+            const char      VERSION_PREFIX[]    = "HTTP/";
+            const size_t    VERSION_PREFIX_LEN  = sizeof(VERSION_PREFIX) - 1U;
+
+            append('\0');
+
+            if ((STATE_ERROR != m_state) &&
+                (0 != strncmp(m_buffer, VERSION_PREFIX, VERSION_PREFIX_LEN)))
+            {
+                m_state = STATE_ERROR;
+            }
+            else if (STATE_ERROR != m_state)
+            {
+                m_state = STATE_STATUS_CODE;
+            }
+        }
+        else if ('\n' == c)
+        {
+            m_state = STATE_ERROR;
+        }
+        else
+        {
+            append(c);
+        }
+        break;
+
+    case STATE_STATUS_CODE:
+        if (('0' <= c) && ('9' >= c) && (STATUS_CODE_DIGITS > m_statusCodeDigits))
+        {
+            m_statusCode = (m_statusCode * 10U) + static_cast<uint16_t>(c - '0');
+            ++m_statusCodeDigits;
+        }
+        /* Overstep all spaces before the status code. */
+        else if ((' ' == c) && (0U == m_statusCodeDigits))
+        {
+            /* Nothing to do. */
+            ;
+        }
+        else if (STATUS_CODE_DIGITS != m_statusCodeDigits)
+        {
+            m_state = STATE_ERROR;
+        }
+        else if (' ' == c)
+        {
+            m_reason    = m_length;
+            m_state     = STATE_REASON;
+        }
+        /* The reason phrase may be missing. */
+        else if ('\n' == c)
+        {
+            m_reason = m_length;
+            append('\0');
+
+            if (STATE_ERROR != m_state)
+            {
+                m_state = STATE_LINE_START;
+            }
+        }
+        else
+        {
+            m_state = STATE_ERROR;
+        }
+        break;
+
+    case STATE_REASON:
+        if ('\n' == c)
+        {
+            append('\0');
+
+            if (STATE_ERROR != m_state)
+            {
+                m_state = STATE_LINE_START;
+            }
+        }
+        /* Overstep all spaces before the reason phrase. */
+        else if ((' ' == c) && (m_reason == m_length))
+        {
+            /* Nothing to do. */
+            ;
+        }
+        else
+        {
+            append(c);
+        }
+        break;
+
+    default:
+        m_state = STATE_ERROR;
+        break;
+    }
+
+    return;
+}
+
+void HttpRspParser::parseHeaderLine(char c)
+{
+    /* header-field = field-name ":" OWS field-value OWS */
+    switch(m_state)
+    {
+    case STATE_LINE_START:
+        /* Empty line, the header is complete. */
+        if ('\n' == c)
+        {
+            m_state = STATE_COMPLETE;
+        }
+        /* RFC7230 - 3.2.4. Field Parsing
+         * A user agent that receives an obs-fold in a response message [...]
+         * MUST replace each received obs-fold with one or more SP octets
+         * prior to interpreting the field value.
+         */
+        else if (true == isWhitespace(c))
+        {
+            if (true == m_isLastSkipped)
+            {
+                m_state = STATE_SKIP;
+            }
+            else if (0U == m_headerCount)
+            {
+                m_state = STATE_ERROR;
+            }
+            else
+            {
+                /* Continue the value of the last header field, which is the last string in the buffer. */
+                --m_headerCount;
+                --m_length;
+                m_valueEnd  = m_length;
+                m_state     = STATE_FOLD;
+            }
+        }
+        /* No space left for further header fields. */
+        else if (MAX_HEADERS <= m_headerCount)
+        {
+            m_isLastSkipped = true;
+            m_state         = STATE_SKIP;
+        }
+        else
+        {
+            m_headers[m_headerCount].name = m_length;
+            append(c);
+
+            if (STATE_ERROR != m_state)
+            {
+                m_state = STATE_NAME;
+            }
+        }
+        break;
+
+    case STATE_NAME:
+        if (':' == c)
+        {
+            append('\0');
+
+            if (STATE_ERROR == m_state)
+            {
+                /* Nothing to do. */
+                ;
+            }
+            else if (false == isNeededHeader(&m_buffer[m_headers[m_headerCount].name]))
+            {
+                skipHeader();
+            }
+            else
+            {
+                m_isLastSkipped = false;
+                m_state         = STATE_VALUE_START;
+            }
+        }
+        /* No whitespace is allowed in the name or between name and colon. */
+        else if (('\n' == c) || (true == isWhitespace(c)))
+        {
+            m_state = STATE_ERROR;
+        }
+        /* A name longer than all needed ones must not occupy the buffer. */
+        else if (NEEDED_HEADER_MAX_LEN <= (m_length - m_headers[m_headerCount].name))
+        {
+            skipHeader();
+        }
+        else
+        {
+            append(c);
+        }
+        break;
+
+    case STATE_VALUE_START:
+        if (true == isWhitespace(c))
+        {
+            /* Nothing to do. */
+            ;
+        }
+        else
+        {
+            m_headers[m_headerCount].value  = m_length;
+            m_valueEnd                      = m_length;
+            m_state                         = STATE_VALUE;
+
+            parseHeaderLine(c);
+        }
+        break;
+
+    case STATE_VALUE:
+        if ('\n' == c)
+        {
+            /* Remove trailing whitespace. */
+            m_length = m_valueEnd;
+            append('\0');
+
+            if (STATE_ERROR != m_state)
+            {
+                ++m_headerCount;
+                m_state = STATE_LINE_START;
+            }
+        }
+        else
+        {
+            append(c);
+
+            if (false == isWhitespace(c))
+            {
+                m_valueEnd = m_length;
+            }
+        }
+        break;
+
+    case STATE_FOLD:
+        if (true == isWhitespace(c))
+        {
+            /* Nothing to do. */
+            ;
+        }
+        else
+        {
+            /* Separate the folded parts by a single space. */
+            if ((m_headers[m_headerCount].value < m_length) &&
+                ('\n' != c))
+            {
+                append(' ');
+            }
+
+            if (STATE_ERROR != m_state)
+            {
+                m_state = STATE_VALUE;
+                parseHeaderLine(c);
+            }
+        }
+        break;
+
+    case STATE_SKIP:
+        if ('\n' == c)
+        {
+            m_state = STATE_LINE_START;
+        }
+        break;
+
+    default:
+        m_state = STATE_ERROR;
+        break;
+    }
+
+    return;
+}
+
+void HttpRspParser::skipHeader()
+{
+    /* Release the buffer space of the name. */
+    m_length        = m_headers[m_headerCount].name;
+    m_isLastSkipped = true;
+    m_state         = STATE_SKIP;
+
+    return;
+}
+
+bool HttpRspParser::isNeededHeader(const char* name)
+{
+    bool    isNeeded    = false;
+    uint8_t idx         = 0U;
+
+    for(idx = 0U; (idx < NEEDED_HEADERS_NUM) && (false == isNeeded); ++idx)
+    {
+        if (0 == strcasecmp(NEEDED_HEADERS[idx], name))
+        {
+            isNeeded = true;
+        }
+    }
+
+    return isNeeded;
+}
+
+void HttpRspParser::append(char c)
+{
+    if (BUFFER_SIZE <= m_length)
+    {
+        m_state = STATE_ERROR;
+    }
+    else
+    {
+        m_buffer[m_length] = c;
+        ++m_length;
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
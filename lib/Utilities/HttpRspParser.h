@@ -0,0 +1,309 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP response header parser
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __HTTP_RSP_PARSER_H__
+#define __HTTP_RSP_PARSER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * HTTP response header parser, which parses the status line and the header
+ * fields (RFC7230) byte by byte with a state machine. The received data can
+ * be fed in arbitrary parts, e.g. as received TCP segments.
+ *
+ * Nothing is allocated: all strings are stored zero terminated in one fixed
+ * size buffer and the header fields are stored as offsets into it.
+ *
+ * Only the header fields the HTTP client evaluates are stored, see
+ * NEEDED_HEADERS. All other header fields are skipped, because servers like
+ * GitHub send many of them, which would exceed the buffer otherwise.
+ *
+ * Line terminators may be CRLF or a single LF. Obsolete line folding is
+ * replaced by a single space. Leading and trailing whitespace of a field
+ * value is removed.
+ */
+class HttpRspParser
+{
+public:
+
+    /**
+     * Parse results
+     */
+    enum Result
+    {
+        RESULT_PENDING = 0, /**< More data is necessary. */
+        RESULT_COMPLETE,    /**< Status line and header fields are complete. */
+        RESULT_ERROR        /**< Invalid header or not enough space. */
+    };
+
+    /** Buffer size in byte for the status line and all stored header fields. */
+    static const uint16_t   BUFFER_SIZE = 1024U;
+
+    /** Max. number of stored header fields. Further header fields are skipped. */
+    static const uint8_t    MAX_HEADERS = 8U;
+
+    /**
+     * Constructs a parser.
+     */
+    HttpRspParser()
+    {
+        reset();
+    }
+
+    /**
+     * Destroys the parser.
+     */
+    ~HttpRspParser()
+    {
+    }
+
+    /**
+     * Reset the parser for the next response.
+     */
+    void reset();
+
+    /**
+     * Parse the received data until the header is complete. The data after
+     * the header, e.g. the body, is not consumed.
+     *
+     * @param[in]       data    Received data
+     * @param[in]       len     Received data size in byte
+     * @param[in,out]   index   Current data index
+     *
+     * @return Parse result
+     */
+    Result parse(const char* data, size_t len, size_t& index);
+
+    /**
+     * Is the header complete?
+     *
+     * @return If complete, it will return true otherwise false.
+     */
+    bool isComplete() const
+    {
+        return (STATE_COMPLETE == m_state);
+    }
+
+    /**
+     * Get HTTP version, e.g. "HTTP/1.1".
+     *
+     * @return HTTP version
+     */
+    const char* getHttpVersion() const
+    {
+        return &m_buffer[0];
+    }
+
+    /**
+     * Get status code.
+     *
+     * @return Status code
+     */
+    uint16_t getStatusCode() const
+    {
+        return m_statusCode;
+    }
+
+    /**
+     * Get reason phrase.
+     *
+     * @return Reason phrase
+     */
+    const char* getReasonPhrase() const
+    {
+        return &m_buffer[m_reason];
+    }
+
+    /**
+     * Get number of stored header fields.
+     *
+     * @return Number of stored header fields
+     */
+    uint8_t getHeaderCount() const
+    {
+        return m_headerCount;
+    }
+
+    /**
+     * Get header field name.
+     *
+     * @param[in] idx   Header field index
+     *
+     * @return Header field name or nullptr if index is invalid.
+     */
+    const char* getHeaderName(uint8_t idx) const;
+
+    /**
+     * Get header field value.
+     *
+     * @param[in] idx   Header field index
+     *
+     * @return Header field value or nullptr if index is invalid.
+     */
+    const char* getHeaderValue(uint8_t idx) const;
+
+    /**
+     * Get the value of the first header field with the given name.
+     * The name is case-insensitive.
+     *
+     * @param[in] name  Header field name
+     *
+     * @return Header field value or nullptr if not found.
+     */
+    const char* getHeader(const char* name) const;
+
+private:
+
+    /**
+     * Parser states
+     */
+    enum State
+    {
+        STATE_VERSION = 0,  /**< HTTP version */
+        STATE_STATUS_CODE,  /**< Status code */
+        STATE_REASON,       /**< Reason phrase */
+        STATE_LINE_START,   /**< Begin of a header line or the empty line */
+        STATE_NAME,         /**< Header field name */
+        STATE_VALUE_START,  /**< Whitespace before the header field value */
+        STATE_VALUE,        /**< Header field value */
+        STATE_FOLD,         /**< Whitespace of a obsolete line folding */
+        STATE_SKIP,         /**< Rest of a skipped header line */
+        STATE_COMPLETE,     /**< Header is complete. */
+        STATE_ERROR         /**< Parse error */
+    };
+
+    /**
+     * A header field, stored as offsets into the buffer.
+     */
+    struct Header
+    {
+        uint16_t    name;   /**< Name offset */
+        uint16_t    value;  /**< Value offset */
+    };
+
+    /** Number of digits of the status code. */
+    static const uint8_t    STATUS_CODE_DIGITS  = 3U;
+
+    /** Names of the header fields, which are stored. All others are skipped. */
+    static const char*      NEEDED_HEADERS[];
+
+    /** Number of needed header field names. */
+    static const uint8_t    NEEDED_HEADERS_NUM;
+
+    /** Max. length of a needed header field name, longer names are skipped early. */
+    static const uint8_t    NEEDED_HEADER_MAX_LEN;
+
+    char        m_buffer[BUFFER_SIZE];      /**< Zero terminated strings of the header. */
+    uint16_t    m_length;                   /**< Used buffer size in byte */
+    State       m_state;                    /**< Parser state */
+    uint16_t    m_statusCode;               /**< Status code */
+    uint8_t     m_statusCodeDigits;         /**< Number of parsed status code digits */
+    uint16_t    m_reason;                   /**< Reason phrase offset */
+    Header      m_headers[MAX_HEADERS];     /**< Header fields */
+    uint8_t     m_headerCount;              /**< Number of complete header fields */
+    uint16_t    m_valueEnd;                 /**< Offset after the last non-whitespace character of the current value */
+    bool        m_isLastSkipped;            /**< Is the last header field skipped? Its folded lines are skipped too. */
+
+    /**
+     * Parse a single character of the status line.
+     *
+     * @param[in] c Character
+     */
+    void parseStatusLine(char c);
+
+    /**
+     * Parse a single character of a header line.
+     *
+     * @param[in] c Character
+     */
+    void parseHeaderLine(char c);
+
+    /**
+     * Skip the current header field, whose name is the last string in the buffer.
+     */
+    void skipHeader();
+
+    /**
+     * Is the header field with the given name needed?
+     *
+     * @param[in] name  Header field name
+     *
+     * @return If needed, it will return true otherwise false.
+     */
+    static bool isNeededHeader(const char* name);
+
+    /**
+     * Append a character to the buffer. If the buffer is full,
+     * the parser will fail.
+     *
+     * @param[in] c Character
+     */
+    void append(char c);
+
+    /**
+     * Is the character a whitespace (SP or HTAB)?
+     *
+     * @param[in] c Character
+     *
+     * @return If whitespace, it will return true otherwise false.
+     */
+    static bool isWhitespace(char c)
+    {
+        return (' ' == c) || ('\t' == c);
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HTTP_RSP_PARSER_H__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,421 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Game of life grid
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "LifeGrid.h"
+
+#include <string.h>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static inline void addThree(uint32_t a, uint32_t b, uint32_t c, uint32_t& sum, uint32_t& carry);
+static inline void addTwo(uint32_t a, uint32_t b, uint32_t& sum, uint32_t& carry);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** FNV-1a offset basis (32 bit) */
+static const uint32_t FNV_OFFSET_BASIS    = 2166136261U;
+
+/** FNV-1a prime (32 bit) */
+static const uint32_t FNV_PRIME           = 16777619U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+bool LifeGrid::create(uint16_t width, uint16_t height)
+{
+    bool status = false;
+
+    destroy();
+
+    if ((0U < width) &&
+        (0U < height))
+    {
+        uint32_t    wordsPerRow = (width + BITS - 1U) / BITS;
+        uint32_t    gridSize    = wordsPerRow * height;
+        uint8_t     lastBits    = width % BITS;
+
+        m_cells     = new(std::nothrow) uint32_t[gridSize];
+        m_prevCells = new(std::nothrow) uint32_t[gridSize];
+
+        if ((nullptr == m_cells) ||
+            (nullptr == m_prevCells))
+        {
+            destroy();
+        }
+        else
+        {
+            m_width         = width;
+            m_height        = height;
+            m_wordsPerRow   = wordsPerRow;
+            m_lastWordMask  = (0U == lastBits) ? UINT32_MAX : ((1U << lastBits) - 1U);
+
+            clear();
+
+            status = true;
+        }
+    }
+
+    return status;
+}
+
+void LifeGrid::destroy()
+{
+    if (nullptr != m_cells)
+    {
+        delete[] m_cells;
+        m_cells = nullptr;
+    }
+
+    if (nullptr != m_prevCells)
+    {
+        delete[] m_prevCells;
+        m_prevCells = nullptr;
+    }
+
+    m_width         = 0U;
+    m_height        = 0U;
+    m_wordsPerRow   = 0U;
+    m_lastWordMask  = 0U;
+    m_hashCount     = 0U;
+    m_hashIndex     = 0U;
+    m_period        = 0U;
+
+    return;
+}
+
+void LifeGrid::clear()
+{
+    if (nullptr != m_cells)
+    {
+        memset(m_cells, 0, m_wordsPerRow * m_height * sizeof(uint32_t));
+        restartCycleDetection();
+    }
+
+    return;
+}
+
+void LifeGrid::setWord(uint16_t y, uint16_t wordIdx, uint32_t cells)
+{
+    if ((nullptr != m_cells) &&
+        (m_height > y) &&
+        (m_wordsPerRow > wordIdx))
+    {
+        uint32_t index = (y * m_wordsPerRow) + wordIdx;
+
+        /* Cells outside the grid width must stay dead. */
+        if ((m_wordsPerRow - 1U) == wordIdx)
+        {
+            cells &= m_lastWordMask;
+        }
+
+        m_cells[index]      = cells;
+        m_prevCells[index]  = cells;
+        m_hashCount         = 0U;
+        m_period            = 0U;
+    }
+
+    return;
+}
+
+uint32_t LifeGrid::getWord(uint16_t y, uint16_t wordIdx) const
+{
+    uint32_t cells = 0U;
+
+    if ((nullptr != m_cells) &&
+        (m_height > y) &&
+        (m_wordsPerRow > wordIdx))
+    {
+        cells = m_cells[(y * m_wordsPerRow) + wordIdx];
+    }
+
+    return cells;
+}
+
+uint32_t LifeGrid::getChangedWord(uint16_t y, uint16_t wordIdx) const
+{
+    uint32_t cells = 0U;
+
+    if ((nullptr != m_cells) &&
+        (m_height > y) &&
+        (m_wordsPerRow > wordIdx))
+    {
+        uint32_t index = (y * m_wordsPerRow) + wordIdx;
+
+        cells = m_cells[index] ^ m_prevCells[index];
+    }
+
+    return cells;
+}
+
+void LifeGrid::setCell(uint16_t x, uint16_t y, bool isAlive)
+{
+    if ((m_width > x) &&
+        (m_height > y))
+    {
+        uint16_t    wordIdx = x / BITS;
+        uint32_t    mask    = 1U << (x % BITS);
+        uint32_t    cells   = getWord(y, wordIdx);
+
+        if (false == isAlive)
+        {
+            cells &= ~mask;
+        }
+        else
+        {
+            cells |= mask;
+        }
+
+        setWord(y, wordIdx, cells);
+    }
+
+    return;
+}
+
+bool LifeGrid::getCell(uint16_t x, uint16_t y) const
+{
+    bool isAlive = false;
+
+    if ((m_width > x) &&
+        (m_height > y))
+    {
+        isAlive = (0U != (getWord(y, x / BITS) & (1U << (x % BITS))));
+    }
+
+    return isAlive;
+}
+
+void LifeGrid::step()
+{
+    if (nullptr != m_cells)
+    {
+        uint32_t*   nextCells   = m_prevCells;
+        uint16_t    y           = 0U;
+        uint32_t    hash        = FNV_OFFSET_BASIS;
+        uint8_t     idx         = 0U;
+        uint32_t    index       = 0U;
+        uint32_t    size        = m_wordsPerRow * m_height;
+
+        /* The previous generation is overwritten by the next one. */
+        for(y = 0U; y < m_height; ++y)
+        {
+            uint16_t    yAbove  = (0U == y) ? (m_height - 1U) : (y - 1U);
+            uint16_t    yBelow  = ((m_height - 1U) == y) ? 0U : (y + 1U);
+
+            stepRow(&m_cells[yAbove * m_wordsPerRow],
+                    &m_cells[y * m_wordsPerRow],
+                    &m_cells[yBelow * m_wordsPerRow],
+                    &nextCells[y * m_wordsPerRow]);
+        }
+
+        m_prevCells = m_cells;
+        m_cells     = nextCells;
+
+        /* FNV-1a hash, applied word by word. */
+        for(index = 0U; index < size; ++index)
+        {
+            hash ^= m_cells[index];
+            hash *= FNV_PRIME;
+        }
+
+        /* Search the newest matching generation, which determines the period. */
+        m_period = 0U;
+        for(idx = 1U; (idx <= m_hashCount) && (0U == m_period); ++idx)
+        {
+            uint8_t hashIdx = (m_hashIndex + HASH_HISTORY - idx) % HASH_HISTORY;
+
+            if (hash == m_hashes[hashIdx])
+            {
+                m_period = idx;
+            }
+        }
+
+        m_hashes[m_hashIndex] = hash;
+        m_hashIndex = (m_hashIndex + 1U) % HASH_HISTORY;
+
+        if (HASH_HISTORY > m_hashCount)
+        {
+            ++m_hashCount;
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+void LifeGrid::restartCycleDetection()
+{
+    memcpy(m_prevCells, m_cells, m_wordsPerRow * m_height * sizeof(uint32_t));
+    m_hashCount = 0U;
+    m_hashIndex = 0U;
+    m_period    = 0U;
+
+    return;
+}
+
+void LifeGrid::stepRow(const uint32_t* above, const uint32_t* row, const uint32_t* below, uint32_t* next) const
+{
+    uint16_t wordIdx = 0U;
+
+    for(wordIdx = 0U; wordIdx < m_wordsPerRow; ++wordIdx)
+    {
+        uint32_t    aboveSum0   = 0U;
+        uint32_t    aboveSum1   = 0U;
+        uint32_t    belowSum0   = 0U;
+        uint32_t    belowSum1   = 0U;
+        uint32_t    rowSum0     = 0U;
+        uint32_t    rowSum1     = 0U;
+        uint32_t    sum0        = 0U;
+        uint32_t    carry0      = 0U;
+        uint32_t    sum1        = 0U;
+        uint32_t    carry1      = 0U;
+        uint32_t    carry2      = 0U;
+        uint32_t    tmp         = 0U;
+        uint32_t    cells       = row[wordIdx];
+
+        /* Bit-sliced adder: Every bit position counts the alive neighbours
+         * of its cell. The count is split into its binary digits, with
+         * weight 1 (sum0), weight 2 (sum1) and weight 4+ (carry1, carry2).
+         */
+        addThree(getWestNeighbours(above, wordIdx), above[wordIdx], getEastNeighbours(above, wordIdx), aboveSum0, aboveSum1);
+        addThree(getWestNeighbours(below, wordIdx), below[wordIdx], getEastNeighbours(below, wordIdx), belowSum0, belowSum1);
+        addTwo(getWestNeighbours(row, wordIdx), getEastNeighbours(row, wordIdx), rowSum0, rowSum1);
+
+        addThree(aboveSum0, belowSum0, rowSum0, sum0, carry0);
+        addThree(aboveSum1, belowSum1, rowSum1, tmp, carry1);
+        addTwo(tmp, carry0, sum1, carry2);
+
+        /* A cell lives in the next generation with exactly 3 neighbours
+         * or if it is alive with exactly 2 neighbours.
+         */
+        next[wordIdx] = sum1 & (sum0 | cells) & ~(carry1 | carry2);
+    }
+
+    /* Cells outside the grid width must stay dead. */
+    next[m_wordsPerRow - 1U] &= m_lastWordMask;
+
+    return;
+}
+
+uint32_t LifeGrid::getWestNeighbours(const uint32_t* row, uint16_t wordIdx) const
+{
+    uint32_t westCell = 0U;
+
+    if (0U < wordIdx)
+    {
+        westCell = row[wordIdx - 1U] >> (BITS - 1U);
+    }
+    /* Wrap around: The west neighbour of the first cell is the last cell in the row. */
+    else
+    {
+        westCell = (row[m_wordsPerRow - 1U] >> ((m_width - 1U) % BITS)) & 1U;
+    }
+
+    return (row[wordIdx] << 1U) | westCell;
+}
+
+uint32_t LifeGrid::getEastNeighbours(const uint32_t* row, uint16_t wordIdx) const
+{
+    uint32_t neighbours = row[wordIdx] >> 1U;
+
+    if ((m_wordsPerRow - 1U) > wordIdx)
+    {
+        neighbours |= row[wordIdx + 1U] << (BITS - 1U);
+    }
+    /* Wrap around: The east neighbour of the last cell is the first cell in the row. */
+    else
+    {
+        neighbours |= (row[0U] & 1U) << ((m_width - 1U) % BITS);
+    }
+
+    return neighbours;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Add three bit vectors bitwise.
+ *
+ * @param[in] a         Summand
+ * @param[in] b         Summand
+ * @param[in] c         Summand
+ * @param[out] sum      Sum bits with weight 1
+ * @param[out] carry    Carry bits with weight 2
+ */
+static inline void addThree(uint32_t a, uint32_t b, uint32_t c, uint32_t& sum, uint32_t& carry)
+{
+    uint32_t halfSum = a ^ b;
+
+    sum     = halfSum ^ c;
+    carry   = (a & b) | (halfSum & c);
+}
+
+/**
+ * Add two bit vectors bitwise.
+ *
+ * @param[in] a         Summand
+ * @param[in] b         Summand
+ * @param[out] sum      Sum bits with weight 1
+ * @param[out] carry    Carry bits with weight 2
+ */
+static inline void addTwo(uint32_t a, uint32_t b, uint32_t& sum, uint32_t& carry)
+{
+    sum     = a ^ b;
+    carry   = a & b;
+}
\ No newline at end of file
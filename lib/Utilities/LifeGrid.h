@@ -0,0 +1,294 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Game of life grid
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __LIFE_GRID_H__
+#define __LIFE_GRID_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Game of life universe with a toroidal grid, which wraps around at its borders.
+ *
+ * The cells are packed row by row, 32 cells per word. A generation is
+ * calculated word parallel with a bit-sliced adder, which counts the alive
+ * neighbours of 32 cells at once. The previous generation is kept, therefore
+ * the cells which changed in the last generation step are available too.
+ *
+ * To detect still lifes and oscillators, every generation is hashed and
+ * compared with the hashes of the last generations.
+ */
+class LifeGrid
+{
+public:
+
+    /** Number of bits (cells) per word. */
+    static const uint8_t    BITS            = 32U;
+
+    /** Number of generation hashes, which are kept for cycle detection. It is the max. detectable period. */
+    static const uint8_t    HASH_HISTORY    = 16U;
+
+    /**
+     * Constructs an empty grid. Create it before use.
+     */
+    LifeGrid() :
+        m_width(0U),
+        m_height(0U),
+        m_wordsPerRow(0U),
+        m_lastWordMask(0U),
+        m_cells(nullptr),
+        m_prevCells(nullptr),
+        m_hashes(),
+        m_hashCount(0U),
+        m_hashIndex(0U),
+        m_period(0U)
+    {
+    }
+
+    /**
+     * Destroys the grid.
+     */
+    ~LifeGrid()
+    {
+        destroy();
+    }
+
+    /**
+     * Create the grid. All cells are dead.
+     * If the grid was already created, it will be destroyed first.
+     *
+     * @param[in] width     Grid width in cells
+     * @param[in] height    Grid height in cells
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool create(uint16_t width, uint16_t height);
+
+    /**
+     * Destroy the grid and release its memory.
+     */
+    void destroy();
+
+    /**
+     * Is the grid created?
+     *
+     * @return If created, it will return true otherwise false.
+     */
+    bool isCreated() const
+    {
+        return (nullptr != m_cells);
+    }
+
+    /**
+     * Get grid width in cells.
+     *
+     * @return Grid width
+     */
+    uint16_t getWidth() const
+    {
+        return m_width;
+    }
+
+    /**
+     * Get grid height in cells.
+     *
+     * @return Grid height
+     */
+    uint16_t getHeight() const
+    {
+        return m_height;
+    }
+
+    /**
+     * Get the number of words per row.
+     *
+     * @return Words per row
+     */
+    uint16_t getWordsPerRow() const
+    {
+        return m_wordsPerRow;
+    }
+
+    /**
+     * Kill all cells.
+     */
+    void clear();
+
+    /**
+     * Set the cells of a word in a row. Bit 0 is the cell with the lowest
+     * x-coordinate. Bits outside the grid width are ignored.
+     * Changing the cells restarts the cycle detection.
+     *
+     * @param[in] y         y-coordinate of the row
+     * @param[in] wordIdx   Word index in the row
+     * @param[in] cells     Cells, one bit per cell
+     */
+    void setWord(uint16_t y, uint16_t wordIdx, uint32_t cells);
+
+    /**
+     * Get the cells of a word in a row. Bit 0 is the cell with the lowest
+     * x-coordinate.
+     *
+     * @param[in] y         y-coordinate of the row
+     * @param[in] wordIdx   Word index in the row
+     *
+     * @return Cells, one bit per cell
+     */
+    uint32_t getWord(uint16_t y, uint16_t wordIdx) const;
+
+    /**
+     * Get the cells of a word in a row, which changed in the last generation
+     * step.
+     *
+     * @param[in] y         y-coordinate of the row
+     * @param[in] wordIdx   Word index in the row
+     *
+     * @return Changed cells, one bit per cell
+     */
+    uint32_t getChangedWord(uint16_t y, uint16_t wordIdx) const;
+
+    /**
+     * Set cell state.
+     * Changing the cell restarts the cycle detection.
+     *
+     * @param[in] x         x-coordinate of cell
+     * @param[in] y         y-coordinate of cell
+     * @param[in] isAlive   Alive (true) or dead (false)
+     */
+    void setCell(uint16_t x, uint16_t y, bool isAlive);
+
+    /**
+     * Get cell state.
+     *
+     * @param[in] x x-coordinate of cell
+     * @param[in] y y-coordinate of cell
+     *
+     * @return Alive (true) or dead (false).
+     */
+    bool getCell(uint16_t x, uint16_t y) const;
+
+    /**
+     * Calculate the next generation.
+     * Afterwards the changed cells and the detected period are available.
+     */
+    void step();
+
+    /**
+     * Get the period of the cycle, the grid is in since the last generation step.
+     * A still life has a period of 1, a blinker a period of 2.
+     *
+     * @return Period in generations. If no cycle is detected, it will return 0.
+     */
+    uint8_t getPeriod() const
+    {
+        return m_period;
+    }
+
+private:
+
+    uint16_t    m_width;                    /**< Grid width in cells */
+    uint16_t    m_height;                   /**< Grid height in cells */
+    uint16_t    m_wordsPerRow;              /**< Number of words per row */
+    uint32_t    m_lastWordMask;             /**< Mask of the valid cells in the last word of a row */
+    uint32_t*   m_cells;                    /**< Cells of the current generation */
+    uint32_t*   m_prevCells;                /**< Cells of the previous generation */
+    uint32_t    m_hashes[HASH_HISTORY];     /**< Hashes of the last generations (ring buffer) */
+    uint8_t     m_hashCount;                /**< Number of valid hashes */
+    uint8_t     m_hashIndex;                /**< Index in the ring buffer, where to store the next hash */
+    uint8_t     m_period;                   /**< Detected period or 0 */
+
+    LifeGrid(const LifeGrid& grid);
+    LifeGrid& operator=(const LifeGrid& grid);
+
+    /**
+     * Restart the cycle detection, e.g. because the cells were changed.
+     * The previous generation is set equal to the current one.
+     */
+    void restartCycleDetection();
+
+    /**
+     * Calculate the next generation of a single row.
+     *
+     * @param[in] above     Row above in the current generation
+     * @param[in] row       Row in the current generation
+     * @param[in] below     Row below in the current generation
+     * @param[out] next     Row in the next generation
+     */
+    void stepRow(const uint32_t* above, const uint32_t* row, const uint32_t* below, uint32_t* next) const;
+
+    /**
+     * Get the cells of a row, shifted by one cell to the east. Every bit
+     * contains the state of its west neighbour, considering the wrap around.
+     *
+     * @param[in] row       Row
+     * @param[in] wordIdx   Word index in the row
+     *
+     * @return Cells of the west neighbours
+     */
+    uint32_t getWestNeighbours(const uint32_t* row, uint16_t wordIdx) const;
+
+    /**
+     * Get the cells of a row, shifted by one cell to the west. Every bit
+     * contains the state of its east neighbour, considering the wrap around.
+     *
+     * @param[in] row       Row
+     * @param[in] wordIdx   Word index in the row
+     *
+     * @return Cells of the east neighbours
+     */
+    uint32_t getEastNeighbours(const uint32_t* row, uint16_t wordIdx) const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __LIFE_GRID_H__ */
+
+/** @} */
\ No newline at end of file
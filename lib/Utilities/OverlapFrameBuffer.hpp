@@ -0,0 +1,217 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Overlapping audio frame buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __OVERLAP_FRAME_BUFFER_HPP__
+#define __OVERLAP_FRAME_BUFFER_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Collects raw audio samples into frames for a spectrum analysis. Two
+ * frames overlap by 50% (Welch method), therefore every sample contributes
+ * to two frames and the hop between two frames is half a frame.
+ *
+ * Two frame buffers are used alternately (ping-pong). As soon as a frame is
+ * complete, its second half is copied to the other buffer, which continues
+ * to collect the samples. The complete frame stays untouched until it is
+ * released, which allows to transform it in place, e.g. by a FFT.
+ *
+ * @tparam frameSize    Number of samples per frame, must be a multiple of 2.
+ */
+template < uint16_t frameSize >
+class OverlapFrameBuffer
+{
+public:
+
+    /** Number of new samples per frame. */
+    static const uint16_t   HOP_SIZE    = frameSize / 2U;
+
+    /**
+     * Constructs the frame buffer.
+     */
+    OverlapFrameBuffer() :
+        m_frames(),
+        m_writeFrame(0U),
+        m_writeIndex(0U),
+        m_isFrameReady(false)
+    {
+        static_assert((0U < frameSize) && (0U == (frameSize % 2U)), "Frame size must be a multiple of 2.");
+    }
+
+    /**
+     * Destroys the frame buffer.
+     */
+    ~OverlapFrameBuffer()
+    {
+    }
+
+    /**
+     * Discard all samples and a not released frame.
+     */
+    void clear()
+    {
+        m_writeFrame    = 0U;
+        m_writeIndex    = 0U;
+        m_isFrameReady  = false;
+    }
+
+    /**
+     * Write raw samples, e.g. a complete DMA block. Every raw sample is
+     * shifted right by the given number of bits and converted to float.
+     *
+     * Writing stops as soon as a frame is complete, except the frame is
+     * already released before. Handle the complete frame and write the
+     * remaining samples afterwards.
+     *
+     * @param[in] raw       Raw samples
+     * @param[in] count     Number of raw samples
+     * @param[in] shift     Number of bits to shift every raw sample to the right
+     *
+     * @return Number of written samples
+     */
+    size_t write(const int32_t* raw, size_t count, uint8_t shift)
+    {
+        size_t written = 0U;
+
+        if (nullptr != raw)
+        {
+            size_t  free    = frameSize - m_writeIndex;
+            float*  dst     = &m_frames[m_writeFrame][m_writeIndex];
+            size_t  idx     = 0U;
+
+            /* If a frame is pending, the buffer can be filled up, but not completed. */
+            if (true == m_isFrameReady)
+            {
+                --free;
+            }
+
+            written = (count < free) ? count : free;
+
+            /* Branch free conversion, which the compiler is able to vectorize. */
+            for(idx = 0U; idx < written; ++idx)
+            {
+                dst[idx] = static_cast<float>(raw[idx] >> shift);
+            }
+
+            m_writeIndex += written;
+
+            if (frameSize <= m_writeIndex)
+            {
+                uint8_t completeFrame = m_writeFrame;
+
+                m_writeFrame    = (m_writeFrame + 1U) % FRAMES;
+                m_isFrameReady  = true;
+
+                /* Overlap: The second half of the complete frame is the first half of the next one. */
+                memcpy(m_frames[m_writeFrame], &m_frames[completeFrame][HOP_SIZE], HOP_SIZE * sizeof(float));
+                m_writeIndex = HOP_SIZE;
+            }
+        }
+
+        return written;
+    }
+
+    /**
+     * Is a complete frame ready?
+     *
+     * @return If a frame is ready, it will return true otherwise false.
+     */
+    bool isFrameReady() const
+    {
+        return m_isFrameReady;
+    }
+
+    /**
+     * Get the complete frame. It may be modified, e.g. by a in place FFT.
+     *
+     * @return Frame with frameSize samples. If no frame is ready, it will return nullptr.
+     */
+    float* getFrame()
+    {
+        float* frame = nullptr;
+
+        if (true == m_isFrameReady)
+        {
+            frame = m_frames[(m_writeFrame + 1U) % FRAMES];
+        }
+
+        return frame;
+    }
+
+    /**
+     * Release the complete frame after it is handled.
+     */
+    void releaseFrame()
+    {
+        m_isFrameReady = false;
+    }
+
+private:
+
+    /** Number of frame buffers (ping-pong) */
+    static const uint8_t    FRAMES  = 2U;
+
+    float   m_frames[FRAMES][frameSize];    /**< Frame buffers */
+    uint8_t m_writeFrame;                   /**< Index of the frame buffer, which collects the samples. */
+    size_t  m_writeIndex;                   /**< Write index in the collecting frame buffer. */
+    bool    m_isFrameReady;                 /**< Is the other frame buffer complete and not released yet? */
+
+    OverlapFrameBuffer(const OverlapFrameBuffer& buffer);
+    OverlapFrameBuffer& operator=(const OverlapFrameBuffer& buffer);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __OVERLAP_FRAME_BUFFER_HPP__ */
+
+/** @} */
\ No newline at end of file
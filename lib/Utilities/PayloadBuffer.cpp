@@ -0,0 +1,185 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Payload buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "PayloadBuffer.h"
+
+#include <string.h>
+#include <stdint.h>
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+PayloadBuffer& PayloadBuffer::operator=(const PayloadBuffer& buffer)
+{
+    if (this != &buffer)
+    {
+        clear();
+
+        if ((0U < buffer.m_size) &&
+            (true == reallocate(buffer.m_size)))
+        {
+            memcpy(m_data, buffer.m_data, buffer.m_size);
+            m_size = buffer.m_size;
+        }
+    }
+
+    return *this;
+}
+
+bool PayloadBuffer::reserve(size_t capacity)
+{
+    bool isSuccessful = true;
+
+    if (m_capacity < capacity)
+    {
+        isSuccessful = reallocate(capacity);
+    }
+
+    return isSuccessful;
+}
+
+bool PayloadBuffer::append(const uint8_t* data, size_t size)
+{
+    bool isSuccessful = true;
+
+    if ((nullptr == data) ||
+        ((SIZE_MAX - m_size) < size))
+    {
+        isSuccessful = false;
+    }
+    else if ((m_capacity - m_size) < size)
+    {
+        size_t needed   = m_size + size;
+        size_t capacity = MIN_CAPACITY;
+
+        if ((SIZE_MAX / 2U) >= m_capacity)
+        {
+            capacity = (MIN_CAPACITY > (2U * m_capacity)) ? MIN_CAPACITY : (2U * m_capacity);
+        }
+
+        if (needed > capacity)
+        {
+            capacity = needed;
+        }
+
+        /* If the doubled capacity is not available, try with the needed one. */
+        isSuccessful = reallocate(capacity);
+
+        if ((false == isSuccessful) &&
+            (needed < capacity))
+        {
+            isSuccessful = reallocate(needed);
+        }
+    }
+
+    if ((true == isSuccessful) &&
+        (0U < size))
+    {
+        memcpy(&m_data[m_size], data, size);
+        m_size += size;
+    }
+
+    return isSuccessful;
+}
+
+void PayloadBuffer::clear()
+{
+    if (nullptr != m_data)
+    {
+        delete[] m_data;
+        m_data = nullptr;
+    }
+
+    m_size      = 0U;
+    m_capacity  = 0U;
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+bool PayloadBuffer::reallocate(size_t capacity)
+{
+    bool        isSuccessful    = false;
+    uint8_t*    data            = new(std::nothrow) uint8_t[capacity];
+
+    if (nullptr != data)
+    {
+        if (nullptr != m_data)
+        {
+            memcpy(data, m_data, m_size);
+            delete[] m_data;
+        }
+
+        m_data          = data;
+        m_capacity      = capacity;
+        isSuccessful    = true;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,189 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Payload buffer
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __PAYLOAD_BUFFER_H__
+#define __PAYLOAD_BUFFER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Payload buffer, which grows geometrically. Appending data in many small
+ * parts, e.g. received TCP segments, needs only a logarithmic number of
+ * reallocations. If the final size is known in advance, e.g. by the
+ * Content-Length, reserve it and no reallocation is necessary at all.
+ *
+ * The data is always kept contiguous.
+ */
+class PayloadBuffer
+{
+public:
+
+    /** Min. capacity in byte, which is allocated by appending data. */
+    static const size_t MIN_CAPACITY    = 256U;
+
+    /**
+     * Constructs an empty payload buffer.
+     */
+    PayloadBuffer() :
+        m_data(nullptr),
+        m_size(0U),
+        m_capacity(0U)
+    {
+    }
+
+    /**
+     * Destroys the payload buffer.
+     */
+    ~PayloadBuffer()
+    {
+        clear();
+    }
+
+    /**
+     * Constructs a payload buffer by copy.
+     *
+     * @param[in] buffer    Payload buffer, which to copy
+     */
+    PayloadBuffer(const PayloadBuffer& buffer) :
+        m_data(nullptr),
+        m_size(0U),
+        m_capacity(0U)
+    {
+        *this = buffer;
+    }
+
+    /**
+     * Assign a payload buffer. Only the used part is copied.
+     *
+     * @param[in] buffer    Payload buffer, which to assign
+     *
+     * @return Payload buffer
+     */
+    PayloadBuffer& operator=(const PayloadBuffer& buffer);
+
+    /**
+     * Reserve capacity for the given total payload size.
+     * A smaller capacity than the current one is ignored.
+     *
+     * @param[in] capacity  Capacity in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool reserve(size_t capacity);
+
+    /**
+     * Append data. If the capacity is not sufficient, it will be doubled
+     * at least.
+     *
+     * @param[in] data  Data
+     * @param[in] size  Data size in byte
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool append(const uint8_t* data, size_t size);
+
+    /**
+     * Release the payload.
+     */
+    void clear();
+
+    /**
+     * Get the payload.
+     *
+     * @return Payload or nullptr if there is none.
+     */
+    const uint8_t* getData() const
+    {
+        return m_data;
+    }
+
+    /**
+     * Get the payload size.
+     *
+     * @return Payload size in byte
+     */
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Get the capacity.
+     *
+     * @return Capacity in byte
+     */
+    size_t getCapacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+
+    uint8_t*    m_data;     /**< Payload */
+    size_t      m_size;     /**< Payload size in byte */
+    size_t      m_capacity; /**< Allocated size in byte */
+
+    /**
+     * Reallocate the payload with the given capacity.
+     *
+     * @param[in] capacity  Capacity in byte, which must not be smaller than the payload size.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool reallocate(size_t capacity);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PAYLOAD_BUFFER_H__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,471 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Prefix tree
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __PREFIX_TREE_HPP__
+#define __PREFIX_TREE_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include <new>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Prefix tree (trie), which maps zero terminated string keys to values.
+ * A key is found in O(key length), independent of the number of keys.
+ *
+ * All nodes are stored in one array, which grows geometrically, and refer
+ * each other by index instead of pointer. A node contains a single character,
+ * its first child and its next sibling. Nodes of removed keys are reused.
+ *
+ * @tparam T    Value type, which must be default constructible and copyable.
+ */
+template < typename T >
+class PrefixTree
+{
+public:
+
+    /**
+     * Constructs a empty prefix tree.
+     */
+    PrefixTree() :
+        m_nodes(nullptr),
+        m_capacity(0U),
+        m_nodeEnd(0U),
+        m_nodeCount(0U),
+        m_freeNodes(NO_NODE),
+        m_count(0U)
+    {
+    }
+
+    /**
+     * Destroys the prefix tree.
+     */
+    ~PrefixTree()
+    {
+        clear();
+    }
+
+    /**
+     * Insert a key with its value. If the key already exists, its value
+     * will be overwritten.
+     *
+     * @param[in] key   Key, must not be empty.
+     * @param[in] value Value
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool insert(const char* key, const T& value)
+    {
+        bool        isSuccessful    = false;
+        uint16_t    node            = ROOT_NODE;
+
+        if ((nullptr != key) &&
+            ('\0' != key[0]) &&
+            ((0U < m_nodeCount) || (ROOT_NODE == allocNode('\0'))))
+        {
+            isSuccessful = true;
+
+            while(('\0' != *key) && (true == isSuccessful))
+            {
+                uint16_t child = findChild(node, *key);
+
+                if (NO_NODE == child)
+                {
+                    child = allocNode(*key);
+
+                    if (NO_NODE == child)
+                    {
+                        isSuccessful = false;
+                    }
+                    else
+                    {
+                        m_nodes[child].sibling  = m_nodes[node].child;
+                        m_nodes[node].child     = child;
+                    }
+                }
+
+                node = child;
+                ++key;
+            }
+
+            if (true == isSuccessful)
+            {
+                if (false == m_nodes[node].hasValue)
+                {
+                    m_nodes[node].hasValue = true;
+                    ++m_count;
+                }
+
+                m_nodes[node].value = value;
+            }
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Remove a key. Nodes, which are not necessary anymore, are released
+     * for reuse.
+     *
+     * @param[in] key   Key
+     *
+     * @return If the key was found and removed, it will return true otherwise false.
+     */
+    bool remove(const char* key)
+    {
+        bool        isRemoved   = false;
+        uint16_t    node        = findNode(key);
+
+        if ((NO_NODE != node) &&
+            (true == m_nodes[node].hasValue))
+        {
+            size_t  len         = strlen(key);
+            bool    isPruned    = true;
+
+            m_nodes[node].hasValue  = false;
+            m_nodes[node].value     = T();
+            --m_count;
+            isRemoved               = true;
+
+            /* Release the nodes from the end of the key upwards, as long as
+             * they have no value and no child.
+             */
+            while((0U < len) && (true == isPruned))
+            {
+                isPruned = pruneLast(key, len);
+                --len;
+            }
+        }
+
+        return isRemoved;
+    }
+
+    /**
+     * Find the value of a key.
+     *
+     * @param[in]   key     Key
+     * @param[out]  value   Value
+     *
+     * @return If found, it will return true otherwise false.
+     */
+    bool find(const char* key, T& value) const
+    {
+        bool        isFound = false;
+        uint16_t    node    = findNode(key);
+
+        if ((NO_NODE != node) &&
+            (true == m_nodes[node].hasValue))
+        {
+            value   = m_nodes[node].value;
+            isFound = true;
+        }
+
+        return isFound;
+    }
+
+    /**
+     * Remove all keys and release the memory.
+     */
+    void clear()
+    {
+        if (nullptr != m_nodes)
+        {
+            delete[] m_nodes;
+            m_nodes = nullptr;
+        }
+
+        m_capacity  = 0U;
+        m_nodeEnd   = 0U;
+        m_nodeCount = 0U;
+        m_freeNodes = NO_NODE;
+        m_count     = 0U;
+    }
+
+    /**
+     * Get number of keys.
+     *
+     * @return Number of keys
+     */
+    uint16_t getCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Get number of used nodes, incl. the root node.
+     *
+     * @return Number of used nodes
+     */
+    uint16_t getNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+private:
+
+    /**
+     * A single node of the tree.
+     */
+    struct Node
+    {
+        char        character;  /**< Character of the key at this level */
+        bool        hasValue;   /**< A key ends in this node. */
+        uint16_t    child;      /**< Index of the first child or NO_NODE */
+        uint16_t    sibling;    /**< Index of the next sibling or NO_NODE */
+        T           value;      /**< Value, valid if hasValue is set. */
+
+        /**
+         * Constructs a empty node.
+         */
+        Node() :
+            character('\0'),
+            hasValue(false),
+            child(NO_NODE),
+            sibling(NO_NODE),
+            value()
+        {
+        }
+    };
+
+    /** Index of the root node. */
+    static const uint16_t   ROOT_NODE       = 0U;
+
+    /** Invalid node index. */
+    static const uint16_t   NO_NODE         = UINT16_MAX;
+
+    /** Min. number of nodes, which are allocated at once. */
+    static const uint16_t   MIN_CAPACITY    = 32U;
+
+    Node*       m_nodes;        /**< Node array */
+    uint16_t    m_capacity;     /**< Number of nodes in the array */
+    uint16_t    m_nodeEnd;      /**< Number of nodes in the array, which were used at least once */
+    uint16_t    m_nodeCount;    /**< Number of used nodes */
+    uint16_t    m_freeNodes;    /**< First released node, chained by sibling */
+    uint16_t    m_count;        /**< Number of keys */
+
+    PrefixTree(const PrefixTree& tree);
+    PrefixTree& operator=(const PrefixTree& tree);
+
+    /**
+     * Find the child of a node with the given character.
+     *
+     * @param[in] node      Parent node index
+     * @param[in] character Character
+     *
+     * @return Child node index or NO_NODE
+     */
+    uint16_t findChild(uint16_t node, char character) const
+    {
+        uint16_t child = m_nodes[node].child;
+
+        while((NO_NODE != child) && (character != m_nodes[child].character))
+        {
+            child = m_nodes[child].sibling;
+        }
+
+        return child;
+    }
+
+    /**
+     * Find the node, where the key ends.
+     *
+     * @param[in] key   Key
+     *
+     * @return Node index or NO_NODE
+     */
+    uint16_t findNode(const char* key) const
+    {
+        uint16_t node = NO_NODE;
+
+        if ((nullptr != key) &&
+            ('\0' != key[0]) &&
+            (0U < m_nodeCount))
+        {
+            node = ROOT_NODE;
+
+            while(('\0' != *key) && (NO_NODE != node))
+            {
+                node = findChild(node, *key);
+                ++key;
+            }
+        }
+
+        return node;
+    }
+
+    /**
+     * Allocate a node. A released node is reused, otherwise the node array
+     * grows if necessary.
+     *
+     * @param[in] character Character of the node
+     *
+     * @return Node index or NO_NODE, if no memory is available.
+     */
+    uint16_t allocNode(char character)
+    {
+        uint16_t node = NO_NODE;
+
+        if (NO_NODE != m_freeNodes)
+        {
+            node        = m_freeNodes;
+            m_freeNodes = m_nodes[node].sibling;
+        }
+        else if ((m_capacity > m_nodeEnd) || (true == grow()))
+        {
+            node = m_nodeEnd;
+            ++m_nodeEnd;
+        }
+
+        if (NO_NODE != node)
+        {
+            m_nodes[node]           = Node();
+            m_nodes[node].character = character;
+            ++m_nodeCount;
+        }
+
+        return node;
+    }
+
+    /**
+     * Double the capacity of the node array.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool grow()
+    {
+        bool        isSuccessful    = false;
+        uint32_t    capacity        = (0U == m_capacity) ? MIN_CAPACITY : (2U * static_cast<uint32_t>(m_capacity));
+        Node*       nodes           = nullptr;
+
+        /* The last index is reserved for NO_NODE. */
+        if (NO_NODE < capacity)
+        {
+            capacity = NO_NODE;
+        }
+
+        if (m_capacity < capacity)
+        {
+            nodes = new(std::nothrow) Node[capacity];
+        }
+
+        if (nullptr != nodes)
+        {
+            uint16_t idx = 0U;
+
+            for(idx = 0U; idx < m_nodeEnd; ++idx)
+            {
+                nodes[idx] = m_nodes[idx];
+            }
+
+            delete[] m_nodes;
+            m_nodes         = nodes;
+            m_capacity      = static_cast<uint16_t>(capacity);
+            isSuccessful    = true;
+        }
+
+        return isSuccessful;
+    }
+
+    /**
+     * Release the last node of the key part, if it has no value and no child.
+     *
+     * @param[in] key   Key
+     * @param[in] len   Length of the key part
+     *
+     * @return If the node was released, it will return true otherwise false.
+     */
+    bool pruneLast(const char* key, size_t len)
+    {
+        bool        isPruned    = false;
+        uint16_t    parent      = ROOT_NODE;
+        uint16_t    node        = ROOT_NODE;
+        size_t      idx         = 0U;
+
+        for(idx = 0U; idx < len; ++idx)
+        {
+            parent  = node;
+            node    = findChild(parent, key[idx]);
+        }
+
+        if ((false == m_nodes[node].hasValue) &&
+            (NO_NODE == m_nodes[node].child))
+        {
+            /* Unlink it from its parent. */
+            if (node == m_nodes[parent].child)
+            {
+                m_nodes[parent].child = m_nodes[node].sibling;
+            }
+            else
+            {
+                uint16_t prev = m_nodes[parent].child;
+
+                while(node != m_nodes[prev].sibling)
+                {
+                    prev = m_nodes[prev].sibling;
+                }
+
+                m_nodes[prev].sibling = m_nodes[node].sibling;
+            }
+
+            m_nodes[node].sibling   = m_freeNodes;
+            m_freeNodes             = node;
+            --m_nodeCount;
+            isPruned                = true;
+        }
+
+        return isPruned;
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __PREFIX_TREE_HPP__ */
+
+/** @} */
\ No newline at end of file
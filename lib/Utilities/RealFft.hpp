@@ -0,0 +1,281 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Real-valued FFT
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __REAL_FFT_HPP__
+#define __REAL_FFT_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <math.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Real-valued FFT in single precision, which transforms time discrete samples
+ * into their single-sided amplitude spectrum.
+ *
+ * The samples are weighted with a hamming window and packed into a complex
+ * sequence of half length, which is transformed by a radix-2 FFT and
+ * afterwards split into the spectrum of the real samples. The window, the
+ * twiddle factors and the bit reversal permutation are calculated once
+ * during construction, therefore no trigonometric function is called per
+ * transformation.
+ *
+ * @tparam samples  Number of samples, must be a power of 2 and at least 4.
+ */
+template < uint16_t samples >
+class RealFft
+{
+public:
+
+    /** Number of frequency bins, which is always half of the samples. */
+    static const uint16_t   FREQ_BINS   = samples / 2U;
+
+    /** Hamming window amplitude correction factor. */
+    static constexpr const float WINDOW_CORRECTION = 0.54f;
+
+    /**
+     * Constructs the FFT and calculates all tables.
+     */
+    RealFft() :
+        m_window(),
+        m_twiddleRe(),
+        m_twiddleIm(),
+        m_bitReversed()
+    {
+        const float TWO_PI      = 6.283185307179586f;
+        uint16_t    idx         = 0U;
+        uint8_t     log2Size    = 0U;
+
+        static_assert((4U <= samples) && (0U == (samples & (samples - 1U))), "Number of samples must be a power of 2.");
+
+        /* Hamming window, symmetric around the middle. Only the first half is stored. */
+        for(idx = 0U; idx < FREQ_BINS; ++idx)
+        {
+            m_window[idx] = 0.54f - (0.46f * cosf((TWO_PI * idx) / (samples - 1U)));
+        }
+
+        /* Twiddle factors W^k = e^(-2 * pi * i * k / samples) */
+        for(idx = 0U; idx < FREQ_BINS; ++idx)
+        {
+            m_twiddleRe[idx] = cosf((TWO_PI * idx) / samples);
+            m_twiddleIm[idx] = -sinf((TWO_PI * idx) / samples);
+        }
+
+        /* Bit reversal permutation of the complex sequence. */
+        while((1U << log2Size) < FREQ_BINS)
+        {
+            ++log2Size;
+        }
+
+        for(idx = 0U; idx < FREQ_BINS; ++idx)
+        {
+            uint16_t    reversed    = 0U;
+            uint8_t     bit         = 0U;
+
+            for(bit = 0U; bit < log2Size; ++bit)
+            {
+                if (0U != (idx & (1U << bit)))
+                {
+                    reversed |= 1U << (log2Size - 1U - bit);
+                }
+            }
+
+            m_bitReversed[idx] = reversed;
+        }
+    }
+
+    /**
+     * Destroys the FFT.
+     */
+    ~RealFft()
+    {
+    }
+
+    /**
+     * Transform the samples to the single-sided amplitude spectrum.
+     * The amplitudes are corrected by the window and the half spectrum energy,
+     * therefore a sinusoidal signal results in its amplitude.
+     *
+     * @param[in,out] data      Samples, which are used as working buffer and destroyed.
+     * @param[out] amplitudes   Linear amplitude per frequency bin (FREQ_BINS).
+     */
+    void computeAmplitudes(float* data, float* amplitudes) const
+    {
+        /* Bin 0 (DC) contains the whole energy, all others the half of it. */
+        const float DC_SCALE    = 1.0f / (samples * WINDOW_CORRECTION);
+        const float BIN_SCALE   = 2.0f * DC_SCALE;
+        uint16_t    idx         = 0U;
+
+        if ((nullptr == data) ||
+            (nullptr == amplitudes))
+        {
+            return;
+        }
+
+        /* Apply window */
+        for(idx = 0U; idx < FREQ_BINS; ++idx)
+        {
+            data[idx]                   *= m_window[idx];
+            data[samples - 1U - idx]    *= m_window[idx];
+        }
+
+        /* The even samples are the real parts and the odd samples the imaginary
+         * parts of the complex sequence z with half length.
+         */
+        transformComplex(data);
+
+        /* DC: X[0] = Re(z[0]) + Im(z[0]) */
+        amplitudes[0] = fabsf(data[0] + data[1]) * DC_SCALE;
+
+        /* Split the spectrum of z into the spectrum X of the real samples:
+         * X[k]             = E[k] + W^k * O[k]
+         * X[bins - k]      = conj(E[k] - W^k * O[k])
+         * with E[k]        = (z[k] + conj(z[bins - k])) / 2
+         * and O[k]         = (z[k] - conj(z[bins - k])) / 2i
+         */
+        for(idx = 1U; idx <= (FREQ_BINS / 2U); ++idx)
+        {
+            uint16_t    mirrorIdx   = FREQ_BINS - idx;
+            float       zRe         = data[2U * idx];
+            float       zIm         = data[(2U * idx) + 1U];
+            float       zMirrorRe   = data[2U * mirrorIdx];
+            float       zMirrorIm   = data[(2U * mirrorIdx) + 1U];
+            float       evenRe      = 0.5f * (zRe + zMirrorRe);
+            float       evenIm      = 0.5f * (zIm - zMirrorIm);
+            float       oddRe       = 0.5f * (zIm + zMirrorIm);
+            float       oddIm       = -0.5f * (zRe - zMirrorRe);
+            float       prodRe      = (m_twiddleRe[idx] * oddRe) - (m_twiddleIm[idx] * oddIm);
+            float       prodIm      = (m_twiddleRe[idx] * oddIm) + (m_twiddleIm[idx] * oddRe);
+
+            amplitudes[idx]         = magnitude(evenRe + prodRe, evenIm + prodIm) * BIN_SCALE;
+            amplitudes[mirrorIdx]   = magnitude(evenRe - prodRe, evenIm - prodIm) * BIN_SCALE;
+        }
+    }
+
+private:
+
+    float       m_window[FREQ_BINS];        /**< First half of the symmetric window */
+    float       m_twiddleRe[FREQ_BINS];     /**< Twiddle factors, real part */
+    float       m_twiddleIm[FREQ_BINS];     /**< Twiddle factors, imaginary part */
+    uint16_t    m_bitReversed[FREQ_BINS];   /**< Bit reversed index of the complex sequence */
+
+    /**
+     * Calculate the magnitude of a complex number.
+     *
+     * @param[in] re    Real part
+     * @param[in] im    Imaginary part
+     *
+     * @return Magnitude
+     */
+    static float magnitude(float re, float im)
+    {
+        return sqrtf((re * re) + (im * im));
+    }
+
+    /**
+     * In-place radix-2 decimation in time FFT of the complex sequence with
+     * FREQ_BINS elements, stored interleaved (real, imaginary).
+     *
+     * @param[in,out] data  Complex sequence
+     */
+    void transformComplex(float* data) const
+    {
+        uint16_t idx    = 0U;
+        uint16_t len    = 0U;
+
+        for(idx = 0U; idx < FREQ_BINS; ++idx)
+        {
+            uint16_t reversed = m_bitReversed[idx];
+
+            if (idx < reversed)
+            {
+                float tmpRe = data[2U * idx];
+                float tmpIm = data[(2U * idx) + 1U];
+
+                data[2U * idx]              = data[2U * reversed];
+                data[(2U * idx) + 1U]       = data[(2U * reversed) + 1U];
+                data[2U * reversed]         = tmpRe;
+                data[(2U * reversed) + 1U]  = tmpIm;
+            }
+        }
+
+        for(len = 2U; len <= FREQ_BINS; len <<= 1U)
+        {
+            uint16_t    half        = len / 2U;
+            uint16_t    stride      = samples / len;    /* Twiddle index step, because W_len^j = W^(j * samples / len) */
+            uint16_t    start       = 0U;
+
+            for(start = 0U; start < FREQ_BINS; start += len)
+            {
+                uint16_t j = 0U;
+
+                for(j = 0U; j < half; ++j)
+                {
+                    uint16_t    top     = 2U * (start + j);
+                    uint16_t    bottom  = 2U * (start + j + half);
+                    float       wRe     = m_twiddleRe[j * stride];
+                    float       wIm     = m_twiddleIm[j * stride];
+                    float       tRe     = (wRe * data[bottom]) - (wIm * data[bottom + 1U]);
+                    float       tIm     = (wRe * data[bottom + 1U]) + (wIm * data[bottom]);
+
+                    data[bottom]        = data[top] - tRe;
+                    data[bottom + 1U]   = data[top + 1U] - tIm;
+                    data[top]           += tRe;
+                    data[top + 1U]      += tIm;
+                }
+            }
+        }
+    }
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __REAL_FFT_HPP__ */
+
+/** @} */
\ No newline at end of file
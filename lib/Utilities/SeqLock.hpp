@@ -0,0 +1,161 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Lock-free single writer channel
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __SEQ_LOCK_HPP__
+#define __SEQ_LOCK_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <atomic>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Lock-free channel, which passes the latest value from a single writer to
+ * any number of readers (sequence lock).
+ *
+ * The writer never waits. It makes the sequence odd, while it copies the
+ * value and even again afterwards. A reader copies the value and retries,
+ * if the sequence was odd or changed during the copy. Older values are
+ * overwritten, therefore a reader always gets the latest complete value.
+ *
+ * The value is copied with its assignment operator, so it shall be a
+ * plain data type without pointers to other data.
+ *
+ * @tparam T    Value type
+ */
+template < typename T >
+class SeqLock
+{
+public:
+
+    /**
+     * Constructs the channel without a value.
+     */
+    SeqLock() :
+        m_sequence(0U),
+        m_value()
+    {
+    }
+
+    /**
+     * Destroys the channel.
+     */
+    ~SeqLock()
+    {
+    }
+
+    /**
+     * Publish a value. Only a single writer is supported.
+     *
+     * @param[in] value Value, which to publish
+     */
+    void write(const T& value)
+    {
+        uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+        /* Odd sequence: Readers shall retry. */
+        m_sequence.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        m_value = value;
+
+        m_sequence.store(sequence + 2U, std::memory_order_release);
+    }
+
+    /**
+     * Copy the latest published value.
+     *
+     * @param[out] value    Value
+     *
+     * @return Number of the copied value, which counts the writes. If nothing is published yet, it will return 0.
+     */
+    uint32_t read(T& value) const
+    {
+        uint32_t    before  = 0U;
+        uint32_t    after   = 0U;
+
+        do
+        {
+            before = m_sequence.load(std::memory_order_acquire);
+
+            value = m_value;
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = m_sequence.load(std::memory_order_relaxed);
+        }
+        while((before != after) || (0U != (before & 1U)));
+
+        return before / 2U;
+    }
+
+    /**
+     * Get the number of the latest published value, without copying it.
+     * It can be used to check for a new value cheap.
+     *
+     * @return Number of the latest value, which counts the writes. If nothing is published yet, it will return 0.
+     */
+    uint32_t getSequence() const
+    {
+        return m_sequence.load(std::memory_order_acquire) / 2U;
+    }
+
+private:
+
+    std::atomic<uint32_t>   m_sequence; /**< Twice the number of writes, odd while a write is in progress. */
+    T                       m_value;    /**< Latest published value */
+
+    SeqLock(const SeqLock& seqLock);
+    SeqLock& operator=(const SeqLock& seqLock);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __SEQ_LOCK_HPP__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,208 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Statistic value with histogram
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup utilities
+ *
+ * @{
+ */
+
+#ifndef __STATISTIC_HISTOGRAM_HPP__
+#define __STATISTIC_HISTOGRAM_HPP__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include "StatisticValue.hpp"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Statistic value, which additional counts the values in fixed buckets.
+ * The upper limit of a bucket is twice the limit of the previous one,
+ * starting with the first limit. The last bucket counts all values,
+ * which are greater or equal than the limit of the second last bucket.
+ *
+ * Example with first limit 64 and 4 buckets: [0; 64) [64; 128) [128; 256) [256; inf)
+ *
+ * @tparam T            Integer data type of the value
+ * @tparam zero         The number zero, compliant to the data type of the value.
+ * @tparam avgCnt       Number of values for the moving average calculation.
+ * @tparam bucketCnt    Number of buckets
+ */
+template < typename T, T zero, uint32_t avgCnt, uint8_t bucketCnt >
+class StatisticHistogram : public StatisticValue<T, zero, avgCnt>
+{
+public:
+
+    /** Number of buckets */
+    static const uint8_t BUCKET_CNT = bucketCnt;
+
+    /**
+     * Create the statistic histogram in initial state.
+     *
+     * @param[in] firstLimit    Upper limit (exclusive) of the first bucket.
+     */
+    StatisticHistogram(T firstLimit) :
+        StatisticValue<T, zero, avgCnt>(),
+        m_firstLimit(firstLimit),
+        m_cnt(0U),
+        m_buckets()
+    {
+        reset();
+    }
+
+    /**
+     * Destroys the statistic histogram.
+     */
+    ~StatisticHistogram()
+    {
+    }
+
+    /**
+     * Update the value, derive further information and count it in
+     * the corresponding bucket.
+     *
+     * @param[in] value The value which to observe.
+     */
+    void update(const T& value)
+    {
+        uint8_t idx     = 0U;
+        T       limit   = m_firstLimit;
+
+        StatisticValue<T, zero, avgCnt>::update(value);
+
+        /* Find the bucket. */
+        while(((bucketCnt - 1U) > idx) && (limit <= value))
+        {
+            limit <<= 1U;
+            ++idx;
+        }
+
+        ++m_buckets[idx];
+        ++m_cnt;
+    }
+
+    /**
+     * Reset everything to get it back in initial state.
+     */
+    void reset()
+    {
+        uint8_t idx = 0U;
+
+        StatisticValue<T, zero, avgCnt>::reset();
+
+        for(idx = 0U; idx < bucketCnt; ++idx)
+        {
+            m_buckets[idx] = 0U;
+        }
+
+        m_cnt = 0U;
+    }
+
+    /**
+     * Get the number of values, since the last reset.
+     *
+     * @return Number of values
+     */
+    uint32_t getCount() const
+    {
+        return m_cnt;
+    }
+
+    /**
+     * Get the upper limit (exclusive) of a bucket.
+     * The last bucket has no upper limit, its lower limit is returned instead.
+     *
+     * @param[in] idx   Bucket index
+     *
+     * @return Upper limit
+     */
+    T getBucketLimit(uint8_t idx) const
+    {
+        T limit = m_firstLimit;
+
+        if ((bucketCnt - 1U) <= idx)
+        {
+            idx = bucketCnt - 2U;
+        }
+
+        while(0U < idx)
+        {
+            limit <<= 1U;
+            --idx;
+        }
+
+        return limit;
+    }
+
+    /**
+     * Get the number of values, which were counted in the bucket.
+     *
+     * @param[in] idx   Bucket index
+     *
+     * @return Number of values in the bucket
+     */
+    uint32_t getBucketCount(uint8_t idx) const
+    {
+        uint32_t cnt = 0U;
+
+        if (bucketCnt > idx)
+        {
+            cnt = m_buckets[idx];
+        }
+
+        return cnt;
+    }
+
+private:
+
+    T           m_firstLimit;           /**< Upper limit of the first bucket. */
+    uint32_t    m_cnt;                  /**< Number of values since last reset. */
+    uint32_t    m_buckets[bucketCnt];   /**< Number of values per bucket */
+
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __STATISTIC_HISTOGRAM_HPP__ */
+
+/** @} */
\ No newline at end of file
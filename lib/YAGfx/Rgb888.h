@@ -171,12 +171,27 @@ public:
      */
     operator uint32_t() const
     {
-        uint32_t color24 = applyIntensity(m_red);
+        uint32_t color24 = 0U;
 
-        color24 <<= 8;
-        color24 |= applyIntensity(m_green);
-        color24 <<= 8;
-        color24 |= applyIntensity(m_blue);
+        /* Most of the time the color is shown with max. intensity,
+         * which doesn't need any calculation.
+         */
+        if (MAX_BRIGHT == m_intensity)
+        {
+            color24 = m_red;
+            color24 <<= 8;
+            color24 |= m_green;
+            color24 <<= 8;
+            color24 |= m_blue;
+        }
+        else
+        {
+            color24 = applyIntensity(m_red);
+            color24 <<= 8;
+            color24 |= applyIntensity(m_green);
+            color24 <<= 8;
+            color24 |= applyIntensity(m_blue);
+        }
 
         return color24;
     }
@@ -0,0 +1,128 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color in packed and premultiplied RGB888 format
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "Rgb888Packed.h"
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+void Rgb888Packed::setIntensity(uint8_t intensity)
+{
+    uint8_t currentIntensity = getIntensity();
+
+    if (currentIntensity != intensity)
+    {
+        uint8_t red     = 0U;
+        uint8_t green   = 0U;
+        uint8_t blue    = 0U;
+
+        /* A color with min. intensity is black and remains black. */
+        if (MIN_BRIGHT != currentIntensity)
+        {
+            red     = (static_cast<uint16_t>(getRed()) * intensity) / currentIntensity;
+            green   = (static_cast<uint16_t>(getGreen()) * intensity) / currentIntensity;
+            blue    = (static_cast<uint16_t>(getBlue()) * intensity) / currentIntensity;
+        }
+
+        m_value = pack(red, green, blue, intensity);
+    }
+
+    return;
+}
+
+void Rgb888Packed::turnColorWheel(uint8_t wheelPos)
+{
+    const uint8_t COL_PARTS = 3U;
+    const uint8_t COL_RANGE = UINT8_MAX / COL_PARTS;
+
+    wheelPos = UINT8_MAX - wheelPos;
+
+    /* Red + Blue ? */
+    if (wheelPos < COL_RANGE)
+    {
+        set(UINT8_MAX - wheelPos * COL_PARTS, 0U, COL_PARTS * wheelPos);
+    }
+    /* Green + Blue ? */
+    else if (wheelPos < (2 * COL_RANGE))
+    {
+        wheelPos -= COL_RANGE;
+
+        set(0U, COL_PARTS * wheelPos, UINT8_MAX - wheelPos * COL_PARTS);
+    }
+    /* Red + Green */
+    else
+    {
+        wheelPos -= ((COL_PARTS - 1U) * COL_RANGE);
+
+        set(COL_PARTS * wheelPos, UINT8_MAX - wheelPos * COL_PARTS, 0U);
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
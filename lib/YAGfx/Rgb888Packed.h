@@ -0,0 +1,423 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Color in packed and premultiplied RGB888 format
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __RGB888_PACKED_H__
+#define __RGB888_PACKED_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Color, which is based on the three base colors red, green and blue.
+ * In contrast to Rgb888, the base colors are stored premultiplied with the
+ * color intensity in a single 32-bit word (0xIIRRGGBB). Converting it to a
+ * RGB24 value is only a mask operation and copying it is a single word move.
+ *
+ * Note, changing the intensity scales the premultiplied base colors. Because
+ * the original base colors are not kept, dimming is not lossless. Dimming a
+ * color to 0 and increasing the intensity afterwards results in black.
+ */
+class Rgb888Packed
+{
+public:
+
+    /** Max. color intensity */
+    static const uint8_t MAX_BRIGHT = UINT8_MAX;
+
+    /** Min. color intensity */
+    static const uint8_t MIN_BRIGHT = 0U;
+
+    /**
+     * Constructs the color black.
+     */
+    Rgb888Packed() :
+        m_value(pack(0U, 0U, 0U, MAX_BRIGHT))
+    {
+    }
+
+    /**
+     * Destroys the color.
+     */
+    ~Rgb888Packed()
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) is given.
+     * The color intensity will be set to max. bright.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    Rgb888Packed(uint8_t red, uint8_t green, uint8_t blue) :
+        m_value(pack(red, green, blue, MAX_BRIGHT))
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case every base color (RGB) and
+     * the intensity is given.
+     *
+     * @param[in] red       Red value
+     * @param[in] green     Green value
+     * @param[in] blue      Blue value
+     * @param[in] intensity Color intensity [0; 255]
+     */
+    Rgb888Packed(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity) :
+        m_value(pack(applyIntensity(red, intensity), applyIntensity(green, intensity), applyIntensity(blue, intensity), intensity))
+    {
+    }
+
+    /**
+     * Specialized constructor, used in case a color value (RGB) is given as uint32 type.
+     * Color intensity will be set to max. bright.
+     *
+     * @param[in] value Color value in 24 bit format
+     */
+    Rgb888Packed(uint32_t value) :
+        m_value((value & RGB_MASK) | (static_cast<uint32_t>(MAX_BRIGHT) << INTENSITY_SHIFT))
+    {
+    }
+
+    /**
+     * Copy the given color.
+     *
+     * @param[in] color Color, which to copy
+     */
+    Rgb888Packed(const Rgb888Packed& color) :
+        m_value(color.m_value)
+    {
+        return;
+    }
+
+    /**
+     * Assign RGB color.
+     *
+     * @param[in] color Color, which to assign
+     */
+    Rgb888Packed& operator=(const Rgb888Packed& color)
+    {
+        m_value = color.m_value;
+
+        return *this;
+    }
+
+    /**
+     * Convert to RGB24 uint32_t value.
+     */
+    operator uint32_t() const
+    {
+        return m_value & RGB_MASK;
+    }
+
+    /**
+     * Get base color information with respect to current intensity.
+     *
+     * @param[out] red      Red value
+     * @param[out] green    Green value
+     * @param[out] blue     Blue value
+     */
+    void get(uint8_t& red, uint8_t& green, uint8_t& blue) const
+    {
+        red     = extractRed(m_value);
+        green   = extractGreen(m_value);
+        blue    = extractBlue(m_value);
+
+        return;
+    }
+
+    /**
+     * Set base color information.
+     * Intensity is not changed.
+     *
+     * @param[in] red   Red value
+     * @param[in] green Green value
+     * @param[in] blue  Blue value
+     */
+    void set(uint8_t red, uint8_t green, uint8_t blue)
+    {
+        set(red, green, blue, getIntensity());
+
+        return;
+    }
+
+    /**
+     * Set base color information, incl. intensity.
+     *
+     * @param[in] red       Red value
+     * @param[in] green     Green value
+     * @param[in] blue      Blue value
+     * @param[in] intensity Color intensity [0; 255]
+     */
+    void set(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity)
+    {
+        m_value = pack(applyIntensity(red, intensity), applyIntensity(green, intensity), applyIntensity(blue, intensity), intensity);
+
+        return;
+    }
+
+    /**
+     * Set new color information.
+     * The intensity won't change.
+     *
+     * @param[in] value Color value (RGB) in 24 bit format
+     */
+    void set(const uint32_t& value)
+    {
+        set(extractRed(value), extractGreen(value), extractBlue(value), getIntensity());
+
+        return;
+    }
+
+    /**
+     * Get red color value.
+     *
+     * @return Red value
+     */
+    uint8_t getRed() const
+    {
+        return extractRed(m_value);
+    }
+
+    /**
+     * Get green color value.
+     *
+     * @return Green value
+     */
+    uint8_t getGreen() const
+    {
+        return extractGreen(m_value);
+    }
+
+    /**
+     * Get blue color value.
+     *
+     * @return Blue value
+     */
+    uint8_t getBlue() const
+    {
+        return extractBlue(m_value);
+    }
+
+    /**
+     * Get color intensity.
+     * 
+     * @return Color intensity [0; 255] - 0: min. bright / 255: max. bright
+     */
+    uint8_t getIntensity() const
+    {
+        return static_cast<uint8_t>(m_value >> INTENSITY_SHIFT);
+    }
+
+    /**
+     * Set red color value.
+     *
+     * @param[in] value Red value
+     */
+    void setRed(uint8_t value)
+    {
+        m_value &= ~(static_cast<uint32_t>(UINT8_MAX) << 16U);
+        m_value |= static_cast<uint32_t>(applyIntensity(value, getIntensity())) << 16U;
+
+        return;
+    }
+
+    /**
+     * Set green color value.
+     *
+     * @param[in] value Green value
+     */
+    void setGreen(uint8_t value)
+    {
+        m_value &= ~(static_cast<uint32_t>(UINT8_MAX) << 8U);
+        m_value |= static_cast<uint32_t>(applyIntensity(value, getIntensity())) << 8U;
+
+        return;
+    }
+
+    /**
+     * Set blue color value.
+     *
+     * @param[in] value Blue value
+     */
+    void setBlue(uint8_t value)
+    {
+        m_value &= ~static_cast<uint32_t>(UINT8_MAX);
+        m_value |= applyIntensity(value, getIntensity());
+
+        return;
+    }
+
+    /**
+     * Set color intensity.
+     * The premultiplied base colors are scaled from the current intensity
+     * to the new one.
+     * 
+     * @param[in] intensity Color intensity [0; 255] - 0: min. bright / 255: max. bright
+     */
+    void setIntensity(uint8_t intensity);
+
+    /**
+     * Get color in 5-6-5 RGB format.
+     *
+     * @return Color in 5-6-5 RGB format
+     */
+    uint16_t to565() const
+    {
+        const uint16_t  RED5    = extractRed(m_value) >> 3U;
+        const uint16_t  GREEN6  = extractGreen(m_value) >> 2U;
+        const uint16_t  BLUE5   = extractBlue(m_value) >> 3U;
+
+        return ((RED5 & 0x1fU) << 11U) | ((GREEN6 & 0x3fU) << 5U) | ((BLUE5 & 0x1fU) << 0U);
+    }
+
+    /**
+     * Set color according to the position in the color wheel.
+     * It provides typical rainbow colors, which means a color is based on
+     * only two base colors.
+     *
+     * @param[in] wheelPos  Color wheel position
+     */
+    void turnColorWheel(uint8_t wheelPos);
+
+    /**
+     * Extract the red base color from a RGB24 value.
+     * 
+     * @param[in] value Color value in RGB24 format.
+     * 
+     * @return Red base color
+     */
+    static uint8_t extractRed(uint32_t value)
+    {
+        return (value >> 16U) & 0xffU;
+    }
+
+    /**
+     * Extract the green base color from a RGB24 value.
+     * 
+     * @param[in] value Color value in RGB24 format.
+     * 
+     * @return Green base color
+     */
+    static uint8_t extractGreen(uint32_t value)
+    {
+        return (value >> 8U) & 0xffU;
+    }
+
+    /**
+     * Extract the blue base color from a RGB24 value.
+     * 
+     * @param[in] value Color value in RGB24 format.
+     * 
+     * @return Blue base color
+     */
+    static uint8_t extractBlue(uint32_t value)
+    {
+        return (value >> 0U) & 0xffU;
+    }
+
+protected:
+
+private:
+
+    /** Mask of the premultiplied base colors. */
+    static const uint32_t   RGB_MASK        = 0x00ffffffU;
+
+    /** Bit position of the color intensity. */
+    static const uint32_t   INTENSITY_SHIFT = 24U;
+
+    uint32_t    m_value;    /**< Color intensity and premultiplied base colors in 0xIIRRGGBB format */
+
+    /**
+     * Pack the premultiplied base colors and the intensity in a single word.
+     *
+     * @param[in] red       Premultiplied red value
+     * @param[in] green     Premultiplied green value
+     * @param[in] blue      Premultiplied blue value
+     * @param[in] intensity Color intensity [0; 255]
+     *
+     * @return Packed color
+     */
+    static uint32_t pack(uint8_t red, uint8_t green, uint8_t blue, uint8_t intensity)
+    {
+        return (static_cast<uint32_t>(intensity) << INTENSITY_SHIFT) |
+               (static_cast<uint32_t>(red) << 16U) |
+               (static_cast<uint32_t>(green) << 8U) |
+               (static_cast<uint32_t>(blue) << 0U);
+    }
+
+    /**
+     * Calculate the base color with respect to the given intensity.
+     * 
+     * @param[in] baseColor Base color
+     * @param[in] intensity Color intensity [0; 255]
+     *
+     * @return Base color with considered intensity.
+     */
+    static uint8_t applyIntensity(uint8_t baseColor, uint8_t intensity)
+    {
+        uint8_t color = baseColor;
+
+        if (MAX_BRIGHT != intensity)
+        {
+            color = (static_cast<uint16_t>(baseColor) * static_cast<uint16_t>(intensity)) / MAX_BRIGHT;
+        }
+
+        return color;
+    }
+
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __RGB888_PACKED_H__ */
+
+/** @} */
\ No newline at end of file
@@ -40,10 +40,20 @@
  * Compile Switches
  *****************************************************************************/
 
+/**
+ * Select the color representation:
+ * 0: Rgb888, base colors and intensity are stored separate (non-destructive dimming).
+ * 1: Rgb888Packed, base colors are stored premultiplied in a single word.
+ */
+#ifndef CONFIG_YAGFX_PACKED_COLOR
+#define CONFIG_YAGFX_PACKED_COLOR   (0)
+#endif  /* CONFIG_YAGFX_PACKED_COLOR */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
 #include <Rgb888.h>
+#include <Rgb888Packed.h>
 #include <ColorDef.hpp>
 
 /******************************************************************************
@@ -54,10 +64,21 @@
  * Types and Classes
  *****************************************************************************/
 
+#if (0 != CONFIG_YAGFX_PACKED_COLOR)
+
+/**
+ * Defines the general color to packed and premultiplied RGB888 format.
+ */
+typedef Rgb888Packed    Color;
+
+#else   /* (0 != CONFIG_YAGFX_PACKED_COLOR) */
+
 /**
  * Defines the general color to RGB888 format.
  */
-typedef Rgb888  Color;
+typedef Rgb888          Color;
+
+#endif  /* (0 != CONFIG_YAGFX_PACKED_COLOR) */
 
 /******************************************************************************
  * Functions
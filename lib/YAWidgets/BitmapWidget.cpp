@@ -91,7 +91,7 @@ bool BitmapWidget::load(FS& fs, const String& filename)
     else
     {
         BmpImgLoader        loader;
-        BmpImgLoader::Ret   ret = loader.load(fs, filename, m_bitmap);
+        BmpImgLoader::Ret   ret = loader.loadCached(fs, filename, m_bitmap);
 
         if (BmpImgLoader::RET_OK != ret)
         {
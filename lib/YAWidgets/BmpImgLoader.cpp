@@ -33,6 +33,9 @@
  * Includes
  *****************************************************************************/
 #include "BmpImgLoader.h"
+#include "RawImgLoader.h"
+
+#include <new>
 
 /******************************************************************************
  * Compiler Switches
@@ -97,10 +100,109 @@ typedef enum
 
 } CompressionMethod;
 
+/**
+ * A single base color in a 16 or 32 bit pixel.
+ */
+typedef struct _BmpChannel
+{
+    uint32_t    mask;   /**< Bit mask of the base color in the pixel. */
+    uint8_t     shift;  /**< Position of the least significant bit of the mask. */
+    uint32_t    max;    /**< Max. value of the base color after shifting. */
+
+} BmpChannel;
+
+/**
+ * Color masks, which describe where to find the base colors in a 16 or 32 bit pixel.
+ */
+typedef struct _BmpColorMasks
+{
+    BmpChannel  red;    /**< Red base color */
+    BmpChannel  green;  /**< Green base color */
+    BmpChannel  blue;   /**< Blue base color */
+
+} BmpColorMasks;
+
+/**
+ * Reads a file sequentially in blocks, to avoid a file system access
+ * for every single byte.
+ */
+class BlockReader
+{
+public:
+
+    /**
+     * Constructs the block reader.
+     *
+     * @param[in] fd        File descriptor, positioned at the first byte to read.
+     * @param[in] buffer    Buffer, used to read the blocks.
+     * @param[in] size      Buffer size in bytes
+     */
+    BlockReader(File& fd, uint8_t* buffer, size_t size) :
+        m_fd(fd),
+        m_buffer(buffer),
+        m_size(size),
+        m_length(0U),
+        m_index(0U)
+    {
+    }
+
+    /**
+     * Destroys the block reader.
+     */
+    ~BlockReader()
+    {
+    }
+
+    /**
+     * Read the next byte.
+     *
+     * @param[out] value    Read byte
+     *
+     * @return If successful, it will return true otherwise false at the end of the file.
+     */
+    bool readByte(uint8_t& value)
+    {
+        bool isSuccessful = true;
+
+        if (m_length <= m_index)
+        {
+            m_length    = m_fd.read(m_buffer, m_size);
+            m_index     = 0U;
+        }
+
+        if (m_length <= m_index)
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            value = m_buffer[m_index];
+            ++m_index;
+        }
+
+        return isSuccessful;
+    }
+
+private:
+
+    File&       m_fd;       /**< File descriptor */
+    uint8_t*    m_buffer;   /**< Read buffer */
+    size_t      m_size;     /**< Read buffer size in bytes */
+    size_t      m_length;   /**< Number of valid bytes in the read buffer */
+    size_t      m_index;    /**< Index of the next byte in the read buffer */
+
+    BlockReader();
+    BlockReader(const BlockReader& reader);
+    BlockReader& operator=(const BlockReader& reader);
+};
+
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
 
+static void initChannel(BmpChannel& channel, uint32_t mask);
+static uint8_t getChannel(const BmpChannel& channel, uint32_t pixel);
+
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
@@ -136,95 +238,63 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
         {
             ret = RET_FILE_FORMAT_INVALID;
         }
-        /* Contains the bitmap file the supported DIB header?
-         * Planes must be 1.
-         * Compression is not supported.
-         * Palette colors are not supported.
-         * 24 and 32 bits per pixel are supported.
-         */
-        else if ((sizeof(dibHeader) != dibHeader.headerSize) ||
-                 (1 != dibHeader.planes) ||
-                 (COMPRESSION_METHOD_RGB != dibHeader.compression) ||
-                 (0 < dibHeader.paletteColors) ||
-                 ((24 != dibHeader.bpp) && (32 != dibHeader.bpp)))
+        /* Contains the bitmap file a supported DIB header and pixel format? */
+        else if (false == isFormatSupported(dibHeader))
         {
             ret = RET_FILE_FORMAT_UNSUPPORTED;
         }
         /* Supported image size is limited. */
         else if ((UINT16_MAX < dibHeader.imageWidth) ||
-                 (UINT16_MAX < dibHeader.imageHeight))
+                 (UINT16_MAX < abs(dibHeader.imageHeight)))
         {
             ret = RET_IMG_TOO_BIG;
         }
         else
         {
-            uint16_t width  = abs(dibHeader.imageWidth);
-            uint16_t height = abs(dibHeader.imageHeight);
+            uint16_t        width   = dibHeader.imageWidth;
+            uint16_t        height  = abs(dibHeader.imageHeight);
+            BmpColorMasks   masks   = {};
+            Color*          palette = nullptr;
 
             bitmap.release();
 
-            if (false == bitmap.create(width, height))
+            if (8U == dibHeader.bpp)
+            {
+                palette = new(std::nothrow) Color[PALETTE_SIZE];
+            }
+
+            if ((8U == dibHeader.bpp) &&
+                (nullptr == palette))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else if (false == bitmap.create(width, height))
             {
                 ret = RET_IMG_TOO_BIG;
             }
+            else if ((nullptr != palette) &&
+                     (false == loadPalette(fd, dibHeader, palette)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else if ((nullptr == palette) &&
+                     (false == loadColorMasks(fd, dibHeader, masks)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else if (COMPRESSION_METHOD_RLE8 == dibHeader.compression)
+            {
+                ret = loadRle8(fd, bmpFileHeader, palette, bitmap);
+            }
             else
             {
-                uint32_t    pos             = 0;
-                uint32_t    rowSize         = 0;
-                int16_t    x                = 0;
-                int16_t    y                = 0;
-                bool        isTopToBottom   = false;
-                uint16_t    bytePerPixel    = dibHeader.bpp / 8;
-
-                /* The bits representing the bitmap pixels are packed in rows.
-                 * The size of each row is rounded up to a multiple of 4 bytes
-                 * (a 32-bit DWORD) by padding.
-                 */
-                rowSize     =  (dibHeader.bpp * bitmap.getWidth() + 31) / 32 * 4;
-
-                /* ImageHeight is expressed as a negative number for top-down images. */
-                if (0 > dibHeader.imageHeight)
-                {
-                    isTopToBottom = true;
-                }
-
-                while((bitmap.getHeight() > y) && (RET_OK == ret))
-                {
-                    x = 0;
-
-                    while((bitmap.getWidth() > x) && (RET_OK == ret))
-                    {
-                        uint8_t lineBuffer[bytePerPixel];
-
-                        if (false == isTopToBottom)
-                        {
-                            pos = x * bytePerPixel + (bitmap.getHeight() - y - 1) * rowSize;
-                        }
-                        else
-                        {
-                            pos = x * bytePerPixel + y * rowSize;
-                        }
-
-                        if (false == fd.seek(bmpFileHeader.offset + pos, SeekSet))
-                        {
-                            ret = RET_FILE_FORMAT_INVALID;
-                        }
-                        else if (sizeof(lineBuffer) != fd.read(lineBuffer, sizeof(lineBuffer)))
-                        {
-                            ret = RET_FILE_FORMAT_INVALID;
-                        }
-                        else
-                        {
-                            Color color(lineBuffer[2], lineBuffer[1], lineBuffer[0]);
-
-                            bitmap.drawPixel(x, y, color);
-                        }
-
-                        ++x;
-                    }
+                ret = loadRows(fd, bmpFileHeader, dibHeader, masks, palette, bitmap);
+            }
 
-                    ++y;
-                }
+            if (nullptr != palette)
+            {
+                delete[] palette;
+                palette = nullptr;
             }
         }
 
@@ -239,6 +309,37 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
     return ret;
 }
 
+BmpImgLoader::Ret BmpImgLoader::loadCached(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap)
+{
+    Ret     ret         = RET_OK;
+    File    fd          = fs.open(fileName, "r");
+    String  cacheName   = RawImgLoader::getCacheFileName(fileName);
+
+    if (false == fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        RawImgLoader    rawLoader;
+        uint32_t        sourceId    = getSourceId(fd);
+
+        fd.close();
+
+        if (RawImgLoader::RET_OK != rawLoader.load(fs, cacheName, sourceId, bitmap))
+        {
+            ret = load(fs, fileName, bitmap);
+
+            if (RET_OK == ret)
+            {
+                (void)rawLoader.save(fs, cacheName, sourceId, bitmap);
+            }
+        }
+    }
+
+    return ret;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -247,6 +348,14 @@ BmpImgLoader::Ret BmpImgLoader::load(FS& fs, const String& fileName, YAGfxDynami
  * Private Methods
  *****************************************************************************/
 
+uint32_t BmpImgLoader::getSourceId(File& fd)
+{
+    /* The file size and the time of the last write identify the bitmap
+     * file. If the file system provides no time, only the size is used.
+     */
+    return (static_cast<uint32_t>(fd.size()) * 31U) + static_cast<uint32_t>(fd.getLastWrite());
+}
+
 bool BmpImgLoader::loadBmpFileHeader(File& fd, BmpFileHeader& header)
 {
     bool isSuccessful = true;
@@ -271,6 +380,370 @@ bool BmpImgLoader::loadDibHeader(File& fd, BmpV5Header& header)
     return isSuccessful;
 }
 
+bool BmpImgLoader::isFormatSupported(const BmpV5Header& header) const
+{
+    bool isSupported = false;
+
+    /* The BITMAPINFOHEADER and its successors (v2 - v5) start with the same
+     * fields and are supported. Planes must be 1.
+     */
+    if ((sizeof(header) <= header.headerSize) &&
+        (1U == header.planes) &&
+        (0 < header.imageWidth) &&
+        (0 != header.imageHeight) &&
+        (PALETTE_SIZE >= header.paletteColors))
+    {
+        switch(header.compression)
+        {
+        case COMPRESSION_METHOD_RGB:
+            if ((8U == header.bpp) ||
+                (16U == header.bpp) ||
+                (24U == header.bpp) ||
+                (32U == header.bpp))
+            {
+                isSupported = true;
+            }
+            break;
+
+        /* RLE8 compressed images are always bottom-up. */
+        case COMPRESSION_METHOD_RLE8:
+            if ((8U == header.bpp) &&
+                (0 < header.imageHeight))
+            {
+                isSupported = true;
+            }
+            break;
+
+        case COMPRESSION_METHOD_BITFIELDS:
+        case COMPRESSION_METHOD_ALPHA:
+            if ((16U == header.bpp) ||
+                (32U == header.bpp))
+            {
+                isSupported = true;
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return isSupported;
+}
+
+bool BmpImgLoader::loadColorMasks(File& fd, const BmpV5Header& header, BmpColorMasks& masks)
+{
+    bool isSuccessful = true;
+
+    if ((COMPRESSION_METHOD_BITFIELDS == header.compression) ||
+        (COMPRESSION_METHOD_ALPHA == header.compression))
+    {
+        uint32_t rgbMasks[3U];
+
+        /* The masks follow the BITMAPINFOHEADER, which is the same position
+         * as in the v2 - v5 headers, where they are part of the header.
+         */
+        if (false == fd.seek(sizeof(BmpFileHeader) + sizeof(BmpV5Header), SeekSet))
+        {
+            isSuccessful = false;
+        }
+        else if (sizeof(rgbMasks) != fd.read(reinterpret_cast<uint8_t*>(rgbMasks), sizeof(rgbMasks)))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            initChannel(masks.red, rgbMasks[0U]);
+            initChannel(masks.green, rgbMasks[1U]);
+            initChannel(masks.blue, rgbMasks[2U]);
+        }
+    }
+    /* RGB555 */
+    else if (16U == header.bpp)
+    {
+        initChannel(masks.red, 0x00007c00U);
+        initChannel(masks.green, 0x000003e0U);
+        initChannel(masks.blue, 0x0000001fU);
+    }
+    /* RGB888 */
+    else
+    {
+        initChannel(masks.red, 0x00ff0000U);
+        initChannel(masks.green, 0x0000ff00U);
+        initChannel(masks.blue, 0x000000ffU);
+    }
+
+    return isSuccessful;
+}
+
+bool BmpImgLoader::loadPalette(File& fd, const BmpV5Header& header, Color* palette)
+{
+    bool        isSuccessful    = true;
+    uint16_t    paletteColors   = (0U == header.paletteColors) ? PALETTE_SIZE : header.paletteColors;
+    uint16_t    index           = 0U;
+    uint8_t     entry[4U];  /* Blue, green, red, reserved */
+
+    /* The palette follows the DIB header. */
+    if (false == fd.seek(sizeof(BmpFileHeader) + header.headerSize, SeekSet))
+    {
+        isSuccessful = false;
+    }
+
+    while((true == isSuccessful) && (paletteColors > index))
+    {
+        if (sizeof(entry) != fd.read(entry, sizeof(entry)))
+        {
+            isSuccessful = false;
+        }
+        else
+        {
+            palette[index] = Color(entry[2U], entry[1U], entry[0U]);
+            ++index;
+        }
+    }
+
+    return isSuccessful;
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadRows(File& fd, const BmpFileHeader& fileHeader, const BmpV5Header& dibHeader, const BmpColorMasks& masks, const Color* palette, YAGfxDynamicBitmap& bitmap)
+{
+    Ret         ret             = RET_OK;
+    uint16_t    width           = bitmap.getWidth();
+    uint16_t    height          = bitmap.getHeight();
+    uint16_t    bytePerPixel    = dibHeader.bpp / 8U;
+    uint32_t    rowSize         = 0U;
+    uint8_t*    rowBuffer       = nullptr;
+    Color*      line            = nullptr;
+    uint16_t    row             = 0U;
+
+    /* The bits representing the bitmap pixels are packed in rows.
+     * The size of each row is rounded up to a multiple of 4 bytes
+     * (a 32-bit DWORD) by padding.
+     */
+    rowSize     = (static_cast<uint32_t>(dibHeader.bpp) * width + 31U) / 32U * 4U;
+    rowBuffer   = new(std::nothrow) uint8_t[rowSize];
+    line        = new(std::nothrow) Color[width];
+
+    if ((nullptr == rowBuffer) ||
+        (nullptr == line))
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else if (false == fd.seek(fileHeader.offset, SeekSet))
+    {
+        ret = RET_FILE_FORMAT_INVALID;
+    }
+    else
+    {
+        /* The rows are read in the order they are stored, therefore no seek is necessary. */
+        while((height > row) && (RET_OK == ret))
+        {
+            if (rowSize != fd.read(rowBuffer, rowSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                const uint8_t*  pixel   = rowBuffer;
+                uint16_t        x       = 0U;
+                int16_t         y       = 0;
+
+                /* ImageHeight is expressed as a negative number for top-down images. */
+                if (0 > dibHeader.imageHeight)
+                {
+                    y = row;
+                }
+                else
+                {
+                    y = height - row - 1U;
+                }
+
+                switch(dibHeader.bpp)
+                {
+                case 8U:
+                    for(x = 0U; x < width; ++x)
+                    {
+                        line[x] = palette[pixel[0U]];
+                        pixel += bytePerPixel;
+                    }
+                    break;
+
+                case 16U:
+                    for(x = 0U; x < width; ++x)
+                    {
+                        uint32_t value = static_cast<uint32_t>(pixel[0U]) |
+                                         (static_cast<uint32_t>(pixel[1U]) << 8U);
+
+                        line[x] = Color(getChannel(masks.red, value), getChannel(masks.green, value), getChannel(masks.blue, value));
+                        pixel += bytePerPixel;
+                    }
+                    break;
+
+                case 24U:
+                    for(x = 0U; x < width; ++x)
+                    {
+                        line[x] = Color(pixel[2U], pixel[1U], pixel[0U]);
+                        pixel += bytePerPixel;
+                    }
+                    break;
+
+                case 32U:
+                    for(x = 0U; x < width; ++x)
+                    {
+                        uint32_t value = static_cast<uint32_t>(pixel[0U]) |
+                                         (static_cast<uint32_t>(pixel[1U]) << 8U) |
+                                         (static_cast<uint32_t>(pixel[2U]) << 16U) |
+                                         (static_cast<uint32_t>(pixel[3U]) << 24U);
+
+                        line[x] = Color(getChannel(masks.red, value), getChannel(masks.green, value), getChannel(masks.blue, value));
+                        pixel += bytePerPixel;
+                    }
+                    break;
+
+                default:
+                    ret = RET_FILE_FORMAT_UNSUPPORTED;
+                    break;
+                }
+
+                if (RET_OK == ret)
+                {
+                    bitmap.drawSpan(0, y, line, width);
+                }
+            }
+
+            ++row;
+        }
+    }
+
+    if (nullptr != rowBuffer)
+    {
+        delete[] rowBuffer;
+    }
+
+    if (nullptr != line)
+    {
+        delete[] line;
+    }
+
+    return ret;
+}
+
+BmpImgLoader::Ret BmpImgLoader::loadRle8(File& fd, const BmpFileHeader& fileHeader, const Color* palette, YAGfxDynamicBitmap& bitmap)
+{
+    Ret         ret         = RET_OK;
+    uint8_t*    readBuffer  = new(std::nothrow) uint8_t[RLE_BUFFER_SIZE];
+
+    if (nullptr == readBuffer)
+    {
+        ret = RET_IMG_TOO_BIG;
+    }
+    else if (false == fd.seek(fileHeader.offset, SeekSet))
+    {
+        ret = RET_FILE_FORMAT_INVALID;
+    }
+    else
+    {
+        BlockReader reader(fd, readBuffer, RLE_BUFFER_SIZE);
+        int32_t     x           = 0;
+        int32_t     row         = 0;
+        bool        isFinished  = false;
+        uint8_t     first       = 0U;
+        uint8_t     second      = 0U;
+
+        /* Pixels, which are skipped by the compression, remain black. */
+        while((false == isFinished) && (RET_OK == ret))
+        {
+            if ((false == reader.readByte(first)) ||
+                (false == reader.readByte(second)))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            /* Encoded mode: Repeat the color index. */
+            else if (0U < first)
+            {
+                if (bitmap.getWidth() > x)
+                {
+                    bitmap.fillSpan(x, bitmap.getHeight() - row - 1, first, palette[second]);
+                }
+
+                x += first;
+            }
+            /* End of line */
+            else if (0U == second)
+            {
+                x = 0;
+                ++row;
+            }
+            /* End of bitmap */
+            else if (1U == second)
+            {
+                isFinished = true;
+            }
+            /* Delta: Move the current position right and up. */
+            else if (2U == second)
+            {
+                uint8_t dx = 0U;
+                uint8_t dy = 0U;
+
+                if ((false == reader.readByte(dx)) ||
+                    (false == reader.readByte(dy)))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+                else
+                {
+                    x   += dx;
+                    row += dy;
+                }
+            }
+            /* Absolute mode: The color indices follow, padded to a 16-bit boundary. */
+            else
+            {
+                uint8_t count   = second;
+                uint8_t index   = 0U;
+
+                while((0U < count) && (RET_OK == ret))
+                {
+                    if (false == reader.readByte(index))
+                    {
+                        ret = RET_FILE_FORMAT_INVALID;
+                    }
+                    else
+                    {
+                        if (bitmap.getWidth() > x)
+                        {
+                            bitmap.drawPixel(x, bitmap.getHeight() - row - 1, palette[index]);
+                        }
+
+                        ++x;
+                        --count;
+                    }
+                }
+
+                if ((RET_OK == ret) &&
+                    (0U != (second & 1U)) &&
+                    (false == reader.readByte(index)))
+                {
+                    ret = RET_FILE_FORMAT_INVALID;
+                }
+            }
+
+            /* Stop at the top of the image, even if the end of bitmap marker is missing. */
+            if (bitmap.getHeight() <= row)
+            {
+                isFinished = true;
+            }
+        }
+    }
+
+    if (nullptr != readBuffer)
+    {
+        delete[] readBuffer;
+    }
+
+    return ret;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -278,3 +751,60 @@ bool BmpImgLoader::loadDibHeader(File& fd, BmpV5Header& header)
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Initialize a base color channel by its bit mask.
+ *
+ * @param[out] channel  Base color channel
+ * @param[in] mask      Bit mask of the base color in the pixel
+ */
+static void initChannel(BmpChannel& channel, uint32_t mask)
+{
+    channel.mask    = mask;
+    channel.shift   = 0U;
+    channel.max     = 0U;
+
+    if (0U != mask)
+    {
+        while(0U == (mask & 1U))
+        {
+            mask >>= 1U;
+            ++channel.shift;
+        }
+
+        /* Only the 8 most significant bits of a wider base color are used. */
+        while(UINT8_MAX < mask)
+        {
+            mask >>= 1U;
+            ++channel.shift;
+        }
+
+        channel.max = mask;
+    }
+}
+
+/**
+ * Get the base color from a pixel, scaled to 8 bit.
+ *
+ * @param[in] channel   Base color channel
+ * @param[in] pixel     Pixel value
+ *
+ * @return Base color value [0; 255]
+ */
+static uint8_t getChannel(const BmpChannel& channel, uint32_t pixel)
+{
+    uint32_t value = 0U;
+
+    if (0U != channel.max)
+    {
+        value = (pixel & channel.mask) >> channel.shift;
+
+        /* Scale e.g. a 5 or 6 bit base color to 8 bit. */
+        if (UINT8_MAX != channel.max)
+        {
+            value = (value * UINT8_MAX + (channel.max / 2U)) / channel.max;
+        }
+    }
+
+    return static_cast<uint8_t>(value);
+}
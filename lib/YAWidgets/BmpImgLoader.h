@@ -58,13 +58,18 @@
 /* Forward declarations */
 typedef struct _BmpFileHeader BmpFileHeader;
 typedef struct _BmpV5Header BmpV5Header;
+typedef struct _BmpColorMasks BmpColorMasks;
 
 /**
  * Bitmap image loader, which supports images that have
- * - 24/32 bit per pixel
- * - No compression
- * - No palette colors
+ * - 8 bit per pixel with palette colors, uncompressed or RLE8 compressed
+ * - 16 bit per pixel, uncompressed (RGB555) or with bit fields (e.g. RGB565)
+ * - 24 bit per pixel, uncompressed
+ * - 32 bit per pixel, uncompressed or with bit fields
  * - Resolution of max. 65535 x 65535 pixels
+ *
+ * The pixel data is read row by row into a buffer, instead of accessing
+ * the file system for every single pixel.
  */
 class BmpImgLoader
 {
@@ -107,8 +112,37 @@ public:
      */
     Ret load(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap);
 
+    /**
+     * Load bitmap image (.bmp) from file system to bitmap buffer and use
+     * a raw image file as cache, see RawImgLoader. The bitmap image is only
+     * decoded, if the cache doesn't exist or was created from a different
+     * bitmap file. In this case the cache is written afterwards.
+     *
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[out] bitmap   Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadCached(FS& fs, const String& fileName, YAGfxDynamicBitmap& bitmap);
+
 private:
 
+    /** Max. number of palette colors (8 bit per pixel). */
+    static const uint16_t   PALETTE_SIZE        = 256U;
+
+    /** Size of the buffer in bytes, which is used to read compressed pixel data. */
+    static const size_t     RLE_BUFFER_SIZE     = 256U;
+
+    /**
+     * Get the id of the bitmap file, which is used to detect an outdated cache.
+     *
+     * @param[in] fd        File descriptor
+     *
+     * @return Source id
+     */
+    uint32_t getSourceId(File& fd);
+
     /**
      * Load bitmap file header from file system.
      * 
@@ -128,6 +162,66 @@ private:
      * @return If successful, it will return true otherwise false.
      */
     bool loadDibHeader(File& fd, BmpV5Header& header);
+
+    /**
+     * Is the bitmap format, described by the DIB header, supported?
+     *
+     * @param[in] header    DIB header
+     *
+     * @return If supported, it will return true otherwise false.
+     */
+    bool isFormatSupported(const BmpV5Header& header) const;
+
+    /**
+     * Load the color masks, which describe where to find the base colors
+     * in a 16 or 32 bit pixel. If the pixel data contains no bit fields,
+     * the default masks are used.
+     *
+     * @param[in] fd        File descriptor
+     * @param[in] header    DIB header
+     * @param[out] masks    Color masks
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool loadColorMasks(File& fd, const BmpV5Header& header, BmpColorMasks& masks);
+
+    /**
+     * Load the color palette, which follows the DIB header.
+     * Palette entries, which are not in the file, are black.
+     *
+     * @param[in] fd        File descriptor
+     * @param[in] header    DIB header
+     * @param[out] palette  Color palette with PALETTE_SIZE entries
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool loadPalette(File& fd, const BmpV5Header& header, Color* palette);
+
+    /**
+     * Load uncompressed or bit field pixel data row by row.
+     *
+     * @param[in] fd            File descriptor
+     * @param[in] fileHeader    Bitmap file header
+     * @param[in] dibHeader     DIB header
+     * @param[in] masks         Color masks, used for 16 and 32 bit per pixel
+     * @param[in] palette       Color palette, used for 8 bit per pixel
+     * @param[out] bitmap       Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadRows(File& fd, const BmpFileHeader& fileHeader, const BmpV5Header& dibHeader, const BmpColorMasks& masks, const Color* palette, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Load RLE8 compressed pixel data.
+     *
+     * @param[in] fd            File descriptor
+     * @param[in] fileHeader    Bitmap file header
+     * @param[in] palette       Color palette
+     * @param[out] bitmap       Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret loadRle8(File& fd, const BmpFileHeader& fileHeader, const Color* palette, YAGfxDynamicBitmap& bitmap);
 };
 
 /******************************************************************************
@@ -0,0 +1,416 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Raw image loader
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "RawImgLoader.h"
+
+#include <new>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/** Raw image signature "RI" */
+static const uint16_t   RAW_IMG_SIGNATURE   = 0x4952;
+
+/** Raw image format version */
+static const uint8_t    RAW_IMG_VERSION     = 1U;
+
+/** Number of bytes of a palette entry or of a not palettized pixel. */
+static const uint8_t    RAW_IMG_RGB_SIZE    = 3U;
+
+/**
+ * Raw image pixel formats.
+ */
+typedef enum
+{
+    RAW_IMG_FORMAT_RGB888   = 0,    /**< 3 bytes per pixel: red, green, blue */
+    RAW_IMG_FORMAT_PALETTE8 = 1     /**< 1 byte palette index per pixel */
+
+} RawImgFormat;
+
+/**
+ * Raw image file header.
+ */
+typedef struct _RawImgHeader
+{
+    uint16_t    signature;      /**< Raw image signature for file format identification. */
+    uint8_t     version;        /**< Raw image format version. */
+    uint8_t     format;         /**< Pixel format, see RawImgFormat. */
+    uint16_t    width;          /**< Image width in pixels. */
+    uint16_t    height;         /**< Image height in pixels. */
+    uint16_t    paletteColors;  /**< Number of palette colors. 0 if not palettized. */
+    uint16_t    reserved;       /**< Reserved */
+    uint32_t    sourceId;       /**< Identifies the source the raw image was created from. */
+
+} __attribute__ ((packed)) RawImgHeader;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/* Initialize raw image file extension. */
+const char* RawImgLoader::FILE_EXT  = ".raw";
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+RawImgLoader::Ret RawImgLoader::load(FS& fs, const String& fileName, uint32_t sourceId, YAGfxDynamicBitmap& bitmap)
+{
+    Ret     ret = RET_OK;
+    File    fd  = fs.open(fileName, "r");
+
+    bitmap.release();
+
+    if (false == fd)
+    {
+        ret = RET_FILE_NOT_FOUND;
+    }
+    else
+    {
+        RawImgHeader    header;
+        uint8_t*        data    = reinterpret_cast<uint8_t*>(&header);
+
+        if (sizeof(header) != fd.read(data, sizeof(header)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if ((RAW_IMG_SIGNATURE != header.signature) ||
+                 (RAW_IMG_VERSION != header.version))
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else if (sourceId != header.sourceId)
+        {
+            ret = RET_FILE_OUTDATED;
+        }
+        else if ((0U == header.width) ||
+                 (0U == header.height))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if ((RAW_IMG_FORMAT_PALETTE8 == header.format) &&
+                 ((0U == header.paletteColors) || (PALETTE_SIZE < header.paletteColors)))
+        {
+            ret = RET_FILE_FORMAT_INVALID;
+        }
+        else if ((RAW_IMG_FORMAT_RGB888 != header.format) &&
+                 (RAW_IMG_FORMAT_PALETTE8 != header.format))
+        {
+            ret = RET_FILE_FORMAT_UNSUPPORTED;
+        }
+        else
+        {
+            bool    isPalettized    = (RAW_IMG_FORMAT_PALETTE8 == header.format);
+            size_t  pixelCnt        = static_cast<size_t>(header.width) * static_cast<size_t>(header.height);
+            size_t  paletteSize     = (true == isPalettized) ? (header.paletteColors * RAW_IMG_RGB_SIZE) : 0U;
+            size_t  pixelSize       = (true == isPalettized) ? 1U : RAW_IMG_RGB_SIZE;
+            size_t  dataSize        = paletteSize + (pixelCnt * pixelSize);
+            Color*  line            = new(std::nothrow) Color[header.width];
+
+            data = new(std::nothrow) uint8_t[dataSize];
+
+            if ((nullptr == data) ||
+                (nullptr == line))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            else if (false == bitmap.create(header.width, header.height))
+            {
+                ret = RET_IMG_TOO_BIG;
+            }
+            /* Palette and pixel data are read at once. */
+            else if (dataSize != fd.read(data, dataSize))
+            {
+                ret = RET_FILE_FORMAT_INVALID;
+            }
+            else
+            {
+                const uint8_t*  palette = data;
+                const uint8_t*  pixel   = &data[paletteSize];
+                uint16_t        x       = 0U;
+                uint16_t        y       = 0U;
+
+                for(y = 0U; (y < header.height) && (RET_OK == ret); ++y)
+                {
+                    for(x = 0U; (x < header.width) && (RET_OK == ret); ++x)
+                    {
+                        if (false == isPalettized)
+                        {
+                            line[x] = Color(pixel[0U], pixel[1U], pixel[2U]);
+                            pixel += RAW_IMG_RGB_SIZE;
+                        }
+                        else if (header.paletteColors <= pixel[0U])
+                        {
+                            ret = RET_FILE_FORMAT_INVALID;
+                        }
+                        else
+                        {
+                            const uint8_t* entry = &palette[pixel[0U] * RAW_IMG_RGB_SIZE];
+
+                            line[x] = Color(entry[0U], entry[1U], entry[2U]);
+                            ++pixel;
+                        }
+                    }
+
+                    bitmap.drawSpan(0, y, line, header.width);
+                }
+            }
+
+            if (nullptr != data)
+            {
+                delete[] data;
+            }
+
+            if (nullptr != line)
+            {
+                delete[] line;
+            }
+        }
+
+        fd.close();
+    }
+
+    if (RET_OK != ret)
+    {
+        bitmap.release();
+    }
+
+    return ret;
+}
+
+bool RawImgLoader::save(FS& fs, const String& fileName, uint32_t sourceId, const YAGfxDynamicBitmap& bitmap)
+{
+    bool isSuccessful = false;
+
+    if (true == bitmap.isAllocated())
+    {
+        File fd = fs.open(fileName, "w");
+
+        if (true == fd)
+        {
+            uint32_t*       palette     = new(std::nothrow) uint32_t[PALETTE_SIZE];
+            uint16_t        colors      = 0U;
+            size_t          pixelCnt    = static_cast<size_t>(bitmap.getWidth()) * static_cast<size_t>(bitmap.getHeight());
+            RawImgHeader    header;
+
+            if (nullptr != palette)
+            {
+                colors = createPalette(bitmap, palette);
+
+                /* Use the palette only, if the image gets smaller. */
+                if ((colors * RAW_IMG_RGB_SIZE + pixelCnt) >= (pixelCnt * RAW_IMG_RGB_SIZE))
+                {
+                    colors = 0U;
+                }
+            }
+
+            header.signature        = RAW_IMG_SIGNATURE;
+            header.version          = RAW_IMG_VERSION;
+            header.format           = (0U == colors) ? RAW_IMG_FORMAT_RGB888 : RAW_IMG_FORMAT_PALETTE8;
+            header.width            = bitmap.getWidth();
+            header.height           = bitmap.getHeight();
+            header.paletteColors    = colors;
+            header.reserved         = 0U;
+            header.sourceId         = sourceId;
+
+            if (sizeof(header) == fd.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)))
+            {
+                isSuccessful = writePixels(fd, bitmap, (0U == colors) ? nullptr : palette, colors);
+            }
+
+            if (nullptr != palette)
+            {
+                delete[] palette;
+            }
+
+            fd.close();
+
+            /* Don't keep a incomplete file. */
+            if (false == isSuccessful)
+            {
+                (void)fs.remove(fileName);
+            }
+        }
+    }
+
+    return isSuccessful;
+}
+
+String RawImgLoader::getCacheFileName(const String& fileName)
+{
+    String  cacheFileName   = fileName;
+    int     dotIndex        = cacheFileName.lastIndexOf('.');
+    int     slashIndex      = cacheFileName.lastIndexOf('/');
+
+    /* Replace the file extension, if there is one. */
+    if (dotIndex > slashIndex)
+    {
+        cacheFileName.remove(dotIndex);
+    }
+
+    cacheFileName += FILE_EXT;
+
+    return cacheFileName;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+uint16_t RawImgLoader::createPalette(const YAGfxDynamicBitmap& bitmap, uint32_t* palette)
+{
+    uint16_t    colors  = 0U;
+    bool        isFull  = false;
+    uint16_t    x       = 0U;
+    uint16_t    y       = 0U;
+
+    for(y = 0U; (y < bitmap.getHeight()) && (false == isFull); ++y)
+    {
+        const Color* row = bitmap.getRow(y);
+
+        for(x = 0U; (x < bitmap.getWidth()) && (false == isFull); ++x)
+        {
+            uint32_t color = static_cast<uint32_t>(row[x]);
+
+            if (colors == getPaletteIndex(palette, colors, color))
+            {
+                if (PALETTE_SIZE == colors)
+                {
+                    isFull = true;
+                }
+                else
+                {
+                    palette[colors] = color;
+                    ++colors;
+                }
+            }
+        }
+    }
+
+    return (true == isFull) ? 0U : colors;
+}
+
+uint16_t RawImgLoader::getPaletteIndex(const uint32_t* palette, uint16_t colors, uint32_t color) const
+{
+    uint16_t index = 0U;
+
+    while((index < colors) && (color != palette[index]))
+    {
+        ++index;
+    }
+
+    return index;
+}
+
+bool RawImgLoader::writePixels(File& fd, const YAGfxDynamicBitmap& bitmap, const uint32_t* palette, uint16_t colors)
+{
+    bool        isSuccessful    = true;
+    uint16_t    width           = bitmap.getWidth();
+    uint8_t*    buffer          = new(std::nothrow) uint8_t[width * RAW_IMG_RGB_SIZE];
+    uint16_t    index           = 0U;
+    uint16_t    x               = 0U;
+    uint16_t    y               = 0U;
+
+    if (nullptr == buffer)
+    {
+        isSuccessful = false;
+    }
+    else
+    {
+        /* Palette */
+        for(index = 0U; (index < colors) && (true == isSuccessful); ++index)
+        {
+            uint8_t entry[RAW_IMG_RGB_SIZE] =
+            {
+                static_cast<uint8_t>(palette[index] >> 16U),
+                static_cast<uint8_t>(palette[index] >> 8U),
+                static_cast<uint8_t>(palette[index] >> 0U)
+            };
+
+            isSuccessful = (sizeof(entry) == fd.write(entry, sizeof(entry)));
+        }
+
+        /* Pixel data row by row */
+        for(y = 0U; (y < bitmap.getHeight()) && (true == isSuccessful); ++y)
+        {
+            const Color*    row     = bitmap.getRow(y);
+            size_t          length  = 0U;
+
+            for(x = 0U; x < width; ++x)
+            {
+                uint32_t color = static_cast<uint32_t>(row[x]);
+
+                if (nullptr != palette)
+                {
+                    buffer[length] = static_cast<uint8_t>(getPaletteIndex(palette, colors, color));
+                    ++length;
+                }
+                else
+                {
+                    buffer[length + 0U] = static_cast<uint8_t>(color >> 16U);
+                    buffer[length + 1U] = static_cast<uint8_t>(color >> 8U);
+                    buffer[length + 2U] = static_cast<uint8_t>(color >> 0U);
+                    length += RAW_IMG_RGB_SIZE;
+                }
+            }
+
+            isSuccessful = (length == fd.write(buffer, length));
+        }
+
+        delete[] buffer;
+    }
+
+    return isSuccessful;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,190 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Raw image loader
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup gfx
+ *
+ * @{
+ */
+
+#ifndef __RAW_IMG_LOADER_H__
+#define __RAW_IMG_LOADER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <YAGfxBitmap.h>
+#include <FS.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/* Forward declarations */
+typedef struct _RawImgHeader RawImgHeader;
+
+/**
+ * Raw image loader, which stores and loads images in a compact native
+ * pixel format. It is used as cache for images, which are expensive to
+ * decode, like bitmap files. The cache is written once and afterwards
+ * the image is loaded with a single read of the pixel data.
+ *
+ * File format (little endian):
+ * - Header, see RawImgHeader.
+ * - Color palette with 3 bytes (red, green, blue) per color. Only available
+ *   in the palettized format.
+ * - Pixel data row by row, top to bottom, without padding. Every pixel is
+ *   either a 1 byte palette index or 3 bytes (red, green, blue).
+ *
+ * Images with up to 256 colors are stored palettized, if it is smaller.
+ */
+class RawImgLoader
+{
+public:
+
+    /**
+     * Construct a new raw image loader object.
+     */
+    RawImgLoader()
+    {
+    }
+
+    /**
+     * Destroy the raw image loader object.
+     */
+    ~RawImgLoader()
+    {
+    }
+
+    /**
+     * Possible return values with more information.
+     */
+    enum Ret
+    {
+        RET_OK = 0,                     /**< Successful */
+        RET_FILE_NOT_FOUND,             /**< File not found. */
+        RET_FILE_FORMAT_INVALID,        /**< Invalid file format. */
+        RET_FILE_FORMAT_UNSUPPORTED,    /**< File format is not supported. */
+        RET_FILE_OUTDATED,              /**< File was created from a different source. */
+        RET_IMG_TOO_BIG                 /**< Image size is too big. */
+    };
+
+    /** File extension of raw image files. */
+    static const char*  FILE_EXT;
+
+    /**
+     * Load raw image from file system to bitmap buffer.
+     *
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[in] sourceId  Identifies the source the raw image was created from.
+     * @param[out] bitmap   Bitmap buffer
+     *
+     * @return If successful, it will return RET_OK. See Ret type for more informations.
+     */
+    Ret load(FS& fs, const String& fileName, uint32_t sourceId, YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Save bitmap buffer as raw image to file system.
+     * A incomplete written file is removed.
+     *
+     * @param[in] fs        File system
+     * @param[in] fileName  Name of the file
+     * @param[in] sourceId  Identifies the source the raw image is created from.
+     * @param[in] bitmap    Bitmap buffer
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool save(FS& fs, const String& fileName, uint32_t sourceId, const YAGfxDynamicBitmap& bitmap);
+
+    /**
+     * Get the name of the raw image file, which caches the given image file.
+     * The file extension is replaced, to keep the file name length.
+     *
+     * @param[in] fileName  Name of the image file
+     *
+     * @return Name of the raw image file
+     */
+    static String getCacheFileName(const String& fileName);
+
+private:
+
+    /** Max. number of palette colors. */
+    static const uint16_t   PALETTE_SIZE    = 256U;
+
+    /**
+     * Create the color palette of the bitmap.
+     *
+     * @param[in] bitmap    Bitmap buffer
+     * @param[out] palette  Color palette with PALETTE_SIZE entries in RGB24 format
+     *
+     * @return Number of palette colors. If the bitmap has more colors than
+     *         the palette can hold, it will return 0.
+     */
+    uint16_t createPalette(const YAGfxDynamicBitmap& bitmap, uint32_t* palette);
+
+    /**
+     * Get the palette index of a color.
+     *
+     * @param[in] palette   Color palette in RGB24 format
+     * @param[in] colors    Number of palette colors
+     * @param[in] color     Color in RGB24 format
+     *
+     * @return Palette index. If the color is not in the palette, it will return colors.
+     */
+    uint16_t getPaletteIndex(const uint32_t* palette, uint16_t colors, uint32_t color) const;
+
+    /**
+     * Write the palette and the pixel data.
+     *
+     * @param[in] fd        File descriptor
+     * @param[in] bitmap    Bitmap buffer
+     * @param[in] palette   Color palette in RGB24 format or nullptr if not palettized
+     * @param[in] colors    Number of palette colors
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool writePixels(File& fd, const YAGfxDynamicBitmap& bitmap, const uint32_t* palette, uint16_t colors);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __RAW_IMG_LOADER_H__ */
+
+/** @} */
\ No newline at end of file
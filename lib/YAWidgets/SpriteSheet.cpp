@@ -93,7 +93,7 @@ bool SpriteSheet::loadTexture(FS& fs, const String& fileName, uint16_t frameWidt
     {
         BmpImgLoader loader;
 
-        if (BmpImgLoader::RET_OK == loader.load(fs, fileName, m_texture))
+        if (BmpImgLoader::RET_OK == loader.loadCached(fs, fileName, m_texture))
         {
             /* The frame size must be lower or equal to the texture size. */
             if ((m_texture.getWidth() >= frameWidth) &&
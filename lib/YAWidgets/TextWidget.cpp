@@ -143,6 +143,7 @@ void TextWidget::prepareNewText(YAGfx& gfx)
                 m_formatStr     = m_formatStrNew;
                 m_scrollInfo    = m_scrollInfoNew;
                 m_handleNewText = false;
+                m_textRun.release();
             }
             else
             /* New text will be scrolling, starting outside the display. */
@@ -219,13 +220,13 @@ void TextWidget::paint(YAGfx& gfx)
 
     /* Show current text. */
     m_gfxText.setTextCursorPos(m_posX + m_scrollInfo.offset, cursorY);
-    show(gfx, m_formatStr, m_scrollInfo.isEnabled);
+    showText(gfx, m_formatStr, m_scrollInfo.isEnabled, m_textRun);
 
     /* Show new text. */
     if (true == m_handleNewText)
     {
         m_gfxText.setTextCursorPos(m_posX + m_scrollInfoNew.offset, cursorY);
-        show(gfx, m_formatStrNew, m_scrollInfoNew.isEnabled);
+        showText(gfx, m_formatStrNew, m_scrollInfoNew.isEnabled, m_textRunNew);
     }
 
     /* Is it time to scroll the text(s) again? */
@@ -268,6 +269,7 @@ void TextWidget::paint(YAGfx& gfx)
                 m_handleNewText = false;
                 m_formatStr     = m_formatStrNew;
                 m_scrollingCnt  = 0U;
+                m_textRun.release();
 
                 /* If the new text can be shown static, it must be stopped scrolling  now. */
                 if (true == m_scrollInfoNew.stopAtDest)
@@ -444,6 +446,48 @@ void TextWidget::show(YAGfx& gfx, const String& formatStr, bool isScrolling)
     return;
 }
 
+void TextWidget::showText(YAGfx& gfx, const String& formatStr, bool isScrolling, YATextRun& textRun)
+{
+    if (false == isScrolling)
+    {
+        show(gfx, formatStr, false);
+    }
+    else
+    {
+        int16_t         cursorX     = m_gfxText.getTextCursorPosX();
+        int16_t         cursorY     = m_gfxText.getTextCursorPosY();
+        const int16_t   BASELINE    = m_gfxText.getFont().getHeight() - 1;
+
+        /* Rasterize the text once, with the text cursor on the baseline. */
+        if (false == textRun.isAllocated())
+        {
+            String      str         = removeFormatTags(formatStr);
+            uint16_t    textWidth   = 0U;
+            uint16_t    textHeight  = 0U;
+
+            if ((true == m_gfxText.getTextBoundingBox(gfx.getWidth(), gfx.getHeight(), str.c_str(), textWidth, textHeight)) &&
+                (true == textRun.create(textWidth, textHeight)))
+            {
+                m_gfxText.setTextCursorPos(0, BASELINE);
+                show(textRun, formatStr, true);
+                m_gfxText.setTextCursorPos(cursorX, cursorY);
+            }
+        }
+
+        if (true == textRun.isAllocated())
+        {
+            textRun.draw(gfx, cursorX, cursorY - BASELINE);
+        }
+        /* Not enough memory for the text run. */
+        else
+        {
+            show(gfx, formatStr, true);
+        }
+    }
+
+    return;
+}
+
 bool TextWidget::handleColor(YAGfx* gfx, YAGfxText* gfxText, bool noAction, const String& formatStr, bool isScrolling, uint8_t& overstep) const
 {
     bool status = false;
@@ -49,6 +49,7 @@
 #include <YAColor.h>
 #include <YAFont.h>
 #include <YAGfxText.h>
+#include <YATextRun.h>
 #include <SimpleTimer.hpp>
 
 /******************************************************************************
@@ -72,6 +73,9 @@
  * - "\\lalign" : Alignment left
  * - "\\ralign" : Alignment right
  * - "\\calign" : Alignment center
+ *
+ * A scrolling text is rasterized once into a text run. Afterwards every
+ * scroll step only draws the text run with another offset.
  */
 class TextWidget : public Widget
 {
@@ -91,7 +95,9 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_scrollTimer(),
+        m_textRun(),
+        m_textRunNew()
     {
     }
 
@@ -113,7 +119,9 @@ public:
         m_gfxText(DEFAULT_FONT, DEFAULT_TEXT_COLOR),
         m_scrollingCnt(0U),
         m_scrollOffset(0),
-        m_scrollTimer()
+        m_scrollTimer(),
+        m_textRun(),
+        m_textRunNew()
     {
     }
 
@@ -133,8 +141,11 @@ public:
         m_gfxText(widget.m_gfxText),
         m_scrollingCnt(widget.m_scrollingCnt),
         m_scrollOffset(widget.m_scrollOffset),
-        m_scrollTimer(widget.m_scrollTimer)
+        m_scrollTimer(widget.m_scrollTimer),
+        m_textRun(),
+        m_textRunNew()
     {
+        /* The text runs are not copied, they are rasterized again on demand. */
     }
 
     /**
@@ -165,6 +176,9 @@ public:
             m_scrollingCnt          = widget.m_scrollingCnt;
             m_scrollOffset          = widget.m_scrollOffset;
             m_scrollTimer           = widget.m_scrollTimer;
+
+            m_textRun.release();
+            m_textRunNew.release();
         }
 
         return *this;
@@ -189,6 +203,8 @@ public:
             {
                 m_formatStrNew          = formatStr;
                 m_isNewTextAvailable    = true;
+
+                m_textRunNew.release();
             }
         }
 
@@ -223,6 +239,11 @@ public:
     void setTextColor(const Color& color)
     {
         m_gfxText.setTextColor(color);
+
+        /* The rasterized texts contain the old color. */
+        m_textRun.release();
+        m_textRunNew.release();
+
         return;
     }
 
@@ -246,6 +267,10 @@ public:
         m_gfxText.setFont(font);
         m_isNewTextAvailable = true;
 
+        /* The rasterized texts contain the old font. */
+        m_textRun.release();
+        m_textRunNew.release();
+
         return;
     }
 
@@ -360,6 +385,8 @@ private:
     uint32_t        m_scrollingCnt;         /**< Counts how often a text was complete scrolled. */
     int16_t         m_scrollOffset;         /**< Pixel offset of cursor x position, used for scrolling. */
     SimpleTimer     m_scrollTimer;          /**< Timer, used for scrolling */
+    YATextRun       m_textRun;              /**< Rasterized current text, used while scrolling. */
+    YATextRun       m_textRunNew;           /**< Rasterized new text, used while scrolling. */
 
     static KeywordHandler   m_keywordHandlers[];    /**< List of all supported keyword handlers. */
     static uint32_t         m_scrollPause;          /**< Pause in ms, between each scroll movement. */
@@ -398,6 +425,18 @@ private:
      */
     void show(YAGfx& gfx, const String& formatStr, bool isScrolling);
 
+    /**
+     * Show formatted text at the current text cursor position.
+     * A scrolling text is rasterized only once into the text run, afterwards
+     * only the text run is drawn. A static text is shown directly.
+     *
+     * @param[in] gfx           Graphics, used to draw the characters
+     * @param[in] formatStr     String which contains format tags
+     * @param[in] isScrolling   Is text scrolling or not.
+     * @param[in,out] textRun   Text run, which contains the rasterized text.
+     */
+    void showText(YAGfx& gfx, const String& formatStr, bool isScrolling, YATextRun& textRun);
+
     /**
      * Handles the keyword for color changes.
      *
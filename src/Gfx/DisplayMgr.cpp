@@ -42,10 +42,6 @@
 #include <ArduinoJson.h>
 #include <Util.h>
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-#include <StatisticValue.hpp>
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
@@ -58,21 +54,6 @@
  * Types and classes
  *****************************************************************************/
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-
-/**
- * A collection of statistics, which are interesting for debugging purposes.
- */
-struct Statistics
-{
-    StatisticValue<uint32_t, 0U, 10U>   pluginProcessing;
-    StatisticValue<uint32_t, 0U, 10U>   displayUpdate;
-    StatisticValue<uint32_t, 0U, 10U>   total;
-    StatisticValue<uint32_t, 0U, 10U>   refreshPeriod;
-};
-
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
@@ -129,6 +110,21 @@ bool DisplayMgr::begin()
         }
     }
 
+    /* Statistics enabled by default? */
+    if ((true == m_isStatisticsEnabled) &&
+        (nullptr == m_pluginStatistics) &&
+        (0U < m_maxSlots))
+    {
+        m_pluginStatistics = new(std::nothrow) PluginStatistics[m_maxSlots];
+
+        if (nullptr == m_pluginStatistics)
+        {
+            m_isStatisticsEnabled = false;
+
+            LOG_WARNING("Couldn't allocate plugin statistics.");
+        }
+    }
+
     /* Allocate framebuffer memory. */
     for(idx = 0U; idx < UTIL_ARRAY_NUM(m_framebuffers); ++idx)
     {
@@ -148,6 +144,17 @@ bool DisplayMgr::begin()
         m_selectedFrameBuffer = &m_framebuffers[0U];
     }
 
+    /* Allocate snapshot memory for framebuffer copies. */
+    if (0U == m_snapshot.getLength())
+    {
+        size_t length = static_cast<size_t>(Display::getInstance().getWidth()) * static_cast<size_t>(Display::getInstance().getHeight());
+
+        if (false == m_snapshot.create(length))
+        {
+            LOG_WARNING("Couldn't create framebuffer snapshot.");
+        }
+    }
+
     /* Not started yet? */
     if ((nullptr == m_taskHandle) &&
         (nullptr != m_slots))
@@ -248,6 +255,7 @@ void DisplayMgr::setBrightness(uint8_t level)
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     BrightnessCtrl::getInstance().setBrightness(level);
+    wakeUp();
 
     return;
 }
@@ -262,7 +270,7 @@ uint8_t DisplayMgr::getBrightness(void)
     return brightness;
 }
 
-uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
+uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId, bool isStartDeferred)
 {
     if (nullptr == plugin)
     {
@@ -288,10 +296,13 @@ uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
                 {
                     slotId = SLOT_ID_INVALID;
                 }
+                else if (false == isStartDeferred)
+                {
+                    startPluginInSlot(slotId);
+                }
                 else
                 {
-                    LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
-                    plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+                    LOG_INFO("Start of plugin %s (UID %u) in slot %u deferred.", plugin->getName(), plugin->getUID(), slotId);
                 }
             }
             else
@@ -310,10 +321,13 @@ uint8_t DisplayMgr::installPlugin(IPluginMaintenance* plugin, uint8_t slotId)
             {
                 slotId = SLOT_ID_INVALID;
             }
+            else if (false == isStartDeferred)
+            {
+                startPluginInSlot(slotId);
+            }
             else
             {
-                LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
-                plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+                LOG_INFO("Start of plugin %s (UID %u) in slot %u deferred.", plugin->getName(), plugin->getUID(), slotId);
             }
         }
         else
@@ -352,8 +366,13 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
                     m_selectedPlugin = nullptr;
                 }
 
-                LOG_INFO("Stop plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
-                plugin->stop();
+                /* A plugin, whose start was deferred, was never started. */
+                if (true == m_slots[slotId].isStarted())
+                {
+                    LOG_INFO("Stop plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
+                    plugin->stop();
+                }
+
                 if (false == m_slots[slotId].setPlugin(nullptr))
                 {
                     LOG_FATAL("Internal error.");
@@ -378,6 +397,60 @@ bool DisplayMgr::uninstallPlugin(IPluginMaintenance* plugin)
     return status;
 }
 
+bool DisplayMgr::startPlugin(IPluginMaintenance* plugin)
+{
+    bool status = false;
+
+    if (nullptr != plugin)
+    {
+        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint8_t                     slotId = getSlotIdByPluginUID(plugin->getUID());
+
+        if (m_maxSlots > slotId)
+        {
+            if (false == m_slots[slotId].isStarted())
+            {
+                startPluginInSlot(slotId);
+            }
+
+            status = true;
+        }
+    }
+
+    return status;
+}
+
+bool DisplayMgr::startNextPlugin()
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        isStarted   = false;
+    uint8_t                     count       = 0U;
+    uint8_t                     slotId      = 0U;
+
+    /* Start with the slot, which is scheduled next. Like nextSlot(), start
+     * with the first slot if none is selected yet.
+     */
+    if (m_maxSlots > m_selectedSlot)
+    {
+        slotId = (m_selectedSlot + 1U) % m_maxSlots;
+    }
+
+    while((false == isStarted) && (m_maxSlots > count))
+    {
+        if ((false == m_slots[slotId].isEmpty()) &&
+            (false == m_slots[slotId].isStarted()))
+        {
+            startPluginInSlot(slotId);
+            isStarted = true;
+        }
+
+        ++count;
+        slotId = (slotId + 1U) % m_maxSlots;
+    }
+
+    return isStarted;
+}
+
 String DisplayMgr::getPluginAliasName(uint16_t uid)
 {
     String                      alias;
@@ -470,6 +543,7 @@ void DisplayMgr::activatePlugin(IPluginMaintenance* plugin)
         if (m_maxSlots > slotId)
         {
             m_requestedPlugin = plugin;
+            wakeUp();
         }
     }
 
@@ -487,6 +561,7 @@ void DisplayMgr::activateNextSlot()
         if (true == m_slotTimer.isTimerRunning())
         {
             m_slotTimer.start(0U);
+            wakeUp();
         }
     }
 
@@ -537,11 +612,9 @@ bool DisplayMgr::movePluginToSlot(IPluginMaintenance* plugin, uint8_t slotId)
             Slot*                       dstSlot = &m_slots[slotId];
             MutexGuard<MutexRecursive>  guard(m_mutex);
 
-            if (false == dstSlot->isLocked())
+            /* The plugins keep their start state. */
+            if (true == dstSlot->swapPlugin(*srcSlot))
             {
-                srcSlot->setPlugin(dstSlot->getPlugin());
-                dstSlot->setPlugin(plugin);
-
                 /* Is one of the moved plugins selected at the moment? */
                 if ((m_selectedPlugin == srcSlot->getPlugin()) ||
                     (m_selectedPlugin == dstSlot->getPlugin()))
@@ -640,36 +713,138 @@ void DisplayMgr::getFBCopy(uint32_t* fb, size_t length, uint8_t* slotId)
     if ((nullptr != fb) &&
         (0 < length))
     {
-        IDisplay&                   display = Display::getInstance();
-        int16_t                     x       = 0;
-        int16_t                     y       = 0;
-        size_t                      index   = 0;
-        MutexGuard<MutexRecursive>  guard(m_mutex);
+        uint32_t info = SLOT_ID_INVALID;
 
-        /* Copy framebuffer after it is completely updated. */
-        for(y = 0; y < display.getHeight(); ++y)
+        /* No frame completed yet? */
+        if (false == m_snapshot.read(fb, length, info))
         {
-            for(x = 0; x < display.getWidth(); ++x)
-            {
-                fb[index] = display.getColor(x, y);
-                ++index;
+            memset(fb, 0, length * sizeof(uint32_t));
+            info = SLOT_ID_INVALID;
+        }
 
-                if (length <= index)
-                {
-                    break;
-                }
+        if (nullptr != slotId)
+        {
+            *slotId = static_cast<uint8_t>(info);
+        }
+    }
+
+    return;
+}
+
+bool DisplayMgr::enableStatistics(bool enable)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        status  = true;
+
+    if (true == enable)
+    {
+        if ((nullptr == m_pluginStatistics) &&
+            (0U < m_maxSlots))
+        {
+            m_pluginStatistics = new(std::nothrow) PluginStatistics[m_maxSlots];
+
+            if (nullptr == m_pluginStatistics)
+            {
+                status = false;
             }
         }
 
-        if (nullptr != slotId)
+        if (true == status)
+        {
+            resetStatistics();
+
+            m_isStatisticsEnabled = true;
+        }
+    }
+    else
+    {
+        m_isStatisticsEnabled = false;
+
+        if (nullptr != m_pluginStatistics)
+        {
+            delete[] m_pluginStatistics;
+            m_pluginStatistics = nullptr;
+        }
+    }
+
+    return status;
+}
+
+bool DisplayMgr::isStatisticsEnabled()
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    return m_isStatisticsEnabled;
+}
+
+void DisplayMgr::resetStatistics()
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     slotId  = 0U;
+
+    m_statistics.fade.reset();
+    m_statistics.show.reset();
+    m_statistics.waitReady.reset();
+    m_statistics.total.reset();
+    m_statistics.refreshPeriod.reset();
+
+    if (nullptr != m_pluginStatistics)
+    {
+        for(slotId = 0U; slotId < m_maxSlots; ++slotId)
         {
-            *slotId = m_selectedSlot;
+            m_pluginStatistics[slotId].process.reset();
+            m_pluginStatistics[slotId].update.reset();
         }
     }
 
     return;
 }
 
+bool DisplayMgr::getStatistics(Statistics& statistics)
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    if (true == m_isStatisticsEnabled)
+    {
+        statistics = m_statistics;
+    }
+
+    return m_isStatisticsEnabled;
+}
+
+bool DisplayMgr::getPluginStatistics(uint8_t slotId, PluginStatistics& statistics)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        status  = false;
+
+    if ((true == m_isStatisticsEnabled) &&
+        (nullptr != m_pluginStatistics) &&
+        (m_maxSlots > slotId))
+    {
+        statistics  = m_pluginStatistics[slotId];
+        status      = true;
+    }
+
+    return status;
+}
+
+bool DisplayMgr::getPluginStartup(uint8_t slotId, PluginStartup& startup)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        status  = false;
+
+    if ((m_maxSlots > slotId) &&
+        (false == m_slots[slotId].isEmpty()))
+    {
+        startup.isStarted       = m_slots[slotId].isStarted();
+        startup.duration        = m_slots[slotId].getStartDuration();
+        startup.firstActivation = m_slots[slotId].getFirstActivation();
+        status                  = true;
+    }
+
+    return status;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -695,9 +870,22 @@ DisplayMgr::DisplayMgr() :
     m_fadeLinearEffect(),
     m_fadeMoveXEffect(),
     m_fadeMoveYEffect(),
+    m_fadeCrossEffect(),
     m_fadeEffect(&m_fadeLinearEffect),
     m_fadeEffectIndex(FADE_EFFECT_LINEAR),
-    m_fadeEffectUpdate(false)
+    m_fadeEffectUpdate(false),
+    m_isFrameBufferShown(false),
+    m_showDuration(0U),
+    m_shownFrameBuffer(nullptr),
+    m_shownBrightness(0U),
+    m_skippedFrames(0U),
+    m_snapshot(),
+    m_snapshotSlot(SLOT_ID_INVALID),
+    m_isStatisticsEnabled(0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS),
+    m_statistics(),
+    m_pluginStatistics(nullptr),
+    m_nextPluginUpdate(0U),
+    m_isPluginUpdateForced(false)
 {
 }
 
@@ -748,6 +936,21 @@ uint8_t DisplayMgr::nextSlot(uint8_t slotId)
     return slotId;
 }
 
+void DisplayMgr::startPluginInSlot(uint8_t slotId)
+{
+    IPluginMaintenance* plugin      = m_slots[slotId].getPlugin();
+    uint32_t            timestamp   = micros();
+    uint32_t            duration    = 0U;
+
+    LOG_INFO("Start plugin %s (UID %u) in slot %u.", plugin->getName(), plugin->getUID(), slotId);
+    plugin->start(Display::getInstance().getWidth(), Display::getInstance().getHeight());
+
+    duration = micros() - timestamp;
+    m_slots[slotId].setStarted(duration);
+
+    LOG_INFO("Plugin %s (UID %u) started in %u us.", plugin->getName(), plugin->getUID(), duration);
+}
+
 void DisplayMgr::startFadeOut()
 {
     /* Select next framebuffer and keep old content, until
@@ -770,8 +973,10 @@ void DisplayMgr::startFadeOut()
     }
 }
 
-void DisplayMgr::fadeInOut(YAGfx& dst)
+bool DisplayMgr::fadeInOut(YAGfx& dst)
 {
+    bool isFinishedFrame = false;
+
     if ((nullptr != m_selectedFrameBuffer) &&
         (nullptr != m_fadeEffect))
     {
@@ -787,33 +992,56 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
             prevFb = &m_framebuffers[FB_ID_0];
         }
 
-        /* Continously update the current canvas with its framebuffer. */
-        if (nullptr != m_selectedPlugin)
+        /* Update the current canvas with its framebuffer, according to the plugin update period. */
+        if ((nullptr != m_selectedPlugin) &&
+            (true == isPluginUpdateDue()))
         {
+            uint32_t timestamp = micros();
+
             m_selectedPlugin->update(*m_selectedFrameBuffer);
+
+            updatePluginStatistics(m_selectedSlot, false, micros() - timestamp);
         }
 
         /* Handle fading */
         switch(m_displayFadeState)
         {
-        /* No fading at all */
+        /* No fading at all, the framebuffer can be shown directly. */
         case FADE_IDLE:
-            dst.drawBitmap(0, 0, *m_selectedFrameBuffer);
+            isFinishedFrame = true;
             break;
 
         /* Fade new display content in */
         case FADE_IN:
-            if (true == m_fadeEffect->fadeIn(dst, *prevFb, *m_selectedFrameBuffer))
             {
-                m_displayFadeState = FADE_IDLE;
+                uint32_t timestamp = micros();
+
+                if (true == m_fadeEffect->fadeIn(dst, *prevFb, *m_selectedFrameBuffer))
+                {
+                    m_displayFadeState = FADE_IDLE;
+                }
+
+                if (true == m_isStatisticsEnabled)
+                {
+                    m_statistics.fade.update(micros() - timestamp);
+                }
             }
             break;
 
         /* Fade old display content out! */
         case FADE_OUT:
-            if (true == m_fadeEffect->fadeOut(dst, *prevFb, *m_selectedFrameBuffer))
             {
-                m_displayFadeState = FADE_IN;
+                uint32_t timestamp = micros();
+
+                if (true == m_fadeEffect->fadeOut(dst, *prevFb, *m_selectedFrameBuffer))
+                {
+                    m_displayFadeState = FADE_IN;
+                }
+
+                if (true == m_isStatisticsEnabled)
+                {
+                    m_statistics.fade.update(micros() - timestamp);
+                }
             }
             break;
 
@@ -822,13 +1050,63 @@ void DisplayMgr::fadeInOut(YAGfx& dst)
         }
     }
 
+    return isFinishedFrame;
+}
+
+void DisplayMgr::publishSnapshot(const YAGfx& src)
+{
+    uint32_t* pixels = m_snapshot.beginWrite();
+
+    /* If all snapshot buffers are in use by readers, the frame is dropped. */
+    if (nullptr != pixels)
+    {
+        const uint16_t  WIDTH   = src.getWidth();
+        const uint16_t  HEIGHT  = src.getHeight();
+        size_t          length  = m_snapshot.getLength();
+        size_t          index   = 0U;
+        int16_t         x       = 0;
+        int16_t         y       = 0;
+
+        for(y = 0; (y < HEIGHT) && (index < length); ++y)
+        {
+            const Color*    row     = src.getRow(y);
+            uint16_t        count   = WIDTH;
+
+            if ((length - index) < count)
+            {
+                count = static_cast<uint16_t>(length - index);
+            }
+
+            if (nullptr != row)
+            {
+                for(x = 0; x < count; ++x)
+                {
+                    pixels[index] = row[x];
+                    ++index;
+                }
+            }
+            else
+            {
+                for(x = 0; x < count; ++x)
+                {
+                    pixels[index] = src.getColor(x, y);
+                    ++index;
+                }
+            }
+        }
+
+        m_snapshot.endWrite(m_selectedSlot);
+        m_snapshotSlot = m_selectedSlot;
+    }
+
     return;
 }
 
 void DisplayMgr::process()
 {
-    IDisplay&                   display = Display::getInstance();
-    uint8_t                     index   = 0U;
+    IDisplay&                   display         = Display::getInstance();
+    uint8_t                     index           = 0U;
+    uint32_t                    timestampShow   = 0U;
     MutexGuard<MutexRecursive>  guard(m_mutex);
 
     /* Handle display brightness */
@@ -958,6 +1236,14 @@ void DisplayMgr::process()
             m_selectedPlugin    = m_slots[m_selectedSlot].getPlugin();
             duration            = m_slots[m_selectedSlot].getDuration();
 
+            /* Start the plugin on its first activation, if its start was deferred. */
+            if (false == m_slots[m_selectedSlot].isStarted())
+            {
+                startPluginInSlot(m_selectedSlot);
+            }
+
+            m_slots[m_selectedSlot].notifyActivation(millis());
+
             /* If plugin shall not be infinite active, start the slot timer. */
             if (0U != duration)
             {
@@ -973,6 +1259,12 @@ void DisplayMgr::process()
                 m_selectedPlugin->active(display);
             }
 
+            /* The plugin shall draw its content right after activation and
+             * the periodic updates start from now on.
+             */
+            m_isPluginUpdateForced  = true;
+            m_nextPluginUpdate      = millis() + m_selectedPlugin->getUpdatePeriod();
+
             LOG_INFO("Slot %u (%s) now active.", m_selectedSlot, m_selectedPlugin->getName());
         }
         /* No plugin is active, clear the display. */
@@ -1003,6 +1295,10 @@ void DisplayMgr::process()
             m_fadeEffect = &m_fadeMoveYEffect;
             break;
 
+        case FADE_EFFECT_CROSS:
+            m_fadeEffect = &m_fadeCrossEffect;
+            break;
+
         default:
             m_fadeEffect = nullptr;
             m_fadeEffectIndex = FADE_EFFECT_NO;
@@ -1017,21 +1313,34 @@ void DisplayMgr::process()
     {
         IPluginMaintenance* plugin = m_slots[index].getPlugin();
 
-        if (nullptr != plugin)
+        /* A plugin, whose start is deferred, is not processed yet. */
+        if ((nullptr != plugin) &&
+            (true == m_slots[index].isStarted()))
         {
+            uint32_t timestamp = micros();
+
             plugin->process();
+
+            updatePluginStatistics(index, true, micros() - timestamp);
         }
     }
 
+    m_isFrameBufferShown = false;
+
     /* Update display (main canvas available) */
     if (nullptr != m_selectedFrameBuffer)
     {
-        fadeInOut(display);
+        m_isFrameBufferShown = fadeInOut(display);
     }
     /* Update display (main canvas not available) */
-    else if (nullptr != m_selectedPlugin)
+    else if ((nullptr != m_selectedPlugin) &&
+             (true == isPluginUpdateDue()))
     {
+        uint32_t timestamp = micros();
+
         m_selectedPlugin->update(display);
+
+        updatePluginStatistics(m_selectedSlot, false, micros() - timestamp);
     }
     /* No plugin selected. */
     else
@@ -1041,7 +1350,197 @@ void DisplayMgr::process()
     }
 
     delay(1U);
-    display.show();
+
+    timestampShow = micros();
+
+    /* Show the selected framebuffer directly to avoid copying it to the display framebuffer first. */
+    if (true == m_isFrameBufferShown)
+    {
+        uint8_t brightness = BrightnessCtrl::getInstance().getBrightness();
+
+        /* If the same framebuffer is shown again, without any change in its
+         * content or in the display brightness, the physical display is
+         * already up to date.
+         */
+        if ((m_shownFrameBuffer == m_selectedFrameBuffer) &&
+            (m_shownBrightness == brightness) &&
+            (false == m_selectedFrameBuffer->isDirty()))
+        {
+            ++m_skippedFrames;
+
+            /* The content is the same, but it may belong to another slot now. */
+            if (m_snapshotSlot != m_selectedSlot)
+            {
+                publishSnapshot(*m_selectedFrameBuffer);
+            }
+        }
+        else
+        {
+            display.show(*m_selectedFrameBuffer);
+            publishSnapshot(*m_selectedFrameBuffer);
+            m_selectedFrameBuffer->clearDirty();
+
+            m_shownFrameBuffer  = m_selectedFrameBuffer;
+            m_shownBrightness   = brightness;
+        }
+    }
+    else
+    {
+        display.show();
+        publishSnapshot(display);
+
+        m_shownFrameBuffer = nullptr;
+    }
+
+    m_showDuration = micros() - timestampShow;
+
+    if (true == m_isStatisticsEnabled)
+    {
+        m_statistics.show.update(m_showDuration);
+    }
+
+    return;
+}
+
+void DisplayMgr::updatePluginStatistics(uint8_t slotId, bool isProcess, uint32_t duration)
+{
+    if ((true == m_isStatisticsEnabled) &&
+        (nullptr != m_pluginStatistics) &&
+        (m_maxSlots > slotId))
+    {
+        if (true == isProcess)
+        {
+            m_pluginStatistics[slotId].process.update(duration);
+        }
+        else
+        {
+            m_pluginStatistics[slotId].update.update(duration);
+        }
+    }
+
+    return;
+}
+
+bool DisplayMgr::isPluginUpdateDue()
+{
+    bool isDue = false;
+
+    if (nullptr != m_selectedPlugin)
+    {
+        uint32_t    updatePeriod    = m_selectedPlugin->getUpdatePeriod();
+        uint32_t    timestamp       = millis();
+
+        if ((true == m_isPluginUpdateForced) ||
+            (IPluginMaintenance::UPDATE_PERIOD_ALWAYS == updatePeriod))
+        {
+            isDue = true;
+        }
+        else if (IPluginMaintenance::UPDATE_PERIOD_ON_CHANGE == updatePeriod)
+        {
+            isDue = m_selectedPlugin->isUpdateRequired();
+        }
+        else if (0 <= static_cast<int32_t>(timestamp - m_nextPluginUpdate))
+        {
+            isDue = true;
+
+            m_nextPluginUpdate += updatePeriod;
+
+            /* If the deadline was missed, don't try to catch up. */
+            if (0 <= static_cast<int32_t>(timestamp - m_nextPluginUpdate))
+            {
+                m_nextPluginUpdate = timestamp + updatePeriod;
+            }
+        }
+        else
+        {
+            /* Nothing to do. */
+            ;
+        }
+
+        m_isPluginUpdateForced = false;
+    }
+
+    return isDue;
+}
+
+uint32_t DisplayMgr::getSleepTime(uint32_t duration)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint32_t                    period  = TASK_PERIOD;
+    uint32_t                    sleep   = 1U;
+
+    /* Sleep longer only if the display is idle. A pending slot change or
+     * a running fade effect requires the regular period.
+     */
+    if ((nullptr != m_selectedPlugin) &&
+        (nullptr == m_requestedPlugin) &&
+        (FADE_IDLE == m_displayFadeState) &&
+        (false == m_isPluginUpdateForced))
+    {
+        uint32_t updatePeriod = m_selectedPlugin->getUpdatePeriod();
+
+        if (IPluginMaintenance::UPDATE_PERIOD_ON_CHANGE == updatePeriod)
+        {
+            period = TASK_PERIOD_MAX;
+        }
+        else if (IPluginMaintenance::UPDATE_PERIOD_ALWAYS != updatePeriod)
+        {
+            int32_t remaining = static_cast<int32_t>(m_nextPluginUpdate - millis());
+
+            if (0 < remaining)
+            {
+                period = duration + static_cast<uint32_t>(remaining);
+            }
+
+            if (TASK_PERIOD > period)
+            {
+                period = TASK_PERIOD;
+            }
+            else if (TASK_PERIOD_MAX < period)
+            {
+                period = TASK_PERIOD_MAX;
+            }
+            else
+            {
+                ;
+            }
+        }
+        else
+        {
+            ;
+        }
+
+        /* Wake up in time for the slot change after the slot duration. */
+        if (true == m_slotTimer.isTimerRunning())
+        {
+            uint32_t slotPeriod = duration + m_slotTimer.getRemainingTime();
+
+            if (TASK_PERIOD > slotPeriod)
+            {
+                slotPeriod = TASK_PERIOD;
+            }
+
+            if (period > slotPeriod)
+            {
+                period = slotPeriod;
+            }
+        }
+    }
+
+    if (period > duration)
+    {
+        sleep = period - duration;
+    }
+
+    return sleep;
+}
+
+void DisplayMgr::wakeUp()
+{
+    if (nullptr != m_taskHandle)
+    {
+        (void)xTaskNotifyGive(m_taskHandle);
+    }
 
     return;
 }
@@ -1053,25 +1552,19 @@ void DisplayMgr::updateTask(void* parameters)
     if ((nullptr != tthis) &&
         (nullptr != tthis->m_xSemaphore))
     {
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-        Statistics      statistics;
-        SimpleTimer     statisticsLogTimer;
-        const uint32_t  STATISTICS_LOG_PERIOD   = 4000U;    /* [ms] */
-        uint32_t        timestampLastUpdate     = millis();
-
-        statisticsLogTimer.start(STATISTICS_LOG_PERIOD);
-
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+        uint32_t timestampLastUpdate = micros();
 
         (void)xSemaphoreTake(tthis->m_xSemaphore, portMAX_DELAY);
 
         while(false == tthis->m_taskExit)
         {
-            uint32_t    timestamp           = millis();
-            uint32_t    duration            = 0U;
-            uint32_t    timestampPhyUpdate  = millis();
-            uint32_t    durationPhyUpdate   = 0U;
-            bool        abort               = false;
+            uint32_t    timestamp               = millis();
+            uint32_t    timestampUs             = micros();
+            uint32_t    duration                = 0U;
+            uint32_t    timestampPhyUpdate      = millis();
+            uint32_t    timestampPhyUpdateUs    = 0U;
+            uint32_t    durationPhyUpdate       = 0U;
+            bool        abort                   = false;
 
             /* Observe the physical display refresh and limit the duration to 70% of refresh period. */
             const uint32_t  MAX_LOOP_TIME   = (TASK_PERIOD * 7U) / (10U);
@@ -1079,17 +1572,17 @@ void DisplayMgr::updateTask(void* parameters)
             /* Refresh display content periodically */
             tthis->process();
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.pluginProcessing.update(millis() - timestamp);
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
-
             /* Wait until the physical update is ready to avoid flickering
              * and artifacts on the display, because of e.g. webserver flash
              * access.
              */
-            timestampPhyUpdate = millis();
+            timestampPhyUpdate      = millis();
+            timestampPhyUpdateUs    = micros();
             while((false == Display::getInstance().isReady()) && (false == abort))
             {
+                /* Don't busy wait, the physical update takes several ms. */
+                delay(1U);
+
                 durationPhyUpdate = millis() - timestampPhyUpdate;
 
                 if (MAX_LOOP_TIME <= durationPhyUpdate)
@@ -1098,57 +1591,30 @@ void DisplayMgr::updateTask(void* parameters)
                 }
             }
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.displayUpdate.update(durationPhyUpdate);
-            statistics.total.update(statistics.pluginProcessing.getCurrent() + statistics.displayUpdate.getCurrent());
-
-            if (true == statisticsLogTimer.isTimeout())
+            if (true == tthis->m_isStatisticsEnabled)
             {
-                LOG_DEBUG("[ %2u, %2u, %2u ]", 
-                    statistics.refreshPeriod.getMin(),
-                    statistics.refreshPeriod.getAvg(),
-                    statistics.refreshPeriod.getMax()
-                );
-                
-                LOG_DEBUG("[ %2u, %2u, %2u ] [ %2u, %2u, %2u ] [ %2u, %2u, %2u ]",
-                    statistics.pluginProcessing.getMin(),
-                    statistics.pluginProcessing.getAvg(),
-                    statistics.pluginProcessing.getMax(),
-                    statistics.displayUpdate.getMin(),
-                    statistics.displayUpdate.getAvg(),
-                    statistics.displayUpdate.getMax(),
-                    statistics.total.getMin(),
-                    statistics.total.getAvg(),
-                    statistics.total.getMax()
-                );
-
-                /* Reset the statistics to get a new min./max. determination. */
-                statistics.pluginProcessing.reset();
-                statistics.displayUpdate.reset();
-                statistics.total.reset();
-                statistics.refreshPeriod.reset();
-
-                statisticsLogTimer.restart();
+                uint32_t                    timestampEnd    = micros();
+                MutexGuard<MutexRecursive>  guard(tthis->m_mutex);
+
+                tthis->m_statistics.waitReady.update(timestampEnd - timestampPhyUpdateUs);
+                tthis->m_statistics.total.update(timestampEnd - timestampUs);
             }
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
 
             /* Calculate overall duration */
             duration = millis() - timestamp;
 
-            /* Give other tasks a chance. */
-            if (TASK_PERIOD <= duration)
-            {
-                delay(1U);
-            }
-            else
+            /* Sleep until the next cycle, but wake up earlier if requested. */
+            (void)ulTaskNotifyTake(pdTRUE, tthis->getSleepTime(duration) / portTICK_PERIOD_MS);
+
+            if (true == tthis->m_isStatisticsEnabled)
             {
-                delay(TASK_PERIOD - duration);
+                uint32_t                    timestampNow    = micros();
+                MutexGuard<MutexRecursive>  guard(tthis->m_mutex);
+
+                tthis->m_statistics.refreshPeriod.update(timestampNow - timestampLastUpdate);
             }
 
-#if (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS)
-            statistics.refreshPeriod.update(millis() - timestampLastUpdate);
-            timestampLastUpdate = millis();
-#endif /* (0 != CONFIG_DISPLAY_MGR_ENABLE_STATISTICS) */
+            timestampLastUpdate = micros();
         }
 
         (void)xSemaphoreGive(tthis->m_xSemaphore);
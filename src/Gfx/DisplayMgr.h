@@ -40,6 +40,15 @@
  * Compile Switches
  *****************************************************************************/
 
+/**
+ * Initial state of the display timing statistics, which can be switched at runtime.
+ * 0: disabled
+ * 1: enabled
+ */
+#ifndef CONFIG_DISPLAY_MGR_ENABLE_STATISTICS
+#define CONFIG_DISPLAY_MGR_ENABLE_STATISTICS    (0)
+#endif  /* CONFIG_DISPLAY_MGR_ENABLE_STATISTICS */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -50,8 +59,11 @@
 #include <FadeLinear.h>
 #include <FadeMoveX.h>
 #include <FadeMoveY.h>
+#include <FadeCross.h>
 #include <Mutex.hpp>
 #include <YAGfxBitmap.h>
+#include <FrameSnapshot.h>
+#include <StatisticHistogram.hpp>
 
 #include "IPluginMaintenance.hpp"
 #include "Slot.h"
@@ -80,9 +92,81 @@ public:
         FADE_EFFECT_LINEAR, /**< Linear dimming fade effect. */
         FADE_EFFECT_MOVE_X, /**< Moving fade effect into the direction of negative x-coordinates. */
         FADE_EFFECT_MOVE_Y, /**< Moving fade effect into the direction of negative y-coordinates. */
+        FADE_EFFECT_CROSS,  /**< Cross fade effect, which blends the old and new content. */
         FADE_EFFECT_COUNT   /**< Number of fade effects. */
     };
 
+    /** Number of buckets of a timing statistic histogram. */
+    static const uint8_t        STATISTICS_BUCKETS          = 10U;
+
+    /** Upper limit of the first timing statistic histogram bucket in us. */
+    static const uint32_t       STATISTICS_FIRST_LIMIT      = 64U;
+
+    /** Timing statistic in us, with min., moving average, max. and histogram. */
+    typedef StatisticHistogram<uint32_t, 0U, 10U, STATISTICS_BUCKETS> TimingStatistic;
+
+    /**
+     * Timing statistics of the display update task.
+     */
+    struct Statistics
+    {
+        TimingStatistic fade;           /**< Fade effect duration */
+        TimingStatistic show;           /**< Physical display update request (show) duration */
+        TimingStatistic waitReady;      /**< Duration of waiting for the physical display update to finish */
+        TimingStatistic total;          /**< Duration of a single display update task cycle, without the idle time */
+        TimingStatistic refreshPeriod;  /**< Period of the display update task cycle */
+
+        /**
+         * Constructs the statistics in initial state.
+         */
+        Statistics() :
+            fade(STATISTICS_FIRST_LIMIT),
+            show(STATISTICS_FIRST_LIMIT),
+            waitReady(STATISTICS_FIRST_LIMIT),
+            total(STATISTICS_FIRST_LIMIT),
+            refreshPeriod(STATISTICS_FIRST_LIMIT)
+        {
+        }
+    };
+
+    /**
+     * Timing statistics of a plugin.
+     */
+    struct PluginStatistics
+    {
+        TimingStatistic process;        /**< Duration of the plugin process() call */
+        TimingStatistic update;         /**< Duration of the plugin update() call */
+
+        /**
+         * Constructs the plugin statistics in initial state.
+         */
+        PluginStatistics() :
+            process(STATISTICS_FIRST_LIMIT),
+            update(STATISTICS_FIRST_LIMIT)
+        {
+        }
+    };
+
+    /**
+     * Startup information of a plugin.
+     */
+    struct PluginStartup
+    {
+        bool        isStarted;          /**< Is the plugin started? */
+        uint32_t    duration;           /**< Duration in us, how long the plugin start took. */
+        uint32_t    firstActivation;    /**< Timestamp in ms since boot of the first activation. 0 if never active. */
+
+        /**
+         * Constructs the plugin startup information in initial state.
+         */
+        PluginStartup() :
+            isStarted(false),
+            duration(0U),
+            firstActivation(0U)
+        {
+        }
+    };
+
     /**
      * Get display manager instance.
      *
@@ -145,12 +229,35 @@ public:
      * If a invalid slot id is given, the plugin will be installed in the next
      * available slot.
      *
-     * @param[in] plugin    Plugin which to install
-     * @param[in] slotId    Slot id
+     * The plugin is started right after installation. If its start is deferred,
+     * it will be started on its first activation, on its first use via
+     * startPlugin() or in the background via startNextPlugin().
+     *
+     * @param[in] plugin            Plugin which to install
+     * @param[in] slotId            Slot id
+     * @param[in] isStartDeferred   Defer the plugin start (true) or not (false).
      *
      * @return Returns slot id. If it fails, it will return SLOT_ID_INVALID.
      */
-    uint8_t installPlugin(IPluginMaintenance* plugin, uint8_t slotId = SLOT_ID_INVALID);
+    uint8_t installPlugin(IPluginMaintenance* plugin, uint8_t slotId = SLOT_ID_INVALID, bool isStartDeferred = false);
+
+    /**
+     * Start a installed plugin, whose start was deferred.
+     * If the plugin is already started, nothing happens.
+     *
+     * @param[in] plugin    Plugin which to start
+     *
+     * @return If the plugin is installed and started, it will return true otherwise false.
+     */
+    bool startPlugin(IPluginMaintenance* plugin);
+
+    /**
+     * Start the next installed plugin in schedule order, whose start was deferred.
+     * Only one plugin is started per call, to keep the display task responsive.
+     *
+     * @return If a plugin was started, it will return true otherwise false.
+     */
+    bool startNextPlugin();
 
     /**
      * Remove plugin from slot.
@@ -275,6 +382,8 @@ public:
 
     /**
      * Get access to copy of framebuffer.
+     * The copy is taken from the last completed frame. It doesn't wait for
+     * the display update task and the display update task doesn't wait for it.
      *
      * @param[out] fb       Pointer to framebuffer copy
      * @param[out] length   Number of elements in the framebuffer copy
@@ -292,6 +401,68 @@ public:
         return m_maxSlots;
     }
 
+    /**
+     * Get the number of frames, which were not shown on the physical display,
+     * because the framebuffer content didn't change.
+     *
+     * @return Number of skipped frames since start.
+     */
+    uint32_t getSkippedFrames() const
+    {
+        return m_skippedFrames;
+    }
+
+    /**
+     * Enable/Disable the timing statistics.
+     * Enabling resets them.
+     *
+     * @param[in] enable    Enable (true) or disable (false)
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool enableStatistics(bool enable);
+
+    /**
+     * Are the timing statistics enabled?
+     *
+     * @return If enabled, it will return true otherwise false.
+     */
+    bool isStatisticsEnabled();
+
+    /**
+     * Reset the timing statistics.
+     */
+    void resetStatistics();
+
+    /**
+     * Get a copy of the display update task timing statistics.
+     *
+     * @param[out] statistics   Timing statistics
+     *
+     * @return If statistics are enabled, it will return true otherwise false.
+     */
+    bool getStatistics(Statistics& statistics);
+
+    /**
+     * Get a copy of the timing statistics of the plugin in the given slot.
+     *
+     * @param[in] slotId        Slot id
+     * @param[out] statistics   Plugin timing statistics
+     *
+     * @return If statistics are enabled and the slot id is valid, it will return true otherwise false.
+     */
+    bool getPluginStatistics(uint8_t slotId, PluginStatistics& statistics);
+
+    /**
+     * Get the startup information of the plugin in the given slot.
+     *
+     * @param[in] slotId    Slot id
+     * @param[out] startup  Plugin startup information
+     *
+     * @return If the slot id is valid and the slot contains a plugin, it will return true otherwise false.
+     */
+    bool getPluginStartup(uint8_t slotId, PluginStartup& startup);
+
     /** Invalid slot id. */
     static const uint8_t        SLOT_ID_INVALID     = UINT8_MAX;
 
@@ -301,6 +472,13 @@ public:
     /** Task period in ms */
     static const uint32_t       TASK_PERIOD         = 20U;
 
+    /**
+     * Max. task period in ms, used if the active plugin doesn't need to be
+     * updated in every task period. The process() method of all plugins is
+     * called with the task period too.
+     */
+    static const uint32_t       TASK_PERIOD_MAX     = 100U;
+
     /** MCU core where the task shall run */
     static const BaseType_t     TASK_RUN_CORE       = 1;
 
@@ -365,9 +543,22 @@ private:
     FadeLinear          m_fadeLinearEffect;             /**< Linear fade effect. */
     FadeMoveX           m_fadeMoveXEffect;              /**< Moving along x-axis fade effect. */
     FadeMoveY           m_fadeMoveYEffect;              /**< Moving along y-axis fade effect. */
+    FadeCross           m_fadeCrossEffect;              /**< Cross fade effect. */
     IFadeEffect*        m_fadeEffect;                   /**< The fade effect itself. */
     FadeEffect          m_fadeEffectIndex;              /**< Fade effect index to determine the next fade effect. */
     bool                m_fadeEffectUpdate;             /**< Flag to indicate that the fadeEffect was updated. */
+    bool                m_isFrameBufferShown;           /**< Flag to indicate that the selected framebuffer is shown directly, instead of the display framebuffer. */
+    uint32_t            m_showDuration;                 /**< Duration of the last physical display update request (show) in us. */
+    const YAGfxBitmap*  m_shownFrameBuffer;             /**< Framebuffer, which was shown directly the last time. nullptr if the display framebuffer was shown. */
+    uint8_t             m_shownBrightness;              /**< Display brightness, which was used to show the last frame. */
+    uint32_t            m_skippedFrames;                /**< Number of frames, which were not shown, because nothing changed. */
+    FrameSnapshot       m_snapshot;                     /**< Snapshot of the last completed frame, used for framebuffer copies. */
+    uint8_t             m_snapshotSlot;                 /**< Id of slot, from which the snapshot was taken. */
+    bool                m_isStatisticsEnabled;          /**< Are the timing statistics enabled? */
+    Statistics          m_statistics;                   /**< Display update task timing statistics */
+    PluginStatistics*   m_pluginStatistics;             /**< Timing statistics per slot, only available if statistics are enabled. */
+    uint32_t            m_nextPluginUpdate;             /**< Timestamp in ms, when the selected plugin shall be updated next. */
+    bool                m_isPluginUpdateForced;         /**< Update the selected plugin independent of its update period. */
 
     /**
      * Constructs the display manager.
@@ -399,10 +590,65 @@ private:
 
     /**
      * Fade display content in/out.
+     * If no fading is pending, the selected framebuffer is a finished frame,
+     * which can be shown directly without drawing it to the destination.
      *
      * @param[in] dst   Destination display
+     *
+     * @return If the selected framebuffer shall be shown directly, it will return true otherwise false.
+     */
+    bool fadeInOut(YAGfx& dst);
+
+    /**
+     * Publish the completed frame as snapshot for framebuffer copies.
+     *
+     * @param[in] src   Completed frame
+     */
+    void publishSnapshot(const YAGfx& src);
+
+    /**
+     * Start the plugin in the given slot and measure its start duration.
+     * The caller has to ensure that the slot contains a plugin.
+     *
+     * @param[in] slotId    Slot id
+     */
+    void startPluginInSlot(uint8_t slotId);
+
+    /**
+     * Update the timing statistics of the plugin in the given slot,
+     * if statistics are enabled.
+     *
+     * @param[in] slotId    Slot id
+     * @param[in] isProcess Duration of process() (true) or update() (false)
+     * @param[in] duration  Duration in us
+     */
+    void updatePluginStatistics(uint8_t slotId, bool isProcess, uint32_t duration);
+
+    /**
+     * Is it time to update the selected plugin, considering its update period?
+     * If yes, the next update deadline is determined.
+     *
+     * @return If the selected plugin shall be updated, it will return true otherwise false.
+     */
+    bool isPluginUpdateDue();
+
+    /**
+     * Get the time the display task can sleep until the next cycle.
+     * As long as the display is idle, it sleeps until the next update
+     * deadline of the selected plugin or the end of the slot duration,
+     * but not longer than TASK_PERIOD_MAX.
+     *
+     * @param[in] duration  Duration of the current cycle in ms
+     *
+     * @return Sleep time in ms
+     */
+    uint32_t getSleepTime(uint32_t duration);
+
+    /**
+     * Wake up the display task, e.g. because the display content shall
+     * change as soon as possible.
      */
-    void fadeInOut(YAGfx& dst);
+    void wakeUp();
 
     /**
      * Process the slots. This shall be called periodically in
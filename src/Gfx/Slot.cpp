@@ -69,7 +69,10 @@
 Slot::Slot() :
     m_plugin(nullptr),
     m_duration(DURATION_DEFAULT),
-    m_isLocked(false)
+    m_isLocked(false),
+    m_isStarted(false),
+    m_startDuration(0U),
+    m_firstActivation(0U)
 {
 }
 
@@ -93,7 +96,10 @@ bool Slot::setPlugin(IPluginMaintenance* plugin)
             m_plugin->setSlot(nullptr);
         }
 
-        m_plugin = plugin;
+        m_plugin            = plugin;
+        m_isStarted         = false;
+        m_startDuration     = 0U;
+        m_firstActivation   = 0U;
 
         if (nullptr != m_plugin)
         {
@@ -106,6 +112,44 @@ bool Slot::setPlugin(IPluginMaintenance* plugin)
     return status;
 }
 
+bool Slot::swapPlugin(Slot& other)
+{
+    bool status = false;
+
+    if ((false == m_isLocked) &&
+        (false == other.m_isLocked))
+    {
+        IPluginMaintenance* plugin          = m_plugin;
+        bool                isStarted       = m_isStarted;
+        uint32_t            startDuration   = m_startDuration;
+        uint32_t            firstActivation = m_firstActivation;
+
+        m_plugin                = other.m_plugin;
+        m_isStarted             = other.m_isStarted;
+        m_startDuration         = other.m_startDuration;
+        m_firstActivation       = other.m_firstActivation;
+
+        other.m_plugin          = plugin;
+        other.m_isStarted       = isStarted;
+        other.m_startDuration   = startDuration;
+        other.m_firstActivation = firstActivation;
+
+        if (nullptr != m_plugin)
+        {
+            m_plugin->setSlot(this);
+        }
+
+        if (nullptr != other.m_plugin)
+        {
+            other.m_plugin->setSlot(&other);
+        }
+
+        status = true;
+    }
+
+    return status;
+}
+
 bool Slot::isEmpty() const
 {
     return (nullptr == m_plugin) ? true : false;
@@ -136,6 +180,36 @@ bool Slot::isLocked() const
     return m_isLocked;
 }
 
+bool Slot::isStarted() const
+{
+    return m_isStarted;
+}
+
+void Slot::setStarted(uint32_t duration)
+{
+    m_isStarted     = true;
+    m_startDuration = duration;
+}
+
+uint32_t Slot::getStartDuration() const
+{
+    return m_startDuration;
+}
+
+void Slot::notifyActivation(uint32_t timestamp)
+{
+    if (0U == m_firstActivation)
+    {
+        /* Avoid 0, because it stands for "never active". */
+        m_firstActivation = (0U == timestamp) ? 1U : timestamp;
+    }
+}
+
+uint32_t Slot::getFirstActivation() const
+{
+    return m_firstActivation;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -83,6 +83,7 @@ public:
      * Set plugin to slot.
      * If slot is locked, unlock it first!
      * Remove plugin from slot, use nullptr as argument.
+     * The new plugin is considered as not started.
      *
      * @param[in] plugin Plugin
      *
@@ -90,6 +91,18 @@ public:
      */
     bool setPlugin(IPluginMaintenance* plugin);
 
+    /**
+     * Exchange the plugin with the plugin of the other slot. The start
+     * state moves together with the plugin, because a started plugin
+     * stays started.
+     * If one of the slots is locked, unlock it first!
+     *
+     * @param[in] other Other slot
+     *
+     * @return If successful it will return true otherwise false.
+     */
+    bool swapPlugin(Slot& other);
+
     /**
      * Is slot empty?
      *
@@ -128,14 +141,54 @@ public:
      */
     bool isLocked() const;
 
+    /**
+     * Is the plugin started?
+     * A plugin can be plugged in, but its start may be deferred.
+     *
+     * @return If the plugin is started, it will return true otherwise false.
+     */
+    bool isStarted() const;
+
+    /**
+     * Mark the plugin as started.
+     *
+     * @param[in] duration  Duration in us, how long the plugin start took.
+     */
+    void setStarted(uint32_t duration);
+
+    /**
+     * Get duration in us, how long the plugin start took.
+     *
+     * @return Start duration in us
+     */
+    uint32_t getStartDuration() const;
+
+    /**
+     * Notify the slot about the activation of its plugin.
+     * Only the timestamp of the first activation is kept.
+     *
+     * @param[in] timestamp Timestamp in ms since boot
+     */
+    void notifyActivation(uint32_t timestamp);
+
+    /**
+     * Get the timestamp in ms since boot, when the plugin was active the first time.
+     *
+     * @return Timestamp in ms. If the plugin was never active, it will be 0.
+     */
+    uint32_t getFirstActivation() const;
+
     /** Default duration in ms */
     static const uint32_t DURATION_DEFAULT  = 30000U;
 
 private:
 
-    IPluginMaintenance* m_plugin;   /**< Plugged in slot */
-    uint32_t            m_duration; /**< Duration in ms, how long the plugin shall be active. */
-    bool                m_isLocked; /**< Is slot locked or not. */
+    IPluginMaintenance* m_plugin;           /**< Plugged in slot */
+    uint32_t            m_duration;         /**< Duration in ms, how long the plugin shall be active. */
+    bool                m_isLocked;         /**< Is slot locked or not. */
+    bool                m_isStarted;        /**< Is plugin started or not. */
+    uint32_t            m_startDuration;    /**< Duration in us, how long the plugin start took. */
+    uint32_t            m_firstActivation;  /**< Timestamp in ms since boot of the first plugin activation. */
 
     Slot(const Slot& slot);
     Slot& operator=(const Slot& slot);
@@ -36,6 +36,7 @@
 
 #include <Logging.h>
 #include <Board.h>
+#include <string.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -115,6 +116,27 @@ struct WindowCorrection<FFT_WIN_TYP_FLT_TOP>
  * Local Variables
  *****************************************************************************/
 
+/* Initialize the list with the high edge frequency bin of the center band frequency. */
+const uint16_t  SpectrumAnalyzer::LIST_16_BAND_HIGH_EDGE_FREQ_BIN[]     =
+{
+    4U,
+    5U,
+    7U,
+    9U,
+    12U,
+    16U,
+    21U,
+    27U,
+    36U,
+    48U,
+    63U,
+    84U,
+    111U,
+    146U,
+    193U,
+    255U
+};
+
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -145,6 +167,9 @@ bool SpectrumAnalyzer::start()
                 /* Task shall run */
                 m_taskExit = false;
 
+                /* Start with an empty frame, before the task collects samples. */
+                m_frameBuffer.clear();
+
                 osRet = xTaskCreateUniversal(   processTask,
                                                 "spectrumAnalyzerTask",
                                                 TASK_STACK_SIZE,
@@ -175,8 +200,6 @@ bool SpectrumAnalyzer::start()
         }
         else
         {
-            m_sampleWriteIndex = 0U;
-
             LOG_INFO("Spectrum analyzer task is up.");
         }
     }
@@ -258,73 +281,58 @@ void SpectrumAnalyzer::process()
         /* One DMA block finished? */
         else if (I2S_EVENT_RX_DONE == i2sEvt.type)
         {
-            uint16_t sampleIdx = 0U;
+            size_t  bytesRead   = 0U;
+            size_t  count       = 0U;
+            size_t  sampleIdx   = 0U;
 
-            /* Read the whole DMA block. */
-            for(sampleIdx = 0U; sampleIdx < SAMPLES_PER_DMA_BLOCK; ++sampleIdx)
+            /* Read the whole DMA block at once. */
+            (void)i2s_read(I2S_PORT, m_dmaBlock, sizeof(m_dmaBlock), &bytesRead, portMAX_DELAY);
+            count = bytesRead / sizeof(m_dmaBlock[0]);
+
+            /* Check for ext. microphone */
+            if (false == m_isMicAvailable)
             {
-                int32_t sample      = 0U;   /* Attention, this datatype must correlate to the configuration, see bits per sample! */
-                size_t  bytesRead   = 0;
+                int32_t any = 0;
 
-                (void)i2s_read(I2S_PORT, &sample, sizeof(sample), &bytesRead, portMAX_DELAY);
+                for(sampleIdx = 0U; sampleIdx < count; ++sampleIdx)
+                {
+                    any |= m_dmaBlock[sampleIdx] >> I2S_SAMPLE_SHIFT;
+                }
 
-                if (sizeof(sample) == bytesRead)
+                if (0 != any)
                 {
-                    /* Down shift to get the real value. */
-                    sample >>= I2S_SAMPLE_SHIFT;
+                    m_isMicAvailable = true;
+                }
 
-                    m_real[m_sampleWriteIndex] = static_cast<double>(sample);
-                    m_imag[m_sampleWriteIndex] = 0.0f;
+                sampleIdx = 0U;
+            }
 
-                    ++m_sampleWriteIndex;
+            /* The frames overlap by half, therefore a frame is complete
+             * after every half frame of new samples. A complete frame is
+             * transformed, before the samples of the next frame are
+             * collected in the other buffer.
+             */
+            while(count > sampleIdx)
+            {
+                sampleIdx += m_frameBuffer.write(&m_dmaBlock[sampleIdx], count - sampleIdx, I2S_SAMPLE_SHIFT);
 
-                    /* Check for ext. microphone */
-                    if (false == m_isMicAvailable)
+                if (true == m_frameBuffer.isFrameReady())
+                {
+                    if (true == m_isMicAvailable)
                     {
-                        if (0 != sample)
-                        {
-                            m_isMicAvailable = true;
-                        }
-                    }
+                        uint32_t timestamp = micros();
 
-                    /* All samples read? */
-                    if (SAMPLES <= m_sampleWriteIndex)
-                    {
-                        m_sampleWriteIndex = 0U;
-                        
-#if 0
-
-                        /* Simulate the sampling of a sinusoidal 1000 Hz signal
-                         * with an amplitude of 94 db SPL, sampled at 40000 Hz.
-                         */
-                        {
-                            double signalFrequency  = 1000.0f;
-                            double cycles           = (((SAMPLES - 1U) * signalFrequency) / SAMPLE_RATE);   /* Number of signal cycles that the sampling will read. */
-                            double amplitude        = 420426.0f; /* 94 db SPL */
-
-                            for (uint16_t sampleIdx = 0U; sampleIdx < SAMPLES; ++sampleIdx)
-                            {
-                                /* Build data with positive and negative values. */
-                                m_real[sampleIdx] = (amplitude * (sin((sampleIdx * (twoPi * cycles)) / SAMPLES))) / 2.0f;
-                                
-                                /* Imaginary part must be zeroed in case of looping to avoid wrong calculations and overflows. */
-                                m_imag[sampleIdx] = 0.0f;
-                            }
-
-                            m_isMicAvailable = true;
-                        }
-
-#endif
-
-                        if (true == m_isMicAvailable)
-                        {
-                            /* Transform the time discrete values to the frequency spectrum. */
-                            calculateFFT();
-
-                            /* Store the frequency bins and provide it to the application. */
-                            copyFreqBins();
-                        }
+                        /* Transform the time discrete values to the frequency spectrum. */
+                        calculateFFT(m_frameBuffer.getFrame());
+
+                        /* Store the frequency bins and provide it to the application. */
+                        copyFreqBins(micros() - timestamp);
+
+                        /* Provide the octave bands to the display. */
+                        calculateOctaveBands();
                     }
+
+                    m_frameBuffer.releaseFrame();
                 }
             }
         }
@@ -393,12 +401,41 @@ void SpectrumAnalyzer::deInitI2S()
     m_i2sEventQueueHandle = nullptr;
 }
 
-void SpectrumAnalyzer::calculateFFT()
+#if (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT)
+
+void SpectrumAnalyzer::calculateFFT(float* frame)
+{
+    /* Hamming window, single-sided amplitude spectrum with window correction.
+     * The frame is transformed in place, because its samples are not
+     * needed anymore. The overlapping half is already in the next frame.
+     */
+    m_fft.computeAmplitudes(frame, m_amplitudes);
+}
+
+void SpectrumAnalyzer::copyFreqBins(uint32_t fftDuration)
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    memcpy(m_freqBins, m_amplitudes, sizeof(m_freqBins));
+
+    m_fftDuration.update(fftDuration);
+    m_freqBinsAreReady = true;
+}
+
+#else   /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
+
+void SpectrumAnalyzer::calculateFFT(float* frame)
 {
     static const constexpr double   HALF_SPECTRUM_ENERGY_CORRECTON_FACTOR   = 2.0f;
     static const constexpr uint8_t  WINDOW_TYPE                             = FFT_WIN_TYP_HAMMING;
     uint16_t idx = 0U;
 
+    for(idx = 0U; idx < SAMPLES; ++idx)
+    {
+        m_real[idx] = static_cast<double>(frame[idx]);
+        m_imag[idx] = 0.0f;
+    }
+
     /* Note, current arduinoFFT version has a wrong Hann window calculation! */
     m_fft.Windowing(WINDOW_TYPE, FFT_FORWARD);
     m_fft.Compute(FFT_FORWARD);
@@ -422,19 +459,139 @@ void SpectrumAnalyzer::calculateFFT()
     }
 }
 
-void SpectrumAnalyzer::copyFreqBins()
+void SpectrumAnalyzer::copyFreqBins(uint32_t fftDuration)
 {
     uint16_t            idx             = 0U;
     MutexGuard<Mutex>   guard(m_mutex);
 
     for(idx = 0U; idx < FREQ_BINS; ++idx)
     {
-        m_freqBins[idx] = m_real[idx];
+        m_freqBins[idx] = static_cast<float>(m_real[idx]);
     }
 
+    m_fftDuration.update(fftDuration);
     m_freqBinsAreReady = true;
 }
 
+#endif  /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
+
+void SpectrumAnalyzer::calculateOctaveBands()
+{
+    OctaveBands octaveBands;
+    uint8_t     bandIdx     = 0U;
+    uint16_t    freqBinIdx  = 0U;
+    int32_t     divisor     = 0;
+    float       peak        = 0.0f;
+    float       avgDigital  = 0.0f;
+
+    /* Sum up the frequency bins and create the octave frequency bands. */
+    freqBinIdx  = 1U; /* Don't use the first frequency bin, because it contains the DC part. */
+    bandIdx     = 0U;
+    octaveBands.levels[bandIdx] = 0.0f;
+    while((FREQ_BINS > freqBinIdx) && (OCTAVE_BANDS > bandIdx))
+    {
+        octaveBands.levels[bandIdx] += m_freqBins[freqBinIdx];
+        ++divisor; /* Count number of added frequency bins. */
+
+        /* If the current frequency bin is equal than the current
+         * high edge frequency of the band, the following frequency
+         * bin's will be assigned to the next band.
+         */
+        if (LIST_16_BAND_HIGH_EDGE_FREQ_BIN[bandIdx] == freqBinIdx)
+        {
+            /* Any frequency band added? */
+            if (0 < divisor)
+            {
+                /* Depends on how many frequency bins were added. */
+                octaveBands.levels[bandIdx] /= static_cast<float>(divisor);
+
+                divisor = 0;
+            }
+
+            ++bandIdx;
+
+            if (OCTAVE_BANDS > bandIdx)
+            {
+                octaveBands.levels[bandIdx] = m_freqBins[freqBinIdx];
+                ++divisor; /* Count number of added frequency bins. */
+            }
+        }
+
+        ++freqBinIdx;
+    }
+
+    /* Calculate the amplitude average over the spectrum. */
+    for(bandIdx = 0U; bandIdx < OCTAVE_BANDS; ++bandIdx)
+    {
+        avgDigital += octaveBands.levels[bandIdx];
+    }
+    avgDigital /= static_cast<float>(OCTAVE_BANDS);
+
+    for(bandIdx = 0U; bandIdx < OCTAVE_BANDS; ++bandIdx)
+    {
+        /* If the ampltiude average is lower than the equivalent input noise (from datasheet),
+         * the correction factors will be calculated. The amplitude average is used to detect
+         * silence, which is necessary for this automatic calibration.
+         */
+        if (INMP441_NOISE_FLOOR_DIGITAL > static_cast<int32_t>(avgDigital))
+        {
+            constexpr const float   WEIGHT_NEW_VALUE    = 0.1f;
+            constexpr const float   WEIGHT_OLD_VALUE    = 1.0f - WEIGHT_NEW_VALUE;
+            constexpr const float   NOISE_FLOOR         = static_cast<float>(INMP441_NOISE_FLOOR_DIGITAL);
+
+            /* Calculate with weighted average to avoid jumping. */
+            m_corrFactors[bandIdx] = WEIGHT_OLD_VALUE * m_corrFactors[bandIdx] + WEIGHT_NEW_VALUE * (NOISE_FLOOR / octaveBands.levels[bandIdx]);
+        }
+
+        /* Normalize */
+        octaveBands.levels[bandIdx] *= m_corrFactors[bandIdx];
+
+        /* Calculate the spectrum amplitude in dB SPL
+         * The shown frequency spectrum amplitudes consider now the silent and loud parts better.
+         *
+         * = sensitivity [dB SPL] + 20 * log10(frequency amplitude digital / sensitivity digital)
+         */
+        octaveBands.levels[bandIdx] = INMP441_SENSITIVITY_SPL + 20.0f * log10f(octaveBands.levels[bandIdx] / static_cast<float>(IMMP441_SENSITIVITY_DIGITAL));
+
+        /* The amplitude shall consider only the dynamic range
+         * by removing the equivalent input noise level.
+         */
+        if (INMP441_NOISE_SPL >= octaveBands.levels[bandIdx])
+        {
+            octaveBands.levels[bandIdx] = HEARING_THRESHOLD;
+        }
+        else
+        {
+            octaveBands.levels[bandIdx] -= INMP441_NOISE_SPL;
+        }
+
+        /* Determine peak over all frequency bands for automatic gain control. */
+        if (octaveBands.levels[bandIdx] > peak)
+        {
+            peak = octaveBands.levels[bandIdx];
+        }
+    }
+
+    /* Adapt the dynamic range on the y-axis, but limit it to a minimum,
+     * otherwise the bar's will jump driven by silent tones.
+     */
+    {
+        constexpr const float   WEIGHT_NEW_VALUE    = 0.25f;
+        constexpr const float   WEIGHT_OLD_VALUE    = 1.0f - WEIGHT_NEW_VALUE;
+
+        m_peak = WEIGHT_NEW_VALUE * peak + WEIGHT_OLD_VALUE * m_peak;
+
+        if (MIN_DYNAMIC_RANGE > m_peak)
+        {
+            m_peak = MIN_DYNAMIC_RANGE;
+        }
+    }
+
+    octaveBands.dynamicRange = m_peak;
+
+    m_octaveBands.write(octaveBands);
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -41,13 +41,27 @@
  *****************************************************************************/
 #include <stdint.h>
 #include <arduinoFFT.h>
+#include <RealFft.hpp>
+#include <OverlapFrameBuffer.hpp>
+#include <SeqLock.hpp>
+#include <StatisticValue.hpp>
 #include <driver/i2s.h>
 #include <Mutex.hpp>
+#include <math.h>
 
 /******************************************************************************
  * Compiler Switches
  *****************************************************************************/
 
+/**
+ * Select the FFT engine:
+ * 0: arduinoFFT in double precision, which is emulated in software on the ESP32.
+ * 1: Real-valued FFT in single precision, which uses the FPU of the ESP32.
+ */
+#ifndef CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT
+#define CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT  (1)
+#endif  /* CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT */
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -64,6 +78,25 @@ class SpectrumAnalyzer
 {
 public:
 
+    /** Number of FFT durations, which are considered for the moving average. */
+    static const uint32_t   FFT_DURATION_AVG_CNT    = 16U;
+
+    /** FFT duration statistic in us. */
+    typedef StatisticValue<uint32_t, 0U, FFT_DURATION_AVG_CNT> FftDuration;
+
+    /** Number of octave bands, which the frequency bins are summed up to. */
+    static const uint8_t    OCTAVE_BANDS            = 16U;
+
+    /**
+     * Octave bands, which are calculated from the frequency bins after
+     * every FFT.
+     */
+    struct OctaveBands
+    {
+        float   levels[OCTAVE_BANDS];   /**< Level of every band in dB SPL above the microphone noise. */
+        float   dynamicRange;           /**< Dynamic range in dB SPL, which follows the level peaks (automatic gain control). */
+    };
+
     /**
      * Get spectrum analyzer instance.
      * 
@@ -107,7 +140,7 @@ public:
      * 
      * @return If successful, it will return true otherwise false.
      */
-    bool getFreqBins(double* freqBins, size_t len)
+    bool getFreqBins(float* freqBins, size_t len)
     {
         bool                isSuccessful    = false;
         MutexGuard<Mutex>   guard(m_mutex);
@@ -143,6 +176,33 @@ public:
         return m_freqBinsAreReady;
     }
 
+    /**
+     * Get the CPU time statistic per FFT, which includes the windowing and
+     * the amplitude calculation.
+     *
+     * @return FFT duration statistic in us
+     */
+    FftDuration getFftDuration() const
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        return m_fftDuration;
+    }
+
+    /**
+     * Get the latest octave bands by copy.
+     * In contrast to getFreqBins(), it doesn't lock. A reader on the other
+     * core never waits for the spectrum analyzer task and vice versa.
+     *
+     * @param[out] bands    Octave bands
+     *
+     * @return Number of the octave bands, which increments after every FFT. If no octave bands are available yet, it will return 0.
+     */
+    uint32_t getOctaveBands(OctaveBands& bands) const
+    {
+        return m_octaveBands.read(bands);
+    }
+
 private:
 
     /** Task stack size in bytes */
@@ -219,18 +279,95 @@ private:
      */
     static const uint32_t               DMA_BLOCK_TIMEOUT       = ((SAMPLES_PER_DMA_BLOCK * 1000U) + (SAMPLE_RATE / 2U)) / SAMPLE_RATE;
 
+    /**
+     * INMP441 data word bit width.
+     */
+    static const constexpr uint8_t  INMP441_DATA_WORD_BITS      = 24U;
+
+    /**
+     * INMP441 nominal sensitivity in dbFS at 1 kHz.
+     */
+    static const constexpr float    INMP441_SENSITIVITY         = -26.0f;
+
+    /**
+     * INMP441 the applied sound pressure level by measuring the sensitivity
+     * at 1 kHz.
+     */
+    static const constexpr float    INMP441_SENSITIVITY_SPL     = 94.0f;
+
+    /**
+     * INMP441 the noise floor in dbFS.
+     */
+    static const constexpr float    INMP441_NOISE_FLOOR         = -87.0f;
+
+    /**
+     * The calculated full scale value of the INMP441.
+     */
+    static const constexpr int32_t  INMP441_FULL_SCALE          = (1 << (INMP441_DATA_WORD_BITS - 1)) - 1;
+
+    /**
+     * INMP441 the nominal sensitivity as digital value.
+     * = 10^(sensitivity [dbFS] / 20) * full scale
+     */
+    static const constexpr int32_t  IMMP441_SENSITIVITY_DIGITAL = powf(10.0f, INMP441_SENSITIVITY / 20.0f) * INMP441_FULL_SCALE;
+
+    /**
+     * INMP441 the noise floor as digital value.
+     * = 10^(noise floor [dbFS] / 20) * full scale
+     */
+    static const constexpr int32_t  INMP441_NOISE_FLOOR_DIGITAL = powf(10.0f, INMP441_NOISE_FLOOR / 20.0f) * INMP441_FULL_SCALE;
+
+    /**
+     * INMP441 the max. sound pressure level in db SPL.
+     * = sensitivity [db SPL] + 20 * log10(full scale / sensitivity digital)
+     */
+    static const constexpr int32_t  INMP441_MAX_SPL             = INMP441_SENSITIVITY_SPL + 20.0f * log10f((1.0f * INMP441_FULL_SCALE) / IMMP441_SENSITIVITY_DIGITAL);
+
+    /**
+     * INMP441 the equivalent input noise in db SPL.
+     * = sensitivity [db SPL] + 20 * log10(noise floor digital / sensitivity digital)
+     */
+    static const constexpr int32_t  INMP441_NOISE_SPL           = INMP441_SENSITIVITY_SPL + 20.0f * log10f((1.0f * INMP441_NOISE_FLOOR_DIGITAL) / IMMP441_SENSITIVITY_DIGITAL);
+
+    /**
+     * The human hearing threshold in dB SPL.
+     */
+    static const constexpr float    HEARING_THRESHOLD           = 0.0f;
+
+    /**
+     * Minimum dynamic range in dB SPL, on the y-axis.
+     */
+    static const constexpr float    MIN_DYNAMIC_RANGE           = 40.0f;
+
+    /**
+     * List with the high edge frequency bin of the center band frequency.
+     * If the number of octave bands or samples is changed, it must be
+     * calculated again.
+     */
+    static const uint16_t   LIST_16_BAND_HIGH_EDGE_FREQ_BIN[OCTAVE_BANDS];
+
     mutable Mutex       m_mutex;                /**< Mutex used for concurrent access protection. */
     TaskHandle_t        m_taskHandle;           /**< Task handle */
     bool                m_taskExit;             /**< Flag to signal the task to exit. */
     SemaphoreHandle_t   m_xSemaphore;           /**< Binary semaphore used to signal the task exit. */
+    int32_t                     m_dmaBlock[SAMPLES_PER_DMA_BLOCK];  /**< Raw samples of one DMA block. */
+    OverlapFrameBuffer<SAMPLES> m_frameBuffer;  /**< Collects the samples to frames, which overlap by half. */
+#if (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT)
+    float               m_amplitudes[FREQ_BINS]; /**< The FFT result, with linear magnitude. */
+    RealFft<SAMPLES>    m_fft;                  /**< The FFT algorithm. */
+#else   /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
     double              m_real[SAMPLES];        /**< The real values. */
     double              m_imag[SAMPLES];        /**< The imaginary values. */
     arduinoFFT          m_fft;                  /**< The FFT algorithm. */
+#endif  /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
     QueueHandle_t       m_i2sEventQueueHandle;  /**< The I2S event queue handle, used for rx done notification. Note, the queue is created by I2S driver. */
-    uint16_t            m_sampleWriteIndex;     /**< The current sample write index to the input buffer. */
-    double              m_freqBins[FREQ_BINS];  /**< The frequency bins as result of the FFT, with linear magnitude. */
+    float               m_freqBins[FREQ_BINS];  /**< The frequency bins as result of the FFT, with linear magnitude. */
     bool                m_freqBinsAreReady;     /**< Are the frequency bins ready for the application? */
     bool                m_isMicAvailable;       /**< Is a microphone as input device available? */
+    FftDuration         m_fftDuration;          /**< CPU time per FFT in us. */
+    float               m_corrFactors[OCTAVE_BANDS]; /**< Correction factors per octave band. The factors are calculated if the signal average is lower than the microphone noise floor. */
+    float               m_peak;                 /**< Determined signal peak over all octave bands in dB SPL, used for AGC. */
+    SeqLock<OctaveBands> m_octaveBands;         /**< Latest octave bands, published lock-free. */
 
     /**
      * Constructs the spectrum analyzer instance.
@@ -240,15 +377,31 @@ private:
         m_taskHandle(nullptr),
         m_taskExit(false),
         m_xSemaphore(nullptr),
+        m_dmaBlock{0},
+        m_frameBuffer(),
+#if (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT)
+        m_amplitudes{0.0f},
+        m_fft(),
+#else   /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
         m_real{0.0f},
         m_imag{0.0f},
         m_fft(m_real, m_imag, SAMPLES, SAMPLE_RATE),
+#endif  /* (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT) */
         m_i2sEventQueueHandle(nullptr),
-        m_sampleWriteIndex(0U),
         m_freqBins{0.0f},
         m_freqBinsAreReady(false),
-        m_isMicAvailable(false)
+        m_isMicAvailable(false),
+        m_fftDuration(),
+        m_corrFactors(),
+        m_peak(INMP441_MAX_SPL),
+        m_octaveBands()
     {
+        uint8_t bandIdx = 0U;
+
+        for(bandIdx = 0U; bandIdx < OCTAVE_BANDS; ++bandIdx)
+        {
+            m_corrFactors[bandIdx] = 1.0f;
+        }
     }
 
     /**
@@ -289,14 +442,26 @@ private:
     /**
      * Transform from discrete time to frequency spectrum.
      * Note, the magnitude will be calculated linear and not in dB.
+     *
+     * @param[in] frame One frame of SAMPLES samples, which may be destroyed.
      */
-    void calculateFFT();
+    void calculateFFT(float* frame);
 
     /**
-     * Copy FFT result to frequency bins.
+     * Copy FFT result to frequency bins and update the FFT duration statistic.
      * This function is protected against concurrent access.
+     *
+     * @param[in] fftDuration   CPU time of the FFT in us
+     */
+    void copyFreqBins(uint32_t fftDuration);
+
+    /**
+     * Sum up the frequency bins to octave bands, convert them to dB SPL
+     * with automatic gain control and publish them.
+     * The frequency bins are written by the processing task only, therefore
+     * it reads them without locking.
      */
-    void copyFreqBins();
+    void calculateOctaveBands();
 };
 
 /******************************************************************************
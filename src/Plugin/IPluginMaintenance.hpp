@@ -44,6 +44,7 @@
  * Includes
  *****************************************************************************/
 #include <stdint.h>
+#include <WString.h>
 #include <YAGfx.h>
 #include <ArduinoJson.h>
 #include "ISlotPlugin.hpp"
@@ -68,6 +69,12 @@ public:
      */
     typedef IPluginMaintenance* (*CreateFunc)(const String& name, uint16_t uid);
 
+    /** Update period: The plugin shall be updated in every display refresh cycle. */
+    static const uint32_t UPDATE_PERIOD_ALWAYS      = 0U;
+
+    /** Update period: The plugin shall be updated only if it requires it, see isUpdateRequired(). */
+    static const uint32_t UPDATE_PERIOD_ON_CHANGE   = UINT32_MAX;
+
     /**
      * Destroys the interface.
      */
@@ -203,6 +210,10 @@ public:
      * Process the plugin.
      * Overwrite it if your plugin has cyclic stuff to do without being in a
      * active slot.
+     *
+     * It is called in the display task period, which is between 20 ms and
+     * 100 ms, depending on the update period of the selected plugin. Don't
+     * rely on a fixed call period, use a timer instead.
      */
     virtual void process() = 0;
 
@@ -231,6 +242,23 @@ public:
      */
     virtual void update(YAGfx& gfx) = 0;
 
+    /**
+     * Get the period in ms, in which the plugin shall be updated as long as
+     * it is active. The display manager will call update() only if the
+     * period elapsed and sleeps in the meantime.
+     *
+     * @return Update period in ms, UPDATE_PERIOD_ALWAYS or UPDATE_PERIOD_ON_CHANGE
+     */
+    virtual uint32_t getUpdatePeriod() const = 0;
+
+    /**
+     * Does the plugin require an update of the display?
+     * It is only considered if the update period is UPDATE_PERIOD_ON_CHANGE.
+     *
+     * @return If an update is required, it will return true otherwise false.
+     */
+    virtual bool isUpdateRequired() const = 0;
+
 protected:
 
     /**
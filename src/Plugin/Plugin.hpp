@@ -294,6 +294,30 @@ public:
      */
     virtual void update(YAGfx& gfx) = 0;
 
+    /**
+     * Get the period in ms, in which the plugin shall be updated as long as
+     * it is active.
+     * Overwrite it if your plugin doesn't need to be updated in every display
+     * refresh cycle.
+     *
+     * @return Update period in ms, UPDATE_PERIOD_ALWAYS or UPDATE_PERIOD_ON_CHANGE
+     */
+    virtual uint32_t getUpdatePeriod() const override
+    {
+        return UPDATE_PERIOD_ALWAYS;
+    }
+
+    /**
+     * Does the plugin require an update of the display?
+     * Overwrite it if your plugin returns UPDATE_PERIOD_ON_CHANGE as update period.
+     *
+     * @return If an update is required, it will return true otherwise false.
+     */
+    virtual bool isUpdateRequired() const override
+    {
+        return true;
+    }
+
     /**
      * Path where plugin specific configuration files shall be stored.
      */
@@ -44,6 +44,7 @@
 
 #include <Logging.h>
 #include <ArduinoJson.h>
+#include <RawImgLoader.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -166,6 +167,71 @@ String PluginMgr::getRestApiBaseUriByAlias(const String& alias)
     return baseUri;
 }
 
+bool PluginMgr::processTopicOperation(JsonObject operation, JsonObject result)
+{
+    const char*         errorMsg    = nullptr;
+    IPluginMaintenance* plugin      = findPluginWithTopics(operation);
+    JsonVariant         jsonTopic   = operation["topic"];
+    JsonVariant         jsonValue   = operation["value"];
+
+    if (nullptr == plugin)
+    {
+        errorMsg = "Plugin not found.";
+    }
+    else if (false == jsonTopic.is<String>())
+    {
+        errorMsg = "Topic is missing.";
+    }
+    else
+    {
+        String topic = jsonTopic.as<String>();
+
+        /* The plugin start may be deferred, but its topics require a started plugin. */
+        (void)DisplayMgr::getInstance().startPlugin(plugin);
+
+        result["uid"]   = plugin->getUID();
+        result["topic"] = topic;
+
+        /* Write topic? */
+        if (false == jsonValue.isNull())
+        {
+            if (false == jsonValue.is<JsonObject>())
+            {
+                errorMsg = "Value is not a object.";
+            }
+            else if (false == plugin->setTopic(topic, jsonValue.as<JsonObject>()))
+            {
+                errorMsg = "Requested topic not supported or invalid data.";
+            }
+        }
+        /* Read topic */
+        else
+        {
+            JsonObject dataObj = result.createNestedObject("data");
+
+            if (false == plugin->getTopic(topic, dataObj))
+            {
+                result.remove("data");
+                errorMsg = "Requested topic not supported.";
+            }
+        }
+    }
+
+    if (nullptr == errorMsg)
+    {
+        result["status"] = "ok";
+    }
+    else
+    {
+        JsonObject errorObj = result.createNestedObject("error");
+
+        errorObj["msg"]     = errorMsg;
+        result["status"]    = "error";
+    }
+
+    return (nullptr == errorMsg);
+}
+
 void PluginMgr::load()
 {
     Settings& settings = Settings::getInstance();
@@ -200,8 +266,9 @@ void PluginMgr::load()
             }
             else
             {
-                JsonArray   jsonSlots   = jsonDoc["slots"].as<JsonArray>();
-                uint8_t     slotId      = 0;
+                JsonArray   jsonSlots       = jsonDoc["slots"].as<JsonArray>();
+                uint8_t     slotId          = 0;
+                const bool  isStartDeferred = (0 != CONFIG_PLUGIN_MGR_LAZY_START);
 
                 for(JsonObject jsonSlot: jsonSlots)
                 {
@@ -229,7 +296,7 @@ void PluginMgr::load()
                                     plugin->setAlias(alias);
                                 }
 
-                                if (false == install(plugin, slotId))
+                                if (false == install(plugin, slotId, isStartDeferred))
                                 {
                                     LOG_WARNING("Couldn't install %s (uid %u) in slot %u.", name.c_str(), uid, slotId);
 
@@ -239,6 +306,11 @@ void PluginMgr::load()
                                 else
                                 {
                                     plugin->enable();
+
+                                    if (true == isStartDeferred)
+                                    {
+                                        m_isStartPending = true;
+                                    }
                                 }
                             }
                         }
@@ -255,6 +327,22 @@ void PluginMgr::load()
 
         settings.close();
     }
+
+    /* Only the plugin, which is scheduled first, is started before the
+     * display shows it. All others follow in the background.
+     */
+    if (true == m_isStartPending)
+    {
+        (void)DisplayMgr::getInstance().startNextPlugin();
+    }
+}
+
+void PluginMgr::process()
+{
+    if (true == m_isStartPending)
+    {
+        m_isStartPending = DisplayMgr::getInstance().startNextPlugin();
+    }
 }
 
 void PluginMgr::save()
@@ -338,7 +426,7 @@ void PluginMgr::createPluginConfigDirectory()
     }
 }
 
-bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId)
+bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId, bool isStartDeferred)
 {
     bool isSuccessful = false;
 
@@ -350,7 +438,7 @@ bool PluginMgr::install(IPluginMaintenance* plugin, uint8_t slotId)
         }
         else
         {
-            isSuccessful = installToSlot(plugin, slotId);
+            isSuccessful = installToSlot(plugin, slotId, isStartDeferred);
         }
 
         if (true == isSuccessful)
@@ -381,13 +469,13 @@ bool PluginMgr::installToAutoSlot(IPluginMaintenance* plugin)
     return status;
 }
 
-bool PluginMgr::installToSlot(IPluginMaintenance* plugin, uint8_t slotId)
+bool PluginMgr::installToSlot(IPluginMaintenance* plugin, uint8_t slotId, bool isStartDeferred)
 {
     bool status = false;
 
     if (nullptr != plugin)
     {
-        if (DisplayMgr::SLOT_ID_INVALID == DisplayMgr::getInstance().installPlugin(plugin, slotId))
+        if (DisplayMgr::SLOT_ID_INVALID == DisplayMgr::getInstance().installPlugin(plugin, slotId, isStartDeferred))
         {
             LOG_ERROR("Couldn't install plugin %s to slot %u.", plugin->getName(), slotId);
         }
@@ -452,11 +540,12 @@ void PluginMgr::registerTopic(const String& baseUri, PluginObjData* metaData, co
     String          topicUri        = baseUri + topic;
     uint8_t         idx             = 0U;
     WebHandlerData* webHandlerData  = nullptr;
+    WebHandlerData* otherData       = nullptr;
 
     /* Find empty web handler slot */
     for(idx = 0U; idx < PluginObjData::MAX_WEB_HANDLERS; ++idx)
     {
-        if (nullptr == metaData->webHandlers[idx].webHandler)
+        if (true == metaData->webHandlers[idx].uri.isEmpty())
         {
             webHandlerData = &metaData->webHandlers[idx];
             break;
@@ -467,27 +556,72 @@ void PluginMgr::registerTopic(const String& baseUri, PluginObjData* metaData, co
     {
         LOG_WARNING("[%s][%u] No web handler available anymore.", metaData->plugin->getName(), metaData->plugin->getUID());
     }
+    /* Like with a handler per topic, the first registered one is used. */
+    else if (true == m_topicRoutes.find(topicUri.c_str(), otherData))
+    {
+        LOG_WARNING("[%s][%u] Already registered: %s", metaData->plugin->getName(), metaData->plugin->getUID(), topicUri.c_str());
+    }
+    else if (false == registerTopicsWebHandler())
+    {
+        LOG_WARNING("[%s][%u] No web handler for topics available.", metaData->plugin->getName(), metaData->plugin->getUID());
+    }
+    else if (false == m_topicRoutes.insert(topicUri.c_str(), webHandlerData))
+    {
+        LOG_WARNING("[%s][%u] Couldn't add route: %s", metaData->plugin->getName(), metaData->plugin->getUID(), topicUri.c_str());
+    }
     else
     {
-        IPluginMaintenance* plugin = metaData->plugin;
-
-        webHandlerData->webHandler  = &MyWebServer::getInstance().on(
-                                        topicUri.c_str(),
-                                        HTTP_ANY,
-                                        [this, plugin, topic, webHandlerData](AsyncWebServerRequest *request)
-                                        {
-                                            this->webReqHandler(request, plugin, topic, webHandlerData);
-                                        },
-                                        [this, plugin, topic, webHandlerData](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final)
-                                        {
-                                            this->uploadHandler(request, filename, index, data, len, final, plugin, topic, webHandlerData);
-                                        });
-        webHandlerData->uri         = topicUri;
+        webHandlerData->plugin  = metaData->plugin;
+        webHandlerData->topic   = topic;
+        webHandlerData->uri     = topicUri;
 
         LOG_INFO("[%s][%u] Register: %s", metaData->plugin->getName(), metaData->plugin->getUID(), topicUri.c_str());
     }
 }
 
+bool PluginMgr::registerTopicsWebHandler()
+{
+    if (nullptr == m_topicsWebHandler)
+    {
+        /* All plugin topics are below this URI. The web server checks its
+         * handlers one after another, therefore a single handler is used,
+         * which finds the topic by its URI in O(URI length).
+         * The REST API handlers below this URI are registered before and
+         * have priority.
+         */
+        String topicsUri = RestApi::BASE_URI;
+        topicsUri += "/display/*";
+
+        m_topicsWebHandler = &MyWebServer::getInstance().on(
+                                topicsUri.c_str(),
+                                HTTP_ANY,
+                                [this](AsyncWebServerRequest *request)
+                                {
+                                    WebHandlerData* webHandlerData = nullptr;
+
+                                    if (false == this->m_topicRoutes.find(request->url().c_str(), webHandlerData))
+                                    {
+                                        RestApi::error(request);
+                                    }
+                                    else
+                                    {
+                                        this->webReqHandler(request, webHandlerData->plugin, webHandlerData->topic, webHandlerData);
+                                    }
+                                },
+                                [this](AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final)
+                                {
+                                    WebHandlerData* webHandlerData = nullptr;
+
+                                    if (true == this->m_topicRoutes.find(request->url().c_str(), webHandlerData))
+                                    {
+                                        this->uploadHandler(request, filename, index, data, len, final, webHandlerData->plugin, webHandlerData->topic, webHandlerData);
+                                    }
+                                });
+    }
+
+    return (nullptr != m_topicsWebHandler);
+}
+
 void PluginMgr::webReqHandler(AsyncWebServerRequest *request, IPluginMaintenance* plugin, const String& topic, WebHandlerData* webHandlerData)
 {
     String              content;
@@ -503,6 +637,9 @@ void PluginMgr::webReqHandler(AsyncWebServerRequest *request, IPluginMaintenance
         return;
     }
 
+    /* The plugin start may be deferred, but its topics require a started plugin. */
+    (void)DisplayMgr::getInstance().startPlugin(plugin);
+
     if (HTTP_GET == request->method())
     {
         if (false == plugin->getTopic(topic, dataObj))
@@ -612,6 +749,9 @@ void PluginMgr::uploadHandler(AsyncWebServerRequest *request, const String& file
             }
             else
             {
+                /* A cached raw image of a previous upload is outdated now. */
+                (void)FILESYSTEM.remove(RawImgLoader::getCacheFileName(webHandlerData->fullPath));
+
                 /* Create a new file and overwrite a existing one. */
                 webHandlerData->fd = FILESYSTEM.open(webHandlerData->fullPath, "w");
 
@@ -651,6 +791,43 @@ void PluginMgr::uploadHandler(AsyncWebServerRequest *request, const String& file
     return;
 }
 
+IPluginMaintenance* PluginMgr::findPluginWithTopics(JsonObject operation)
+{
+    IPluginMaintenance*                         plugin      = nullptr;
+    DLinkedListConstIterator<PluginObjData*>    it(m_pluginMeta);
+    JsonVariant                                 jsonUid     = operation["uid"];
+    JsonVariant                                 jsonAlias   = operation["alias"];
+    bool                                        isUid       = jsonUid.is<uint16_t>();
+    String                                      alias       = jsonAlias.as<String>();
+
+    if ((true == isUid) ||
+        ((true == jsonAlias.is<String>()) && (false == alias.isEmpty())))
+    {
+        bool isFound = it.first();
+
+        while((true == isFound) && (nullptr == plugin))
+        {
+            IPluginMaintenance* current = (*it.current())->plugin;
+
+            if (true == isUid)
+            {
+                if (jsonUid.as<uint16_t>() == current->getUID())
+                {
+                    plugin = current;
+                }
+            }
+            else if (alias == current->getAlias())
+            {
+                plugin = current;
+            }
+
+            isFound = it.next();
+        }
+    }
+
+    return plugin;
+}
+
 void PluginMgr::unregisterTopics(IPluginMaintenance* plugin)
 {
     if (nullptr != plugin)
@@ -688,16 +865,21 @@ void PluginMgr::unregisterTopics(IPluginMaintenance* plugin)
 
                 for(idx = 0U; idx < PluginObjData::MAX_WEB_HANDLERS; ++idx)
                 {
-                    if (nullptr != pluginMeta->webHandlers[idx].webHandler)
+                    WebHandlerData* webHandlerData  = &pluginMeta->webHandlers[idx];
+                    WebHandlerData* routeData       = nullptr;
+
+                    if (false == webHandlerData->uri.isEmpty())
                     {
-                        LOG_INFO("[%s][%u] Unregister: %s", pluginMeta->plugin->getName(), pluginMeta->plugin->getUID(), pluginMeta->webHandlers[idx].uri.c_str());
+                        LOG_INFO("[%s][%u] Unregister: %s", pluginMeta->plugin->getName(), pluginMeta->plugin->getUID(), webHandlerData->uri.c_str());
 
-                        if (false == MyWebServer::getInstance().removeHandler(pluginMeta->webHandlers[idx].webHandler))
+                        if ((false == m_topicRoutes.find(webHandlerData->uri.c_str(), routeData)) ||
+                            (webHandlerData != routeData) ||
+                            (false == m_topicRoutes.remove(webHandlerData->uri.c_str())))
                         {
-                            LOG_WARNING("Couldn't remove handler %u.", idx);
+                            LOG_WARNING("Couldn't remove route %u.", idx);
                         }
 
-                        pluginMeta->webHandlers[idx].webHandler = nullptr;
+                        webHandlerData->uri.clear();
                     }
                 }
 
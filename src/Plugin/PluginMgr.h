@@ -40,6 +40,16 @@
  * Compile Switches
  *****************************************************************************/
 
+/**
+ * Lazy plugin start during loading of the plugin installation.
+ * Only the plugin, which is scheduled first, is started right away. All other
+ * plugins are started in the background, on their first activation or on
+ * the first access to their topics, whatever comes first.
+ */
+#ifndef CONFIG_PLUGIN_MGR_LAZY_START
+#define CONFIG_PLUGIN_MGR_LAZY_START    (1)
+#endif  /* CONFIG_PLUGIN_MGR_LAZY_START */
+
 /******************************************************************************
  * Includes
  *****************************************************************************/
@@ -49,6 +59,7 @@
 #include "PluginFactory.h"
 
 #include <LinkedList.hpp>
+#include <PrefixTree.hpp>
 #include <ESPAsyncWebServer.h>
 
 /******************************************************************************
@@ -155,6 +166,22 @@ public:
      */
     String getRestApiBaseUriByAlias(const String& alias);
 
+    /**
+     * Read or write a single plugin topic, used to handle many topics in one
+     * request. The plugin is addressed by its UID ("uid") or its alias name
+     * ("alias"). If the operation contains a "value" object, the "topic" will
+     * be written with it, otherwise the topic will be read.
+     *
+     * The result contains the plugin UID, the topic and the status. On success
+     * the read topic data is added as "data", otherwise a "error" message.
+     *
+     * @param[in]   operation   Topic operation
+     * @param[out]  result      Operation result
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool processTopicOperation(JsonObject operation, JsonObject result);
+
     /**
      * Load plugin installation from persistent memory.
      * It will automatically enable the installed plugins.
@@ -162,6 +189,13 @@ public:
      */
     void load();
 
+    /**
+     * Process the plugin manager. Call it periodically.
+     * It starts the plugins one by one in the background, whose start was
+     * deferred during loading.
+     */
+    void process();
+
     /**
      * Save plugin installation to persistent memory.
      */
@@ -174,8 +208,9 @@ private:
      */
     struct WebHandlerData
     {
-        AsyncCallbackWebHandler*    webHandler;     /**< Webhandler callback, necessary to remove it later again. */
-        String                      uri;            /**< URI where the handler is registered. */
+        IPluginMaintenance*         plugin;         /**< Plugin, which provides the topic. */
+        String                      topic;          /**< Topic */
+        String                      uri;            /**< URI where the topic is registered. If empty, the web handler data is not used. */
         bool                        isUploadError;  /**< If upload error happened, it will be true otherwise false. */
         String                      fullPath;       /**< Full path of uploaded file. If empty, there is no file available. */
         File                        fd;             /**< Upload file descriptor */
@@ -184,7 +219,8 @@ private:
          * Initialize the web handler data.
          */
         WebHandlerData() :
-            webHandler(nullptr),
+            plugin(nullptr),
+            topic(),
             uri(),
             isUploadError(false),
             fullPath(),
@@ -213,14 +249,21 @@ private:
         }
     };
 
-    PluginFactory               m_pluginFactory;    /**< The plugin factory with the plugin type registry. */
-    DLinkedList<PluginObjData*> m_pluginMeta;       /**< Plugin object management information. */
+    PluginFactory                   m_pluginFactory;    /**< The plugin factory with the plugin type registry. */
+    DLinkedList<PluginObjData*>     m_pluginMeta;       /**< Plugin object management information. */
+    PrefixTree<WebHandlerData*>     m_topicRoutes;      /**< Topic URIs of all plugins, to find the web handler data of a request. */
+    AsyncCallbackWebHandler*        m_topicsWebHandler; /**< Web handler for all plugin topics */
+    bool                            m_isStartPending;   /**< Is the start of at least one plugin deferred? */
 
     /**
      * Constructs the plugin manager.
      */
     PluginMgr() :
-        m_pluginFactory()
+        m_pluginFactory(),
+        m_pluginMeta(),
+        m_topicRoutes(),
+        m_topicsWebHandler(nullptr),
+        m_isStartPending(false)
     {
     }
 
@@ -254,12 +297,13 @@ private:
      * Install plugin.
      * If no slot id is given, the plugin will be installed in the next available slot.
      *
-     * @param[in] plugin    The plugin
-     * @param[in] slotId    Slot id
+     * @param[in] plugin            The plugin
+     * @param[in] slotId            Slot id
+     * @param[in] isStartDeferred   Defer the plugin start (true) or not (false).
      *
      * @return If successful, it will return a pointer to the plugin instance, otherwise nullptr.
      */
-    bool install(IPluginMaintenance* plugin, uint8_t slotId);
+    bool install(IPluginMaintenance* plugin, uint8_t slotId, bool isStartDeferred = false);
 
     /**
      * Install plugin to any available display slot.
@@ -273,12 +317,13 @@ private:
     /**
      * Install plugin to a specific display slot.
      *
-     * @param[in] plugin    Plugin, which to install
-     * @param[in] slotId    Id of the slot, where to install the plugin
+     * @param[in] plugin            Plugin, which to install
+     * @param[in] slotId            Id of the slot, where to install the plugin
+     * @param[in] isStartDeferred   Defer the plugin start (true) or not (false).
      *
      * @return If successful installed, it will return true otherwise false.
      */
-    bool installToSlot(IPluginMaintenance* plugin, uint8_t slotId);
+    bool installToSlot(IPluginMaintenance* plugin, uint8_t slotId, bool isStartDeferred);
 
     /**
      * Register all topics of the given plugin depended on the used communication
@@ -298,6 +343,14 @@ private:
      */
     void registerTopic(const String& baseUri, PluginObjData* metaData, const String& topic);
 
+    /**
+     * Register the web handler for all plugin topics, if not already done.
+     * It dispatches the requests by the topic routes.
+     *
+     * @return If the web handler is available, it will return true otherwise false.
+     */
+    bool registerTopicsWebHandler();
+
     /**
      * The web request handler handles all incoming HTTP requests for every plugin topic.
      * 
@@ -323,6 +376,15 @@ private:
      */
     void uploadHandler(AsyncWebServerRequest *request, const String& filename, size_t index, uint8_t *data, size_t len, bool final, IPluginMaintenance* plugin, const String& topic, WebHandlerData* webHandlerData);
 
+    /**
+     * Find a plugin with registered topics by its UID or alias name.
+     *
+     * @param[in] operation Topic operation with "uid" or "alias"
+     *
+     * @return If found, it will return the plugin otherwise nullptr.
+     */
+    IPluginMaintenance* findPluginWithTopics(JsonObject operation);
+
     /**
      * Unregister all topics depended on the used communication networks.
      * 
@@ -32,7 +32,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "BTCQuotePlugin.h"
 #include "FileSystem.h"
 
@@ -79,6 +79,8 @@ void BTCQuotePlugin::start(uint16_t width, uint16_t height)
     m_textCanvas.setPosAndSize(ICON_WIDTH, 0, width - ICON_WIDTH, height);
     (void)m_textCanvas.addWidget(m_textWidget);
 
+    /* No data is shown yet, therefore the first request shall not be conditional. */
+    m_client.clearValidators();
     initHttpClient();
     if (false == startHttpRequest())
     {
@@ -218,6 +220,15 @@ void BTCQuotePlugin::initHttpClient()
                 if (DeserializationError::Ok != error.code())
                 {
                     LOG_ERROR("Invalid JSON message received: %s", error.c_str());
+
+                    /* The response callback runs after the HTTP scheduler
+                     * stored the validators of the response. Forget them,
+                     * otherwise the next requests would get "not modified".
+                     */
+                    this->m_client.clearValidators();
+
+                    delete jsonDoc;
+                    jsonDoc = nullptr;
                 }
                 else
                 {
@@ -235,6 +246,14 @@ void BTCQuotePlugin::initHttpClient()
             }
         }
     );
+
+    m_client.regOnUnchanged(
+        []()
+        {
+            /* The last response is still valid, nothing to parse and to update. */
+            LOG_INFO("Data unchanged.");
+        }
+    );
 }
 
 void BTCQuotePlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
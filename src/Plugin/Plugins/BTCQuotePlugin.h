@@ -42,7 +42,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "Plugin.hpp"
 
 #include <WidgetGroup.h>
@@ -195,7 +195,7 @@ private:
     BitmapWidget        m_bitmapWidget;             /**< Bitmap widget, used to show the icon. */
     TextWidget          m_textWidget;               /**< Text widget, used for showing the text. */
     String              m_relevantResponsePart;     /**< String used for the relevant part of the HTTP response. */
-    AsyncHttpClient     m_client;                   /**< Asynchronous HTTP client. */
+    HttpRequest         m_client;                   /**< HTTP request, executed by the HTTP scheduler. */
     MutexRecursive      m_mutex;                    /**< Mutex to protect against concurrent access. */
     SimpleTimer         m_requestTimer;             /**< Timer is used for cyclic weather http request. */
 
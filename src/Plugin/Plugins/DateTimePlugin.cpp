@@ -225,6 +225,13 @@ void DateTimePlugin::update(YAGfx& gfx)
     return;
 }
 
+bool DateTimePlugin::isUpdateRequired() const
+{
+    MutexGuard<MutexRecursive> guard(m_mutex);
+
+    return m_isUpdateAvailable;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
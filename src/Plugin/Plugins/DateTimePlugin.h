@@ -209,6 +209,23 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the update period. The date/time is only drawn if it changed.
+     *
+     * @return Update period
+     */
+    uint32_t getUpdatePeriod() const final
+    {
+        return UPDATE_PERIOD_ON_CHANGE;
+    }
+
+    /**
+     * Does the plugin require an update of the display?
+     *
+     * @return If an update is required, it will return true otherwise false.
+     */
+    bool isUpdateRequired() const final;
+
     /** Plugin configuration possibilities. */
     enum Cfg
     {
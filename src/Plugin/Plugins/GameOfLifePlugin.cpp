@@ -60,51 +60,33 @@
 
 void GameOfLifePlugin::start(uint16_t width, uint16_t height)
 {
-    m_width     = width;
-    m_height    = height;
-    m_gridSize  = ((m_width * m_height) + (BITS - 1U)) / BITS;
-
-    (void)createGrids();
+    (void)m_grid.create(width, height);
 
     return;
 }
 
 void GameOfLifePlugin::stop()
 {
-    destroyGrids();
+    m_grid.destroy();
 
     return;
 }
 
 void GameOfLifePlugin::active(YAGfx& gfx)
 {
-    uint8_t index   = 0U;
-    bool    isInit  = true;
-
-    while((GRIDS > index) && (true == isInit))
-    {
-        if (nullptr == m_grids[index])
-        {
-            isInit = false;
-        }
-
-        ++index;
-    }
-
-    if (true == isInit)
+    if (true == m_grid.isCreated())
     {
         /* It may happen that the slot duration is lower than the force restart period.
          * To avoid that the game of life doesn't change anymore, a new pattern shall
          * be generated every time the plugin is activated.
          */
-        generateInitialPattern(m_activeGrid);
+        generateInitialPattern();
     }
 
     /* Show generated initial cell grid. */
     gfx.fillScreen(ColorDef::BLACK);
-    update(gfx, m_activeGrid);
+    drawGrid(gfx, false);
 
-    m_displayTimer.start(DISPLAY_PERIOD);
     m_forceRestartTimer.start(FORCE_RESTART_PERIOD);
 
     return;
@@ -114,29 +96,16 @@ void GameOfLifePlugin::inactive()
 {
     m_forceRestartTimer.stop();
     m_restartTimer.stop();
-    m_displayTimer.stop();
 
     return;
 }
 
 void GameOfLifePlugin::update(YAGfx& gfx)
 {
-    uint8_t index   = 0U;
-    bool    isInit  = true;
-
-    /* Check whether grid is initialized or not. */
-    while((GRIDS > index) && (true == isInit))
-    {
-        if (nullptr == m_grids[index])
-        {
-            isInit = false;
-        }
-
-        ++index;
-    }
+    bool isRestarted = false;
 
     /* Grid initialized? */
-    if (false == isInit)
+    if (false == m_grid.isCreated())
     {
         /* Not initialized, do nothing. */
         ;
@@ -145,114 +114,35 @@ void GameOfLifePlugin::update(YAGfx& gfx)
     else if ((true == m_forceRestartTimer.isTimerRunning()) &&
              (true == m_forceRestartTimer.isTimeout()))
     {
-        generateInitialPattern(m_activeGrid);
+        generateInitialPattern();
         m_forceRestartTimer.restart();
         m_restartTimer.stop();
+        isRestarted = true;
     }
-    /* If the grid is stable, keep it for a while and then restart. */
+    /* If the grid is in a cycle, keep it for a while and then restart. */
     else if ((true == m_restartTimer.isTimerRunning()) &&
              (true == m_restartTimer.isTimeout()))
     {
-        generateInitialPattern(m_activeGrid);
+        generateInitialPattern();
         m_forceRestartTimer.restart();
         m_restartTimer.stop();
+        isRestarted = true;
     }
 
     /* Let's play the game of life. */
-    if ((true == isInit) &&
-        (true == m_displayTimer.isTimeout()))
+    if (true == m_grid.isCreated())
     {
-        int32_t cellX           = 0;
-        int32_t cellY           = 0;
-        uint8_t inactiveGrid    = (m_activeGrid + 1U) % GRIDS;
-        bool    isStable        = true;
-
-        /* Note: The active grid is the one, where we look how the current state of
-         * every cell is. This is the grid, which is shown on the display right now.
-         * The next time cycle of the game will be drawn now on the inactive grid,
-         * which will be then shown at the end of this routine.
-         *
-         * After that the active grid will be inactive and vice versa.
-         */
+        m_grid.step();
 
-        /* Handle active grid */
-        for(cellY = 0; cellY < m_height; ++cellY)
-        {
-            for(cellX = 0; cellX < m_width; ++cellX)
-            {
-                bool    cellState       = getCellState(m_activeGrid, cellX, cellY);
-                uint8_t neighboursAlive = countAliveNeighbours(m_activeGrid, cellX, cellY);
-                bool    newState        = false;
-
-                /* Rules:
-                 * 1. Any live cell with fewer than two live neighbours dies, as if by underpopulation.
-                 * 2. Any live cell with two or three live neighbours lives on to the next generation.
-                 * 3. Any live cell with more than three live neighbours dies, as if by overpopulation.
-                 * 4. Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction.
-                 */
-
-                /* Dead? */
-                if (false == cellState)
-                {
-                    /* Rule 4: Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction. */
-                    if (3U == neighboursAlive)
-                    {
-                        newState = true;
-                    }
-                    /* Cell stays dead. */
-                    else
-                    {
-                        newState = false;
-                    }
-                }
-                /* Alive */
-                else
-                {
-                    /* Rule 1: Any live cell with fewer than two live neighbours dies, as if by underpopulation. */
-                    if (2U > neighboursAlive)
-                    {
-                        newState = false;
-                    }
-                    /* Rule 2: Any live cell with two or three live neighbours lives on to the next generation. */
-                    else if (4U > neighboursAlive)
-                    {
-                        newState = true;
-                    }
-                    /* Rule 3: Any live cell with more than three live neighbours dies, as if by overpopulation. */
-                    else
-                    {
-                        newState = false;
-                    }
-                }
+        /* After a restart the whole grid differs from the shown one. */
+        drawGrid(gfx, (false == isRestarted));
 
-                setCellState(inactiveGrid, cellX, cellY, newState);
-
-                if (cellState != newState)
-                {
-                    isStable = false;
-                }
-            }
-        }
-
-        update(gfx, inactiveGrid);
-
-        /* If grid is stable, restart game after a period. */
-        if ((true == isStable) &&
+        /* If the grid is in a cycle (still life or oscillator), restart game after a period. */
+        if ((0U != m_grid.getPeriod()) &&
             (false == m_restartTimer.isTimerRunning()))
         {
             m_restartTimer.start(RESTART_PERIOD);
         }
-
-        /* Activate next grid */
-        ++m_activeGrid;
-        m_activeGrid %= GRIDS;
-
-        m_displayTimer.restart();
-    }
-    else
-    {
-        /* Nothing to do. */
-        ;
     }
 
     return;
@@ -266,213 +156,61 @@ void GameOfLifePlugin::update(YAGfx& gfx)
  * Private Methods
  *****************************************************************************/
 
-bool GameOfLifePlugin::createGrids()
-{
-    bool    status  = true;
-    uint8_t index   = 0U;
-
-    while((GRIDS > index) && (true == status))
-    {
-        m_grids[index] = new(std::nothrow) uint32_t[m_gridSize];
-
-        if (nullptr == m_grids[index])
-        {
-            status = false;
-        }
-
-        ++index;
-    }
-
-    if (false == status)
-    {
-        destroyGrids();
-    }
-
-    return status;
-}
-
-void GameOfLifePlugin::destroyGrids()
-{
-    uint8_t index = 0U;
-
-    while(GRIDS > index)
-    {
-        if (nullptr != m_grids[index])
-        {
-            delete[] m_grids[index];
-            m_grids[index] = nullptr;
-        }
-
-        ++index;
-    }
-
-    return;
-}
-
-void GameOfLifePlugin::generateInitialPattern(uint8_t gridId)
+void GameOfLifePlugin::generateInitialPattern()
 {
-    uint32_t gridDataIndex = 0U;
+    uint16_t y = 0U;
 
     randomSeed(ESP.getCycleCount());
 
-    while(m_gridSize > gridDataIndex)
-    {
-        m_grids[gridId][gridDataIndex] = random(INT32_MAX);
-        m_grids[gridId][gridDataIndex] |= (0 == random(2)) ? 0x00000000 : 0x80000000;
-
-        ++gridDataIndex;
-    }
-
-    return;
-}
-
-bool GameOfLifePlugin::getCellState(uint8_t gridId, int16_t x, int16_t y)
-{
-    bool isAlive = false;
-
-    if (0 > x)
-    {
-        x = m_width + x;
-    }
-    else if (m_width <= x)
-    {
-        x -= m_width;
-    }
-    else
+    for(y = 0U; y < m_grid.getHeight(); ++y)
     {
-        ;
-    }
+        uint16_t wordIdx = 0U;
 
-    if (0 > y)
-    {
-        y = m_height + y;
-    }
-    else if (m_height <= y)
-    {
-        y -= m_height;
-    }
-    else
-    {
-        ;
-    }
-
-    if ((0 <= x) &&
-        (0 <= y) &&
-        (m_width > x) &&
-        (m_height > y))
-    {
-        uint32_t    cellIndex       = x + m_width * y;
-        uint32_t    cellDataIndex   = cellIndex / BITS;
-        uint8_t     bitIndex        = cellIndex - (cellDataIndex * BITS);
-
-        isAlive = (0 != (m_grids[gridId][cellDataIndex] & (1 << bitIndex)));
-    }
-
-    return isAlive;
-}
-
-void GameOfLifePlugin::setCellState(uint8_t gridId, int16_t x, int16_t y, bool state)
-{
-    if (0 > x)
-    {
-        x = m_width + x;
-    }
-    else if (m_width <= x)
-    {
-        x -= m_width;
-    }
-    else
-    {
-        ;
-    }
-
-    if (0 > y)
-    {
-        y = m_height + y;
-    }
-    else if (m_height <= y)
-    {
-        y -= m_height;
-    }
-    else
-    {
-        ;
-    }
+        for(wordIdx = 0U; wordIdx < m_grid.getWordsPerRow(); ++wordIdx)
+        {
+            uint32_t cells = random(INT32_MAX);
 
-    if ((0 <= x) &&
-        (0 <= y) &&
-        (m_width > x) &&
-        (m_height > y))
-    {
-        uint32_t    cellIndex       = x + m_width * y;
-        uint32_t    cellDataIndex   = cellIndex / BITS;
-        uint8_t     bitIndex        = cellIndex - (cellDataIndex * BITS);
+            cells |= (0 == random(2)) ? 0x00000000 : 0x80000000;
 
-        if (false == state)
-        {
-            m_grids[gridId][cellDataIndex] &= ~(1 << bitIndex);
-        }
-        else
-        {
-            m_grids[gridId][cellDataIndex] |= 1 << bitIndex;
+            m_grid.setWord(y, wordIdx, cells);
         }
     }
 
     return;
 }
 
-uint8_t GameOfLifePlugin::countAliveNeighbours(uint8_t gridId, int16_t x, int16_t y)
+void GameOfLifePlugin::drawGrid(YAGfx& gfx, bool isChangedOnly)
 {
-    const int16_t   MAX_X   = 3;    /* 3 cells per row */
-    const int16_t   MAX_Y   = 3;    /* 3 cells per column */
-    uint8_t         count   = 0U;
-    int16_t         dX      = 0;
-    int16_t         dY      = 0;
-
-    /* Cell neighbours, marked with a '#':
-     * ###
-     * #x#
-     * ###
-     */
-
-    for(dY = 0; dY < MAX_Y; ++dY)
+    uint16_t y = 0U;
+
+    for(y = 0U; y < m_grid.getHeight(); ++y)
     {
-        int16_t neighbourY = (y - 1) + dY;
+        uint16_t wordIdx = 0U;
 
-        for(dX = 0; dX < MAX_X; ++dX)
+        for(wordIdx = 0U; wordIdx < m_grid.getWordsPerRow(); ++wordIdx)
         {
-            int16_t neighbourX = (x - 1) + dX;
+            uint32_t    cells   = m_grid.getWord(y, wordIdx);
+            uint32_t    mask    = (true == isChangedOnly) ? m_grid.getChangedWord(y, wordIdx) : UINT32_MAX;
+            uint16_t    x       = wordIdx * LifeGrid::BITS;
 
-            if ((x != neighbourX) ||
-                (y != neighbourY))
+            /* Stop as soon as no further cell in the word shall be drawn. */
+            while((0U != mask) && (m_grid.getWidth() > x))
             {
-                if (true == getCellState(gridId, neighbourX, neighbourY))
+                if (0U != (mask & 1U))
                 {
-                    ++count;
+                    if (0U == (cells & 1U))
+                    {
+                        gfx.drawPixel(x, y, ColorDef::BLACK);
+                    }
+                    else
+                    {
+                        gfx.drawPixel(x, y, ColorDef::BLUE);
+                    }
                 }
-            }
-        }
-    }
 
-    return count;
-}
-
-void GameOfLifePlugin::update(YAGfx& gfx, uint8_t gridId)
-{
-    int16_t x   = 0;
-    int16_t y   = 0;
-
-    for(y = 0; y < m_height; ++y)
-    {
-        for(x = 0; x < m_width; ++x)
-        {
-            if (false == getCellState(gridId, x, y))
-            {
-                gfx.drawPixel(x, y, ColorDef::BLACK);
-            }
-            else
-            {
-                gfx.drawPixel(x, y, ColorDef::BLUE);
+                mask    >>= 1U;
+                cells   >>= 1U;
+                ++x;
             }
         }
     }
@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "Plugin.hpp"
 #include <SimpleTimer.hpp>
+#include <LifeGrid.h>
 
 /******************************************************************************
  * Macros
@@ -70,6 +71,10 @@
  * 4. Any dead cell with exactly three live neighbours becomes a live cell, as if by reproduction.
  *
  * See https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
+ *
+ * The generations are calculated word parallel by the LifeGrid and only
+ * the changed cells are drawn. If the grid ends in a still life or an
+ * oscillator, the game restarts after a period.
  */
 class GameOfLifePlugin : public Plugin
 {
@@ -83,22 +88,10 @@ public:
      */
     GameOfLifePlugin(const String& name, uint16_t uid) :
         Plugin(name, uid),
-        m_activeGrid(0U),
-        m_gridSize(0U),
-        m_grids(),
-        m_width(0U),
-        m_height(0U),
-        m_displayTimer(),
+        m_grid(),
         m_restartTimer(),
         m_forceRestartTimer()
     {
-        uint8_t index = 0U;
-
-        while(GRIDS > index)
-        {
-            m_grids[index] = nullptr;
-            ++index;
-        }
     }
 
     /**
@@ -106,7 +99,6 @@ public:
      */
     ~GameOfLifePlugin()
     {
-        destroyGrids();
     }
 
     /**
@@ -164,90 +156,43 @@ public:
      */
     void update(YAGfx& gfx) final;
 
-private:
-
-    /** Number of grids */
-    static const uint8_t    GRIDS                   = 2U;
+    /**
+     * Get the update period. Every update shows the next generation.
+     *
+     * @return Update period in ms
+     */
+    uint32_t getUpdatePeriod() const final
+    {
+        return DISPLAY_PERIOD;
+    }
 
-    /** Bits per grid data, derived from uint32_t. */
-    static const uint8_t    BITS                    = 32U;
+private:
 
     /** Display update period in ms */
     static const uint32_t   DISPLAY_PERIOD          = 250U;
 
-    /** Restart period in ms after grid is stable. */
+    /** Restart period in ms after grid is in a cycle. */
     static const uint32_t   RESTART_PERIOD          = 1000U;
 
     /** Force restart period in ms. */
     static const uint32_t   FORCE_RESTART_PERIOD    = 10000U;
 
-    uint8_t     m_activeGrid;           /**< Current active grid */
-    uint32_t    m_gridSize;             /**< Size of one grid in number of elements */
-    uint32_t*   m_grids[GRIDS];         /**< Two grids as playfields. */
-    uint16_t    m_width;                /**< Grid width */
-    uint16_t    m_height;               /**< Grid height */
-    SimpleTimer m_displayTimer;         /**< Timer, used for cyclic display update. */
-    SimpleTimer m_restartTimer;         /**< Timer, used to restart the whole game of life if grid is stable. */
+    LifeGrid    m_grid;                 /**< Grid as playfield. */
+    SimpleTimer m_restartTimer;         /**< Timer, used to restart the whole game of life if the grid is in a cycle. */
     SimpleTimer m_forceRestartTimer;    /**< Timer, used to force a restart of the whole game of life. */
 
-    /**
-     * Create all grids.
-     *
-     * @return If successful, it will return true otherwise false.
-     */
-    bool createGrids();
-
-    /**
-     * Destroys all grids.
-     */
-    void destroyGrids();
-
     /**
      * Generate a random initial pattern.
-     *
-     * @param[in] gridId    Id of grid, where to generate.
-     */
-    void generateInitialPattern(uint8_t gridId);
-
-    /**
-     * Get cell state.
-     *
-     * @param[in] gridId    Id of grid, where the cell lives
-     * @param[in] x         x-coordinate of cell
-     * @param[in] y         y-coordinate of cell
-     *
-     * @return Alive (true) or dead (false).
-     */
-    bool getCellState(uint8_t gridId, int16_t x, int16_t y);
-
-    /**
-     * Set cell state.
-     *
-     * @param[in] gridId    Id of grid, where the cell lives
-     * @param[in] x         x-coordinate of cell
-     * @param[in] y         y-coordinate of cell
-     * @param[in] state     Alive (true) or dead (false).
-     */
-    void setCellState(uint8_t gridId, int16_t x, int16_t y, bool state);
-
-    /**
-     * Count all alive neighbours of cell.
-     *
-     * @param[in] gridId    Id of grid, where the cell lives
-     * @param[in] x         x-coordinate of cell
-     * @param[in] y         y-coordinate of cell
-     *
-     * @return Number of alive neighbours.
      */
-    uint8_t countAliveNeighbours(uint8_t gridId, int16_t x, int16_t y);
+    void generateInitialPattern();
 
     /**
-     * Update the display with the grid.
+     * Draw the cells of the grid.
      *
-     * @param[in] gfx       Graphics interface
-     * @param[in] gridId    Grid id
+     * @param[in] gfx           Graphics interface
+     * @param[in] isChangedOnly Draw only the cells, which changed in the last generation (true) or all cells (false).
      */
-    void update(YAGfx& gfx, uint8_t gridId);
+    void drawGrid(YAGfx& gfx, bool isChangedOnly);
 };
 
 /******************************************************************************
@@ -148,6 +148,8 @@ void GithubPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
+    /* No data is shown yet, therefore the first request shall not be conditional. */
+    m_client.clearValidators();
     initHttpClient();
     if (false == startHttpRequest())
     {
@@ -191,6 +193,7 @@ void GithubPlugin::process()
         {
             /* If a request fails, show standard icon and a '?' */
             m_textWidget.setFormatStr("\\calign?");
+            m_client.clearValidators();
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -224,6 +227,7 @@ void GithubPlugin::process()
             {
                 /* If a request fails, show standard icon and a '?' */
                 m_textWidget.setFormatStr("\\calign?");
+                m_client.clearValidators();
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -374,6 +378,15 @@ void GithubPlugin::initHttpClient()
                 if (DeserializationError::Ok != error.code())
                 {
                     LOG_WARNING("JSON parse error: %s", error.c_str());
+
+                    /* The response callback runs after the HTTP scheduler
+                     * stored the validators of the response. Forget them,
+                     * otherwise the next requests would get "not modified".
+                     */
+                    this->m_client.clearValidators();
+
+                    delete jsonDoc;
+                    jsonDoc = nullptr;
                 }
                 else
                 {
@@ -413,6 +426,14 @@ void GithubPlugin::initHttpClient()
             (void)this->m_taskProxy.send(msg);
         }
     );
+
+    m_client.regOnUnchanged(
+        []()
+        {
+            /* The last response is still valid, nothing to parse and to update. */
+            LOG_INFO("Data unchanged.");
+        }
+    );
 }
 
 void GithubPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
@@ -422,6 +443,7 @@ void GithubPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
     if (false == jsonStargazersCount.is<uint32_t>())
     {
         LOG_WARNING("JSON stargazers_count type missmatch or missing.");
+        m_client.clearValidators();
     }
     else
     {
@@ -45,7 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include "Plugin.hpp"
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
@@ -270,7 +270,7 @@ private:
     String                  m_githubRepository;         /**< The github repository name */
     String                  m_urlIcon;                  /**< REST API URL for updating the icon */
     String                  m_urlText;                  /**< REST API URL for updating the text */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
+    HttpRequest             m_client;                   /**< HTTP request, executed by the HTTP scheduler. */
     SimpleTimer             m_requestTimer;             /**< Timer used for cyclic request of new data. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;        /**< Is connection error happened? */
@@ -34,7 +34,7 @@
  *****************************************************************************/
 #include "GruenbeckPlugin.h"
 #include "RestApi.h"
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "FileSystem.h"
 
 #include <ArduinoJson.h>
@@ -44,7 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include <stdint.h>
 #include "Plugin.hpp"
 #include <WidgetGroup.h>
@@ -269,7 +269,7 @@ private:
     String                  m_ipAddress;                /**< IP-address of the Gruenbeck server. */
     bool                    m_httpResponseReceived;     /**< Flag to indicate a received HTTP response. */
     String                  m_relevantResponsePart;     /**< String used for the relevant part of the HTTP response. */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
+    HttpRequest             m_client;                   /**< HTTP request, executed by the HTTP scheduler. */
     SimpleTimer             m_requestTimer;             /**< Timer, used for cyclic request of new data. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                    m_isConnectionError;        /**< Is connection error happened? */
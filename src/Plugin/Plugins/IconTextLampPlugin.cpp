@@ -37,6 +37,7 @@
 #include "FileSystem.h"
 
 #include <Logging.h>
+#include <RawImgLoader.h>
 #include <ArduinoJson.h>
 
 /******************************************************************************
@@ -306,6 +307,9 @@ void IconTextLampPlugin::stop()
     {
         LOG_INFO("File %s removed", getFileName(FILE_EXT_SPRITE_SHEET).c_str());
     }
+
+    /* The bitmap image cache isn't needed anymore. */
+    (void)FILESYSTEM.remove(RawImgLoader::getCacheFileName(getFileName(FILE_EXT_BITMAP)));
 }
 
 void IconTextLampPlugin::update(YAGfx& gfx)
@@ -45,7 +45,6 @@
  *****************************************************************************/
 #include <stdint.h>
 #include "Plugin.hpp"
-#include <SimpleTimer.hpp>
 
 /******************************************************************************
  * Macros
@@ -69,8 +68,7 @@ public:
      * @param[in] uid   Unique id
      */
     MatrixPlugin(const String& name, uint16_t uid) :
-        Plugin(name, uid),
-        m_timer()
+        Plugin(name, uid)
     {
     }
 
@@ -102,12 +100,21 @@ public:
      */
     void update(YAGfx& gfx) final;
 
+    /**
+     * Get the update period. The display is updated in a slower period
+     * than the display refresh period.
+     *
+     * @return Update period in ms
+     */
+    uint32_t getUpdatePeriod() const final
+    {
+        return UPDATE_PERIOD;
+    }
+
 private:
 
     /** Display update period in ms. */
     static const uint32_t   UPDATE_PERIOD   = 100U;
-
-    SimpleTimer m_timer;    /**< Updates the display in a slower period than update() is called. */
 };
 
 /******************************************************************************
@@ -188,6 +188,8 @@ void OpenWeatherPlugin::start(uint16_t width, uint16_t height)
         }
     }
 
+    /* No data is shown yet, therefore the first request shall not be conditional. */
+    m_client.clearValidators();
     initHttpClient();
     if (false == startHttpRequest())
     {
@@ -233,6 +235,7 @@ void OpenWeatherPlugin::process()
             /* If a request fails, show standard icon and a '?' */
             (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
             m_textWidget.setFormatStr("\\calign?");
+            m_client.clearValidators();
 
             m_requestTimer.start(UPDATE_PERIOD_SHORT);
         }
@@ -258,9 +261,18 @@ void OpenWeatherPlugin::process()
             break;
 
         case MSG_TYPE_RSP:
-            if (nullptr != msg.rsp)
+            /* A missing JSON document means, the response body couldn't be parsed. */
+            if (nullptr == msg.rsp)
             {
-                handleWebResponse(*msg.rsp);
+                m_isRspInvalid = true;
+            }
+            else
+            {
+                if (false == handleWebResponse(*msg.rsp))
+                {
+                    m_isRspInvalid = true;
+                }
+
                 delete msg.rsp;
                 msg.rsp = nullptr;
             }
@@ -274,6 +286,7 @@ void OpenWeatherPlugin::process()
                 /* If a request fails, show standard icon and a '?' */
                 (void)m_bitmapWidget.load(FILESYSTEM, IMAGE_PATH_STD_ICON);
                 m_textWidget.setFormatStr("\\calign?");
+                m_client.clearValidators();
 
                 m_requestTimer.start(UPDATE_PERIOD_SHORT);
             }
@@ -291,6 +304,18 @@ void OpenWeatherPlugin::process()
         }
     }
 
+    /* The HTTP scheduler remembers the validators of every successful
+     * response, before its body is parsed. If the data of the response was
+     * not accepted, they must be forgotten after the request is finished.
+     * Otherwise all following requests would get a "not modified" response.
+     */
+    if ((true == m_isRspInvalid) &&
+        (false == m_client.isPending()))
+    {
+        m_client.clearValidators();
+        m_isRspInvalid = false;
+    }
+
     return;
 }
 
@@ -630,17 +655,19 @@ void OpenWeatherPlugin::initHttpClient()
     /* Note: All registered callbacks are running in a different task context!
      *       Therefore it is not allowed to access a member here directly.
      *       The processing must be deferred via task proxy.
+     *
+     *       The one call API response is big, therefore it is parsed while
+     *       it is received and only the filtered values are kept.
      */
-    m_client.regOnResponse(
-        [this](const HttpResponse& rsp)
+    m_client.regOnBody(
+        [this](Stream& stream)
         {
             const size_t            JSON_DOC_SIZE   = 256U;
             DynamicJsonDocument*    jsonDoc         = new(std::nothrow) DynamicJsonDocument(JSON_DOC_SIZE);
+            Msg                     msg;
 
             if (nullptr != jsonDoc)
             {
-                size_t                          payloadSize             = 0U;
-                const char*                     payload                 = reinterpret_cast<const char*>(rsp.getPayload(payloadSize));
                 const size_t                    FILTER_SIZE             = 128U;
                 StaticJsonDocument<FILTER_SIZE> filter;
                 JsonObject                      filterCurrent           = filter.createNestedObject("current");
@@ -658,25 +685,28 @@ void OpenWeatherPlugin::initHttpClient()
                     LOG_ERROR("Less memory for filter available.");
                 }
 
-                error = deserializeJson(*jsonDoc, payload, payloadSize, DeserializationOption::Filter(filter));
+                error = deserializeJson(*jsonDoc, stream, DeserializationOption::Filter(filter));
 
                 if (DeserializationError::Ok != error.code())
                 {
                     LOG_WARNING("JSON parse error: %s", error.c_str());
+
+                    delete jsonDoc;
+                    jsonDoc = nullptr;
                 }
-                else
-                {
-                    Msg msg;
+            }
 
-                    msg.type    = MSG_TYPE_RSP;
-                    msg.rsp     = jsonDoc;
+            /* Without JSON document the response is signalled as invalid.
+             * The validators can't be cleared here, because the HTTP scheduler
+             * may wait for this reader.
+             */
+            msg.type    = MSG_TYPE_RSP;
+            msg.rsp     = jsonDoc;
 
-                    if (false == this->m_taskProxy.send(msg))
-                    {
-                        delete jsonDoc;
-                        jsonDoc = nullptr;
-                    }
-                }
+            if (false == this->m_taskProxy.send(msg))
+            {
+                delete jsonDoc;
+                jsonDoc = nullptr;
             }
         }
     );
@@ -702,10 +732,19 @@ void OpenWeatherPlugin::initHttpClient()
             (void)this->m_taskProxy.send(msg);
         }
     );
+
+    m_client.regOnUnchanged(
+        []()
+        {
+            /* The last response is still valid, nothing to parse and to update. */
+            LOG_INFO("Data unchanged.");
+        }
+    );
 }
 
-void OpenWeatherPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
+bool OpenWeatherPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
 {
+    bool        isValid         = false;
     JsonVariant jsonCurrent     = jsonDoc["current"];
     JsonVariant jsonTemperature = jsonCurrent["temp"];
     JsonVariant jsonUvi         = jsonCurrent["uvi"];
@@ -787,7 +826,11 @@ void OpenWeatherPlugin::handleWebResponse(DynamicJsonDocument& jsonDoc)
         m_currentWeatherIcon = weatherConditionIcon;
 
         updateDisplay(false);
+
+        isValid = true;
     }
+
+    return isValid;
 }
 
 
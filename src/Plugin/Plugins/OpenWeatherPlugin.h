@@ -45,7 +45,7 @@
  *****************************************************************************/
 #include <stdint.h>
 #include "Plugin.hpp"
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 
 #include <WidgetGroup.h>
 #include <BitmapWidget.h>
@@ -91,6 +91,7 @@ public:
         m_updateContentTimer(),
         m_mutex(),
         m_isConnectionError(false),
+        m_isRspInvalid(false),
         m_currentTemp("\\calign?"),
         m_currentWeatherIcon(IMAGE_PATH_STD_ICON),
         m_currentUvIndex("\\calign?"),
@@ -123,7 +124,7 @@ public:
      */
     ~OpenWeatherPlugin()
     {
-        m_client.regOnResponse(nullptr);
+        m_client.regOnBody(nullptr);
         m_client.regOnClosed(nullptr);
         m_client.regOnError(nullptr);
 
@@ -388,11 +389,12 @@ private:
     OtherWeatherInformation     m_additionalInformation;    /**< The configured additional weather information. */
     String                      m_units;                    /**< The units. */
     String                      m_configurationFilename;    /**< String used for specifying the configuration filename. */
-    AsyncHttpClient             m_client;                   /**< Asynchronous HTTP client. */
+    HttpRequest                 m_client;                   /**< HTTP request, executed by the HTTP scheduler. */
     SimpleTimer                 m_requestTimer;             /**< Timer used for cyclic request of new data. */
     SimpleTimer                 m_updateContentTimer;       /**< Timer used for duration ticks in [s]. */
     mutable MutexRecursive      m_mutex;                    /**< Mutex to protect against concurrent access. */
     bool                        m_isConnectionError;        /**< Is connection error happened? */
+    bool                        m_isRspInvalid;             /**< Was the last response not accepted? */
     String                      m_currentTemp;              /**< The current temperature. */
     String                      m_currentWeatherIcon;       /**< The current weather condition icon. */
     String                      m_currentUvIndex;           /**< The current UV index. */
@@ -464,8 +466,10 @@ private:
      * Handle a web response from the server.
      * 
      * @param[in] jsonDoc   Web response as JSON document
+     *
+     * @return If the response is valid, it will return true otherwise false.
      */
-    void handleWebResponse(DynamicJsonDocument& jsonDoc);
+    bool handleWebResponse(DynamicJsonDocument& jsonDoc);
 
     /**
      * Saves current configuration to JSON file.
@@ -32,7 +32,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "ClockDrv.h"
 #include "Settings.h"
 #include "ShellyPlugSPlugin.h"
@@ -44,7 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "Plugin.hpp"
 
 #include <WidgetGroup.h>
@@ -251,7 +251,7 @@ private:
     BitmapWidget            m_bitmapWidget;     /**< Bitmap widget, used to show the icon. */
     TextWidget              m_textWidget;       /**< Text widget, used for showing the text. */
     String                  m_ipAddress;        /**< IP-address of the ShellyPlugS server. */
-    AsyncHttpClient         m_client;           /**< Asynchronous HTTP client. */
+    HttpRequest             m_client;           /**< HTTP request, executed by the HTTP scheduler. */
     mutable MutexRecursive  m_mutex;            /**< Mutex to protect against concurrent access. */
     SimpleTimer             m_requestTimer;     /**< Timer is used for cyclic ShellyPlugS  http request. */
 
@@ -62,27 +62,6 @@
 /* Initialize plugin topic. */
 const char*     SoundReactivePlugin::TOPIC_CHANNEL                      = "/cfg";
 
-/* Initialize the list with the high edge frequency bin of the center band frequency. */
-const uint16_t  SoundReactivePlugin::LIST_16_BAND_HIGH_EDGE_FREQ_BIN[]  =
-{
-    4U,
-    5U,
-    7U,
-    9U,
-    12U,
-    16U,
-    21U,
-    27U,
-    36U,
-    48U,
-    63U,
-    84U,
-    111U,
-    146U,
-    193U,
-    255U
-};
-
 /******************************************************************************
  * Public Methods
  *****************************************************************************/
@@ -142,15 +121,9 @@ void SoundReactivePlugin::start(uint16_t width, uint16_t height)
 {
     MutexGuard<MutexRecursive> guard(m_mutex);
 
-    m_freqBins = new(std::nothrow) double[SpectrumAnalyzer::getInstance().getFreqBinsLen()];
-
-    if (nullptr == m_freqBins)
+    if (false == SpectrumAnalyzer::getInstance().start())
     {
-        LOG_ERROR("Couldn't get memory for frequency bins.");
-    }
-    else
-    {
-        SpectrumAnalyzer::getInstance().start();
+        LOG_ERROR("Couldn't start spectrum analyzer.");
     }
 
     m_decayPeakTimer.start(DECAY_PEAK_PERIOD);
@@ -179,12 +152,6 @@ void SoundReactivePlugin::stop()
 
     SpectrumAnalyzer::getInstance().stop();
 
-    if (nullptr != m_freqBins)
-    {
-        delete[] m_freqBins;
-        m_freqBins = nullptr;
-    }
-
     if (false != FILESYSTEM.remove(configurationFilename))
     {
         LOG_INFO("File %s removed", configurationFilename.c_str());
@@ -195,12 +162,21 @@ void SoundReactivePlugin::stop()
 
 void SoundReactivePlugin::process()
 {
-    uint8_t                     bandIdx         = 0U;
-    MutexGuard<MutexRecursive>  guard(m_mutex);
+    SpectrumAnalyzer::OctaveBands   octaveBands;
+    uint32_t                        octaveBandsSeq  = SpectrumAnalyzer::getInstance().getOctaveBands(octaveBands);
+    MutexGuard<MutexRecursive>      guard(m_mutex);
 
-    if (true == SpectrumAnalyzer::getInstance().areFreqBinsReady())
+    /* The spectrum analyzer provides the octave bands already in dB SPL with
+     * automatic gain control, without locking. Only the bar heights are left.
+     */
+    if ((0U != octaveBandsSeq) &&
+        (m_octaveBandsSeq != octaveBandsSeq))
     {
-        const size_t freqBinLen = SpectrumAnalyzer::getInstance().getFreqBinsLen();
+        uint8_t     bandIdx     = 0U;
+        uint8_t     octaveIdx   = 0U;
+        const float MAX_HEIGHT  = static_cast<float>(m_maxHeight);
+
+        m_octaveBandsSeq = octaveBandsSeq;
 
         /* Decay peak periodically */
         if (true == m_decayPeakTimer.isTimeout())
@@ -216,159 +192,38 @@ void SoundReactivePlugin::process()
             m_decayPeakTimer.restart();
         }
 
-        if (nullptr != m_freqBins)
+        /* Downscale to the bar height in relation to dynamic range.
+         * If less frequency bands are shown, they will be simply averaged.
+         */
+        for(bandIdx = 0U; bandIdx < m_numOfFreqBands; ++bandIdx)
         {
-            /* Copy frequency bins from spectrum analyzer. */
-            if (true == SpectrumAnalyzer::getInstance().getFreqBins(m_freqBins, freqBinLen))
-            {
-                float           octaveFreqBands[MAX_FREQ_BANDS];
-                uint16_t        freqBinIdx                      = 0U;
-                int32_t         divisor                         = 0;
-                float           peak                            = 0.0f;
-                float           avgDigital                      = 0.0f;
-
-                /* Sum up the frequency bin results of the spectrum analyzer and
-                 * create the octave frequency bands.
-                 */
-                freqBinIdx  = 1U; /* Don't use the first frequency bin, because it contains the DC part. */
-                bandIdx     = 0U;
-                octaveFreqBands[bandIdx] = 0.0f;
-                while((freqBinLen > freqBinIdx) && (MAX_FREQ_BANDS > bandIdx))
-                {
-                    octaveFreqBands[bandIdx] += static_cast<float>(m_freqBins[freqBinIdx]);
-                    ++divisor; /* Count number of added frequency bins. */
-
-                    /* If the current frequency bin is equal than the current
-                     * high edge frequency of the band, the following frequency
-                     * bin's will be assigned to the next band.
-                     */
-                    if ((MAX_FREQ_BANDS > bandIdx) &&
-                        (LIST_16_BAND_HIGH_EDGE_FREQ_BIN[bandIdx] == freqBinIdx))
-                    {
-                        /* Any frequency band added? */
-                        if (0 < divisor)
-                        {
-                            /* Depends on how many frequency bins were added. */
-                            octaveFreqBands[bandIdx] /= static_cast<float>(divisor);
-
-                            divisor = 0;
-                        }
-
-                        ++bandIdx;
-
-                        if (MAX_FREQ_BANDS > bandIdx)
-                        {
-                            octaveFreqBands[bandIdx] = static_cast<float>(m_freqBins[freqBinIdx]);
-                            ++divisor; /* Count number of added frequency bins. */
-                        }
-                    }
-
-                    ++freqBinIdx;
-                }
+            float       avg         = 0.0f;
+            uint16_t    barHeight   = 0U;
 
-                /* Calculate the amplitude average over the spectrum. */
-                for(bandIdx = 0U; bandIdx < MAX_FREQ_BANDS; ++bandIdx)
-                {
-                    avgDigital += octaveFreqBands[bandIdx];
-                }
-                avgDigital /= static_cast<float>(MAX_FREQ_BANDS);
-
-                for(bandIdx = 0U; bandIdx < MAX_FREQ_BANDS; ++bandIdx)
-                {
-                    /* If the ampltiude average is lower than the equivalent input noise (from datasheet),
-                     * the correction factors will be calculated. The amplitude average is used to detect
-                     * silence, which is necessary for this automatic calibration.
-                     */
-                    if (INMP441_NOISE_FLOOR_DIGITAL > static_cast<int32_t>(avgDigital))
-                    {
-                        constexpr const float   WEIGHT_NEW_VALUE    = 0.1f;
-                        constexpr const float   WEIGHT_OLD_VALUE    = 1.0f - WEIGHT_NEW_VALUE;
-                        constexpr const float   NOISE_FLOOR         = static_cast<float>(INMP441_NOISE_FLOOR_DIGITAL);
-
-                        /* Calculate with weighted average to avoid jumping. */
-                        m_corrFactors[bandIdx] = WEIGHT_OLD_VALUE * m_corrFactors[bandIdx] + WEIGHT_NEW_VALUE * (NOISE_FLOOR / octaveFreqBands[bandIdx]);
-                    }
-
-                    /* Normalize */
-                    octaveFreqBands[bandIdx] *= m_corrFactors[bandIdx];
-
-                    /* Calculate the spectrum amplitude in dB SPL
-                     * The shown frequency spectrum amplitudes consider now the silent and loud parts better.
-                     *
-                     * = sensitivity [dB SPL] + 20 * log10(frequency amplitude digital / sensitivity digital)
-                     */
-                    octaveFreqBands[bandIdx] = INMP441_SENSITIVITY_SPL + 20.0f * log10f(octaveFreqBands[bandIdx] / static_cast<float>(IMMP441_SENSITIVITY_DIGITAL));
-
-                    /* The amplitude shall consider only the dynamic range
-                     * by removing the equivalent input noise level.
-                     */
-                    if (INMP441_NOISE_SPL >= octaveFreqBands[bandIdx])
-                    {
-                        octaveFreqBands[bandIdx] = HEARING_THRESHOLD;
-                    }
-                    else
-                    {
-                        octaveFreqBands[bandIdx] -= INMP441_NOISE_SPL;
-                    }
-
-                    /* Determine peak over all frequency bands for automatic gain control. */
-                    if (octaveFreqBands[bandIdx] > peak)
-                    {
-                        peak = octaveFreqBands[bandIdx];
-                    }
-                }
+            if (NUM_OF_BANDS_8 == m_numOfFreqBands)
+            {
+                avg = (octaveBands.levels[octaveIdx] + octaveBands.levels[octaveIdx + 1U]) / 2.0f;
+                octaveIdx += 2U;
+            }
+            else
+            {
+                avg = octaveBands.levels[octaveIdx];
+                octaveIdx += 1U;
+            }
 
-                /* Adapt the dynamic range on the y-axis, but limit it to a minimum,
-                 * otherwise the bar's will jump driven by silent tones.
-                 */
-                {
-                    constexpr const float   WEIGHT_NEW_VALUE    = 0.25f;
-                    constexpr const float   WEIGHT_OLD_VALUE    = 1.0f - WEIGHT_NEW_VALUE;
+            barHeight = static_cast<uint16_t>((avg * MAX_HEIGHT) / octaveBands.dynamicRange);
 
-                    m_peak = WEIGHT_NEW_VALUE * peak + WEIGHT_OLD_VALUE * m_peak;
+            if (m_maxHeight < barHeight)
+            {
+                barHeight = m_maxHeight;
+            }
 
-                    if (MIN_DYNAMIC_RANGE > m_peak)
-                    {
-                        m_peak = MIN_DYNAMIC_RANGE;
-                    }
-                }
+            m_barHeight[bandIdx] = barHeight;
 
-                /* Downscale to the bar height in relation to dynamic range.
-                 * If less frequency bands are shown, they will be simply averaged.
-                 */
-                freqBinIdx = 0U;
-                for(bandIdx = 0U; bandIdx < MAX_FREQ_BANDS; ++bandIdx)
-                {
-                    float       avg         = 0.0f;
-                    uint16_t    barHeight   = 0U;
-                    const float MAX_HEIGHT  = static_cast<float>(m_maxHeight);
-
-                    if (NUM_OF_BANDS_8 == m_numOfFreqBands)
-                    {
-                        avg = (octaveFreqBands[freqBinIdx] + octaveFreqBands[freqBinIdx + 1U]) / 2.0f;
-                        freqBinIdx += 2U;
-                    }
-                    else
-                    {
-                        avg = octaveFreqBands[freqBinIdx];
-                        freqBinIdx += 1U;
-                    }
-
-                    barHeight = static_cast<uint16_t>((avg * MAX_HEIGHT) / m_peak);
-
-                    if (m_maxHeight < barHeight)
-                    {
-                        barHeight = m_maxHeight;
-                    }
-
-                    m_barHeight[bandIdx] = barHeight;
-
-                    /* Move peak up, if necessary. */
-                    if (m_barHeight[bandIdx] > m_peakHeight[bandIdx])
-                    {
-                        m_peakHeight[bandIdx] = m_barHeight[bandIdx];
-                    }
-                }
+            /* Move peak up, if necessary. */
+            if (m_barHeight[bandIdx] > m_peakHeight[bandIdx])
+            {
+                m_peakHeight[bandIdx] = m_barHeight[bandIdx];
             }
         }
     }
@@ -48,7 +48,6 @@
 
 #include <SimpleTimer.hpp>
 #include <Mutex.hpp>
-#include <math.h>
 
 /******************************************************************************
  * Macros
@@ -80,18 +79,9 @@ public:
         m_numOfFreqBands(NUM_OF_BANDS_16),
         m_decayPeakTimer(),
         m_maxHeight(0U),
-        m_freqBins(nullptr),
-        m_corrFactors(),
-        m_peak(INMP441_MAX_SPL)
+        m_octaveBandsSeq(0U)
     {
-        uint8_t bandIdx = 0U;
-
         (void)m_mutex.create();
-
-        for(bandIdx = 0U; bandIdx < MAX_FREQ_BANDS; ++bandIdx)
-        {
-            m_corrFactors[bandIdx] = 1.0f;
-        }
     }
 
     /**
@@ -99,11 +89,6 @@ public:
      */
     ~SoundReactivePlugin()
     {
-        if (nullptr != m_freqBins)
-        {
-            delete[] m_freqBins;
-        }
-
         m_mutex.destroy();
     }
 
@@ -237,8 +222,8 @@ private:
 
     /**
      * The max. number of frequency bands, the plugin supports.
-     * If you change this, the number of frequency bins which to sum up
-     * must be calculated again.
+     * It must be equal to the number of octave bands, which the spectrum
+     * analyzer provides.
      */
     static const uint8_t    MAX_FREQ_BANDS                      = 16U;
 
@@ -247,81 +232,13 @@ private:
      */
     static const uint32_t   DECAY_PEAK_PERIOD                   = 100U;
 
-    /**
-     * INMP441 data word bit width.
-     */
-    static const constexpr uint8_t  INMP441_DATA_WORD_BITS      = 24U;
-
-    /**
-     * INMP441 nominal sensitivity in dbFS at 1 kHz.
-     */
-    static const constexpr float    INMP441_SENSITIVITY         = -26.0f;
-
-    /**
-     * INMP441 the applied sound pressure level by measuring the sensitivity
-     * at 1 kHz.
-     */
-    static const constexpr float    INMP441_SENSITIVITY_SPL     = 94.0f;
-
-    /**
-     * INMP441 the noise floor in dbFS.
-     */
-    static const constexpr float    INMP441_NOISE_FLOOR         = -87.0f;
-
-    /**
-     * The calculated full scale value of the INMP441.
-     */
-    static const constexpr int32_t  INMP441_FULL_SCALE          = (1 << (INMP441_DATA_WORD_BITS - 1)) - 1;
-
-    /**
-     * INMP441 the nominal sensitivity as digital value.
-     * = 10^(sensitivity [dbFS] / 20) * full scale
-     */
-    static const constexpr int32_t  IMMP441_SENSITIVITY_DIGITAL = powf(10.0f, INMP441_SENSITIVITY / 20.0f) * INMP441_FULL_SCALE;
-
-    /**
-     * INMP441 the noise floor as digital value.
-     * = 10^(noise floor [dbFS] / 20) * full scale
-     */
-    static const constexpr int32_t  INMP441_NOISE_FLOOR_DIGITAL = powf(10.0f, INMP441_NOISE_FLOOR / 20.0f) * INMP441_FULL_SCALE;
-
-    /**
-     * INMP441 the max. sound pressure level in db SPL.
-     * = sensitivity [db SPL] + 20 * log10(full scale / sensitivity digital)
-     */
-    static const constexpr int32_t  INMP441_MAX_SPL             = INMP441_SENSITIVITY_SPL + 20.0f * log10f((1.0f * INMP441_FULL_SCALE) / IMMP441_SENSITIVITY_DIGITAL);
-
-    /**
-     * INMP441 the equivalent input noise in db SPL.
-     * = sensitivity [db SPL] + 20 * log10(noise floor digital / sensitivity digital)
-     */
-    static const constexpr int32_t  INMP441_NOISE_SPL           = INMP441_SENSITIVITY_SPL + 20.0f * log10f((1.0f * INMP441_NOISE_FLOOR_DIGITAL) / IMMP441_SENSITIVITY_DIGITAL);
-
-    /**
-     * The human hearing threshold in dB SPL.
-     */
-    static const constexpr float    HEARING_THRESHOLD           = 0.0f;
-
-    /**
-     * Minimum dynamic range in dB SPL, on the y-axis.
-     */
-    static const constexpr float    MIN_DYNAMIC_RANGE           = 40.0f;
-
-    /**
-     * List with the high edge frequency bin of the center band frequency.
-     * This list is valid for 16 bands.
-     */
-    static const uint16_t   LIST_16_BAND_HIGH_EDGE_FREQ_BIN[NUM_OF_BANDS_16];
-
     mutable MutexRecursive  m_mutex;                        /**< Mutex to protect against concurrent access. */
     uint16_t                m_barHeight[MAX_FREQ_BANDS];    /**< The current height of every bar, which represents a frequency band. */
     uint16_t                m_peakHeight[MAX_FREQ_BANDS];   /**< The peak of every bar, which represents the peak in the frequency band. */
     NumOfBands              m_numOfFreqBands;               /**< Current configured number of frequency bands, which to show. 8/16 are supported. */
     SimpleTimer             m_decayPeakTimer;               /**< Periodically decays the peak of a bar. */
     uint16_t                m_maxHeight;                    /**< Max. height of a bar in pixel. */
-    double*                 m_freqBins;                     /**< List of frequency bins, calculated from the spectrum analyzer results. On the heap to avoid stack overflow. */
-    float                   m_corrFactors[MAX_FREQ_BANDS];  /**< Correction factors per frequency band. The factors are calculated if the signal average is lower than the microphone noise floor. */
-    float                   m_peak;                         /**< Determined signal peak over all frequency bands in dB SPL, used for AGC. */
+    uint32_t                m_octaveBandsSeq;               /**< Number of the last processed octave bands of the spectrum analyzer. */
 
     /**
      * Saves current configuration to JSON file.
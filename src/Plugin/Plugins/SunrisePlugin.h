@@ -44,7 +44,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
 #include "Plugin.hpp"
 
 #include <WidgetGroup.h>
@@ -262,7 +262,7 @@ private:
     String                  m_longitude;                /**< Longitude of sunrise location */
     String                  m_latitude;                 /**< Latitude of sunrise location */
     String                  m_relevantResponsePart;     /**< String used for the relevant part of the HTTP response. */
-    AsyncHttpClient         m_client;                   /**< Asynchronous HTTP client. */
+    HttpRequest             m_client;                   /**< HTTP request, executed by the HTTP scheduler. */
     SimpleTimer             m_requestDataTimer;         /**< Timer, used for cyclic request of new data. */
     mutable MutexRecursive  m_mutex;                    /**< Mutex to protect against concurrent access. */
     SimpleTimer             m_requestTimer;             /**< Timer is used for cyclic sunrise/sunset http request. */
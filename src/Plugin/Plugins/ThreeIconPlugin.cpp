@@ -38,6 +38,7 @@
 #include "FileSystem.h"
 
 #include <Logging.h>
+#include <RawImgLoader.h>
 
 /******************************************************************************
  * Compiler Switches
@@ -280,6 +281,9 @@ void ThreeIconPlugin::stop()
         {
             LOG_INFO("File %s removed", getFileName(iconId, FILE_EXT_SPRITE_SHEET).c_str());
         }
+
+        /* The bitmap image cache isn't needed anymore. */
+        (void)FILESYSTEM.remove(RawImgLoader::getCacheFileName(getFileName(iconId, FILE_EXT_BITMAP)));
     }
 
     return;
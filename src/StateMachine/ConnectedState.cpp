@@ -36,6 +36,7 @@
 #include "SysMsg.h"
 #include "UpdateMgr.h"
 #include "MyWebServer.h"
+#include "WebSocket.h"
 #include "Settings.h"
 #include "ClockDrv.h"
 #include "ButtonDrv.h"
@@ -45,6 +46,7 @@
 #include "RestartState.h"
 #include "ErrorState.h"
 #include "HttpStatus.h"
+#include "HttpScheduler.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
@@ -166,6 +168,12 @@ void ConnectedState::process(StateMachine& sm)
     /* Handle update, there may be one in the background. */
     UpdateMgr::getInstance().process();
 
+    /* Push display content to the websocket subscribers. */
+    WebSocketSrv::getInstance().process();
+
+    /* Execute the HTTP requests of the plugins. */
+    HttpScheduler::getInstance().process();
+
     /* Restart requested by update manager? This may happen after a successful received
      * new firmware or filesystem binary.
      */
@@ -67,6 +67,7 @@ AsyncHttpClient::AsyncHttpClient() :
     m_onRspCallback(nullptr),
     m_onClosedCallback(),
     m_onErrorCallback(),
+    m_onBodyCallback(nullptr),
     m_hostname(),
     m_port(0U),
     m_isSecure(false),
@@ -81,7 +82,7 @@ AsyncHttpClient::AsyncHttpClient() :
     m_urlEncodedPars(),
     m_payload(nullptr),
     m_payloadSize(0U),
-    m_rspPart(RESPONSE_PART_STATUS_LINE),
+    m_rspPart(RESPONSE_PART_HEADER),
     m_rsp(),
     m_rspLine(),
     m_transferCoding(TRANSFER_CODING_IDENTITY),
@@ -89,7 +90,8 @@ AsyncHttpClient::AsyncHttpClient() :
     m_contentIndex(0U),
     m_chunkSize(0U),
     m_chunkIndex(0U),
-    m_chunkBodyPart(CHUNK_SIZE)
+    m_chunkBodyPart(CHUNK_SIZE),
+    m_bodyStream()
 {
     m_tcpClient.onConnect(  [this](void* arg, AsyncClient* client)
                             {
@@ -365,6 +367,16 @@ void AsyncHttpClient::regOnError(const OnError& onError)
     m_onErrorCallback = onError;
 }
 
+void AsyncHttpClient::regOnBody(const OnBody& onBody)
+{
+    m_onBodyCallback = onBody;
+}
+
+void AsyncHttpClient::stopBodyReader()
+{
+    m_bodyStream.stop();
+}
+
 bool AsyncHttpClient::GET()
 {
     bool status = false;
@@ -518,22 +530,25 @@ void AsyncHttpClient::onData(AsyncClient* client, const uint8_t* data, size_t le
 
     while((len > index) && (false == isError))
     {
+        HttpRspParser::Result result = HttpRspParser::RESULT_PENDING;
+
         switch(m_rspPart)
         {
-        case RESPONSE_PART_STATUS_LINE:
-            if (true == parseRspStatusLine(asciiData, len, index))
+        case RESPONSE_PART_HEADER:
+            result = m_rsp.parseHeader(asciiData, len, index);
+
+            if (HttpRspParser::RESULT_ERROR == result)
+            {
+                LOG_ERROR("Header error.");
+                client->close();
+                isError = true;
+            }
+            else if (HttpRspParser::RESULT_COMPLETE == result)
             {
                 LOG_DEBUG("Rsp. HTTP-Version: %s", m_rsp.getHttpVersion().c_str());
                 LOG_DEBUG("Rsp. Status-Code: %u", m_rsp.getStatusCode());
                 LOG_DEBUG("Rsp. Reason-Phrase: %s", m_rsp.getReasonPhrase().c_str());
 
-                m_rspPart = RESPONSE_PART_HEADER;
-            }
-            break;
-
-        case RESPONSE_PART_HEADER:
-            if (true == parseRspHeader(asciiData, len, index))
-            {
                 /* Examine response header.
                  * This is important to determine the number of following
                  * payload data and to know when the last data is
@@ -546,15 +561,41 @@ void AsyncHttpClient::onData(AsyncClient* client, const uint8_t* data, size_t le
                     client->close();
                     isError = true;
                 }
-                else if (TRANSFER_CODING_IDENTITY == m_transferCoding)
+                /* E.g. a 304 (Not Modified) response ends after the header. */
+                else if (false == isBodyExpected())
+                {
+                    finishResponse();
+                }
+                else
                 {
                     /* "Content-Length" may be missing. */
-                    if (0U == m_contentLength)
+                    if ((TRANSFER_CODING_IDENTITY == m_transferCoding) &&
+                        (0U == m_contentLength))
                     {
                         m_contentLength = len - index;
                     }
+
+                    /* Provide the body via stream, instead of storing it in the response? */
+                    if ((nullptr != m_onBodyCallback) &&
+                        ((TRANSFER_CODING_CHUNCKED == m_transferCoding) || (0U < m_contentLength)))
+                    {
+                        if (false == m_bodyStream.begin(m_onBodyCallback))
+                        {
+                            LOG_WARNING("Body is stored in the response.");
+                        }
+                    }
+
+                    /* Avoid reallocations of the payload buffer, if the body size is known.
+                     * The reservation is limited, because the Content-Length is untrusted.
+                     */
+                    if ((false == m_bodyStream.isStarted()) &&
+                        (TRANSFER_CODING_IDENTITY == m_transferCoding))
+                    {
+                        m_rsp.reservePayload((PAYLOAD_RESERVE_MAX < m_contentLength) ? PAYLOAD_RESERVE_MAX : m_contentLength);
+                    }
+
+                    m_rspPart = RESPONSE_PART_BODY;
                 }
-                m_rspPart = RESPONSE_PART_BODY;
             }
             break;
 
@@ -563,11 +604,7 @@ void AsyncHttpClient::onData(AsyncClient* client, const uint8_t* data, size_t le
             {
                 if (true == parseChunkedResponse(data, len, index))
                 {
-                    notifyResponse();
-
-                    m_transferCoding = TRANSFER_CODING_IDENTITY;
-                    m_rspPart = RESPONSE_PART_STATUS_LINE;
-                    m_rsp.clear();
+                    finishResponse();
                 }
             }
             else
@@ -585,18 +622,13 @@ void AsyncHttpClient::onData(AsyncClient* client, const uint8_t* data, size_t le
                     copySize = available;
                 }
 
-                m_rsp.addPayload(&data[index], copySize);
+                addBody(&data[index], copySize);
                 m_contentIndex += copySize;
                 index += copySize;
 
                 if (m_contentLength <= m_contentIndex)
                 {
-                    notifyResponse();
-
-                    m_rspPart = RESPONSE_PART_STATUS_LINE;
-                    m_rsp.clear();
-                    m_contentLength = 0U;
-                    m_contentIndex = 0U;
+                    finishResponse();
                 }
             }
             break;
@@ -780,7 +812,8 @@ void AsyncHttpClient::clear()
 
     m_isReqOpen = false;
 
-    m_rspPart = RESPONSE_PART_STATUS_LINE;
+    m_bodyStream.end();
+    m_rspPart = RESPONSE_PART_HEADER;
     m_rsp.clear();
     m_rspLine.clear();
     m_transferCoding = TRANSFER_CODING_IDENTITY;
@@ -881,6 +914,30 @@ bool AsyncHttpClient::handleRspHeader()
     return isSuccess;
 }
 
+bool AsyncHttpClient::isBodyExpected()
+{
+    bool        isExpected  = true;
+    uint16_t    statusCode  = m_rsp.getStatusCode();
+
+    /* RFC7230 - 3.3.3. Message Body Length
+     * Any 204 (No Content) or 304 (Not Modified) response is always
+     * terminated by the first empty line after the header fields.
+     */
+    if ((204U == statusCode) ||
+        (304U == statusCode))
+    {
+        isExpected = false;
+    }
+    else if ((TRANSFER_CODING_IDENTITY == m_transferCoding) &&
+             (0U == m_contentLength) &&
+             (false == m_rsp.getHeader("Content-Length").isEmpty()))
+    {
+        isExpected = false;
+    }
+
+    return isExpected;
+}
+
 bool AsyncHttpClient::parseChunkedResponseSize(const char* data, size_t len, size_t& index)
 {
     bool isSizeEOF = false;
@@ -923,7 +980,7 @@ bool AsyncHttpClient::parseChunkedResponseChunkData(const uint8_t* data, size_t
         copySize = available;
     }
 
-    m_rsp.addPayload(&data[index], copySize);
+    addBody(&data[index], copySize);
     index += copySize;
     m_chunkIndex += copySize;
 
@@ -1028,9 +1085,6 @@ bool AsyncHttpClient::parseChunkedResponse(const uint8_t* data, size_t len, size
                 else
                 {
                     m_chunkBodyPart = CHUNK_DATA;
-
-                    /* Extend response payload */
-                    m_rsp.extendPayload(m_chunkSize);
                 }
             }
             break;
@@ -1069,62 +1123,45 @@ bool AsyncHttpClient::parseChunkedResponse(const uint8_t* data, size_t len, size
     return isChunkEOF;
 }
 
-bool AsyncHttpClient::parseRspStatusLine(const char* data, size_t len, size_t& index)
+void AsyncHttpClient::addBody(const uint8_t* data, size_t size)
 {
-    bool isStatusLineEOF = false;
-
-    while((len > index) && (false == isStatusLineEOF))
+    if (true == m_bodyStream.isStarted())
     {
-        size_t terminatorLen = 0U;
-
-        m_rspLine += data[index];
-        ++index;
-
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-            m_rsp.addStatusLine(m_rspLine);
-
-            isStatusLineEOF = true;
-            m_rspLine.clear();
-        }
+        (void)m_bodyStream.write(data, size);
+    }
+    else
+    {
+        m_rsp.addPayload(data, size);
     }
-
-    return isStatusLineEOF;
 }
 
-bool AsyncHttpClient::parseRspHeader(const char* data, size_t len, size_t& index)
+void AsyncHttpClient::finishResponse()
 {
-    bool isHeaderEOF = false;
+    /* Body data was dropped, because the body reader was too slow? */
+    bool isBodyLost = (true == m_bodyStream.isStarted()) && (true == m_bodyStream.isFailed());
 
-    while((len > index) && (false == isHeaderEOF))
-    {
-        size_t terminatorLen = 0U;
-
-        m_rspLine += data[index];
-        ++index;
+    m_bodyStream.end();
 
-        if (true == isEOL(m_rspLine, terminatorLen))
-        {
-            if (terminatorLen < m_rspLine.length())
-            {
-                m_rspLine.remove(m_rspLine.length() - terminatorLen);
-
-                LOG_DEBUG("Rsp. header: %s", m_rspLine.c_str());
+    if (true == isBodyLost)
+    {
+        LOG_WARNING("Response body lost.");
+        notifyError();
+    }
+    else
+    {
+        notifyResponse();
+    }
 
-                m_rsp.addHeader(m_rspLine);
-            }
-            else
-            {
-                isHeaderEOF = true;
-            }
+    m_rspPart           = RESPONSE_PART_HEADER;
+    m_rsp.clear();
+    m_transferCoding    = TRANSFER_CODING_IDENTITY;
+    m_contentLength     = 0U;
+    m_contentIndex      = 0U;
 
-            m_rspLine.clear();
-        }
+    if (true == isBodyLost)
+    {
+        disconnect();
     }
-
-    return isHeaderEOF;
 }
 
 void AsyncHttpClient::notifyResponse()
@@ -47,6 +47,7 @@
 #include <AsyncTCP.h>
 
 #include "HttpResponse.h"
+#include "HttpBodyStream.h"
 
 /******************************************************************************
  * Macros
@@ -82,6 +83,11 @@ public:
      */
     typedef std::function<void()> OnError;
 
+    /**
+     * Prototype of HTTP body callback, which reads the response body while it is received.
+     */
+    typedef HttpBodyReader OnBody;
+
     /**
      * Constructs a http client.
      */
@@ -202,6 +208,27 @@ public:
      * @param[in] onError   Callback
      */
     void regOnError(const OnError& onError);
+
+    /**
+     * Register callback function, which reads the response body via stream
+     * while it is received. The body is not stored in the response then and
+     * the response callback gets a response without payload, after the body
+     * callback returned. Use it for big response bodies, which can be parsed
+     * on the fly, e.g. with ArduinoJson and a filter.
+     *
+     * Note, the callback runs in its own task context. It must not wait for
+     * the HTTP client.
+     *
+     * @param[in] onBody    Callback
+     */
+    void regOnBody(const OnBody& onBody);
+
+    /**
+     * Wait until a still running body callback returned. Call it before
+     * anything the body callback accesses is destroyed. It must not be called
+     * in the TCP task context.
+     */
+    void stopBodyReader();
     
     /**
      * Send GET request to host.
@@ -236,9 +263,8 @@ private:
      */
     enum ResponsePart
     {
-        RESPONSE_PART_STATUS_LINE = 0,  /**< Response status line */
-        RESPONSE_PART_HEADER,           /**< Response headers */
-        RESPONSE_PART_BODY              /**< Response body */
+        RESPONSE_PART_HEADER = 0,   /**< Response status line and headers */
+        RESPONSE_PART_BODY          /**< Response body */
     };
 
     /**
@@ -267,10 +293,18 @@ private:
     /** HTTPS port */
     static const uint16_t   HTTPS_PORT  = 443U;
 
+    /**
+     * Max. payload size in bytes, which is reserved in advance by the
+     * Content-Length header. It covers the largest response, a plugin stores
+     * completely (Github repository info). Bigger payloads grow geometrically.
+     */
+    static const size_t     PAYLOAD_RESERVE_MAX = 8192U;
+
     AsyncClient     m_tcpClient;            /**< Asynchronous TCP client */
     OnResponse      m_onRspCallback;        /**< Callback which to call for a complete response. */
     OnClosed        m_onClosedCallback;     /**< Callback which to call for a closed connection. */
     OnError         m_onErrorCallback;      /**< Callback which to call for a connection error. */
+    OnBody          m_onBodyCallback;       /**< Callback which reads the response body via stream. */
     String          m_hostname;             /**< Server hostname */
     uint16_t        m_port;                 /**< Server port */
     bool            m_isSecure;             /**< Secure transport (true) or not (false) */
@@ -295,6 +329,7 @@ private:
     size_t          m_chunkSize;            /**< Chunk size in byte */
     size_t          m_chunkIndex;           /**< Chunk body index */
     ChunkBodyPart   m_chunkBodyPart;        /**< Current part of chunked response */
+    HttpBodyStream  m_bodyStream;           /**< Stream which provides the response body to the body callback. */
 
     AsyncHttpClient(const AsyncHttpClient& client);
     AsyncHttpClient& operator=(const AsyncHttpClient& client);
@@ -367,6 +402,13 @@ private:
      */
     bool handleRspHeader();
 
+    /**
+     * Is a response body expected, after the response header?
+     *
+     * @return If a body is expected, it will return true otherwise false.
+     */
+    bool isBodyExpected();
+
     /**
      * Parse response chunked transfer chunk size.
      *
@@ -423,26 +465,20 @@ private:
     bool parseChunkedResponse(const uint8_t* data, size_t len, size_t& index);
 
     /**
-     * Parse response status line.
+     * Add response body data. If a body callback is registered, the data is
+     * written to the body stream, otherwise it is added to the response payload.
      *
-     * @param[in]       data    Data stream
-     * @param[in]       len     Data size in byte
-     * @param[in,out]   index   Current data index
-     *
-     * @return If status line is parsed, it will return true otherwise false.
+     * @param[in] data  Body data
+     * @param[in] size  Body data size in byte
      */
-    bool parseRspStatusLine(const char* data, size_t len, size_t& index);
+    void addBody(const uint8_t* data, size_t size);
 
     /**
-     * Parse response header.
-     *
-     * @param[in]       data    Data stream
-     * @param[in]       len     Data size in byte
-     * @param[in,out]   index   Current data index
-     *
-     * @return If all headers are parsed, it will return true otherwise false.
+     * Finish the complete received response: notify the application and
+     * prepare for the next response. If body data was lost, the error is
+     * notified instead and the connection is closed.
      */
-    bool parseRspHeader(const char* data, size_t len, size_t& index);
+    void finishResponse();
 
     /**
      * This method will be called for every complete response and provides
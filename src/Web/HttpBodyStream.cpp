@@ -0,0 +1,490 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP body stream
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "HttpBodyStream.h"
+
+#include <string.h>
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+HttpBodyStream::HttpBodyStream() :
+    Stream(),
+    m_ringBuffer(nullptr),
+    m_taskHandle(nullptr),
+    m_xSemaphore(nullptr),
+    m_reader(nullptr),
+    m_isEnd(false),
+    m_isFailed(false),
+    m_peekByte(-1),
+    m_taskMutex(),
+    m_mutex(),
+    m_overflow(),
+    m_overflowIdx(0U)
+{
+    (void)m_taskMutex.create();
+    (void)m_mutex.create();
+}
+
+HttpBodyStream::~HttpBodyStream()
+{
+    stop();
+
+    m_mutex.destroy();
+    m_taskMutex.destroy();
+}
+
+bool HttpBodyStream::begin(const HttpBodyReader& reader)
+{
+    MutexGuard<Mutex>   guard(m_taskMutex);
+    bool                isSuccessful = false;
+
+    /* Release a reader task, which was still busy at the last end(). */
+    if ((true == join(0U)) &&
+        (nullptr != reader))
+    {
+        m_ringBuffer = xRingbufferCreate(BUFFER_SIZE, RINGBUF_TYPE_BYTEBUF);
+
+        /* Create binary semaphore to signal task exit. */
+        m_xSemaphore = xSemaphoreCreateBinary();
+
+        if ((nullptr != m_ringBuffer) &&
+            (nullptr != m_xSemaphore))
+        {
+            BaseType_t  osRet   = pdFAIL;
+
+            m_reader    = reader;
+            m_isEnd     = false;
+            m_isFailed  = false;
+            m_peekByte  = -1;
+
+            osRet = xTaskCreateUniversal(   readerTask,
+                                            "httpBodyTask",
+                                            TASK_STACK_SIZE,
+                                            this,
+                                            TASK_PRIORITY,
+                                            &m_taskHandle,
+                                            TASK_RUN_CORE);
+
+            /* Task successful created? */
+            if (pdPASS == osRet)
+            {
+                isSuccessful = true;
+            }
+            else
+            {
+                m_taskHandle = nullptr;
+            }
+        }
+
+        /* Any error happened? */
+        if (false == isSuccessful)
+        {
+            LOG_ERROR("Couldn't start body stream.");
+
+            if (nullptr != m_xSemaphore)
+            {
+                vSemaphoreDelete(m_xSemaphore);
+                m_xSemaphore = nullptr;
+            }
+
+            if (nullptr != m_ringBuffer)
+            {
+                vRingbufferDelete(m_ringBuffer);
+                m_ringBuffer = nullptr;
+            }
+
+            m_reader = nullptr;
+        }
+    }
+
+    return isSuccessful;
+}
+
+void HttpBodyStream::end()
+{
+    MutexGuard<Mutex> guard(m_taskMutex);
+
+    if (true == isStarted())
+    {
+        m_isEnd = true;
+
+        /* The TCP task must not wait for a busy reader. */
+        if (false == join(pdMS_TO_TICKS(END_TIMEOUT)))
+        {
+            LOG_WARNING("Body stream reader is still busy.");
+        }
+    }
+}
+
+void HttpBodyStream::stop()
+{
+    MutexGuard<Mutex> guard(m_taskMutex);
+
+    if (nullptr != m_taskHandle)
+    {
+        /* The reader gets the end of the body, after it read the buffered data. */
+        m_isEnd = true;
+
+        (void)join(portMAX_DELAY);
+    }
+}
+
+int HttpBodyStream::available()
+{
+    int available = 0;
+
+    if (nullptr != m_ringBuffer)
+    {
+        MutexGuard<Mutex> guard(m_mutex);
+
+        available = static_cast<int>(BUFFER_SIZE - xRingbufferGetCurFreeSize(m_ringBuffer) + getOverflowSize());
+    }
+
+    if (0 <= m_peekByte)
+    {
+        ++available;
+    }
+
+    return available;
+}
+
+int HttpBodyStream::read()
+{
+    int     data    = -1;
+    char    value   = 0;
+
+    if (1U == readBytes(&value, 1U))
+    {
+        data = static_cast<uint8_t>(value);
+    }
+
+    return data;
+}
+
+int HttpBodyStream::peek()
+{
+    if (0 > m_peekByte)
+    {
+        m_peekByte = read();
+    }
+
+    return m_peekByte;
+}
+
+size_t HttpBodyStream::readBytes(char* buffer, size_t length)
+{
+    size_t      count       = 0U;
+    bool        isEOF       = false;
+    uint32_t    timestamp   = millis();
+
+    if ((nullptr == buffer) ||
+        (nullptr == m_ringBuffer))
+    {
+        isEOF = true;
+    }
+    else if ((0U < length) &&
+             (0 <= m_peekByte))
+    {
+        buffer[0]   = static_cast<char>(m_peekByte);
+        m_peekByte  = -1;
+        count       = 1U;
+    }
+
+    while((length > count) && (false == isEOF))
+    {
+        size_t received = 0U;
+
+        if (true == m_isFailed)
+        {
+            isEOF = true;
+        }
+        else
+        {
+            received = receive(&buffer[count], length - count, pdMS_TO_TICKS(POLL_PERIOD));
+        }
+
+        if (0U < received)
+        {
+            count       += received;
+            timestamp   = millis();
+        }
+        /* The writer signals the end after all data is written. */
+        else if ((true == m_isEnd) &&
+                 (true == isEmpty()))
+        {
+            isEOF = true;
+        }
+        else if (_timeout <= (millis() - timestamp))
+        {
+            LOG_WARNING("Body stream timeout.");
+            isEOF = true;
+        }
+    }
+
+    return count;
+}
+
+size_t HttpBodyStream::write(uint8_t data)
+{
+    return write(&data, 1U);
+}
+
+size_t HttpBodyStream::write(const uint8_t* buffer, size_t size)
+{
+    MutexGuard<Mutex>   taskGuard(m_taskMutex);
+    size_t              count       = 0U;
+
+    if ((nullptr != buffer) &&
+        (nullptr != m_ringBuffer) &&
+        (false == m_isFailed))
+    {
+        MutexGuard<Mutex>   guard(m_mutex);
+        bool                isRingBufferFull    = false;
+
+        /* As long as the overflow buffer contains data, the new data must be
+         * appended there to keep the order.
+         */
+        while((size > count) && (0U == getOverflowSize()) && (false == isRingBufferFull))
+        {
+            size_t partSize = size - count;
+
+            /* A item must fit into the ring buffer. */
+            if ((BUFFER_SIZE / 2U) < partSize)
+            {
+                partSize = BUFFER_SIZE / 2U;
+            }
+
+            /* Never block the writer, which runs in the TCP task context. */
+            if (pdTRUE == xRingbufferSend(m_ringBuffer, &buffer[count], partSize, 0U))
+            {
+                count += partSize;
+            }
+            else
+            {
+                isRingBufferFull = true;
+            }
+        }
+
+        if (size > count)
+        {
+            if (OVERFLOW_MAX_SIZE < (getOverflowSize() + size - count))
+            {
+                LOG_WARNING("Body stream reader is too slow, data dropped.");
+                m_isFailed = true;
+            }
+            else if (false == m_overflow.append(&buffer[count], size - count))
+            {
+                LOG_WARNING("Body stream overflow buffer is out of memory, data dropped.");
+                m_isFailed = true;
+            }
+            else
+            {
+                count = size;
+            }
+        }
+    }
+
+    return count;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+void HttpBodyStream::readerTask(void* parameters)
+{
+    HttpBodyStream* tthis = reinterpret_cast<HttpBodyStream*>(parameters);
+
+    if ((nullptr != tthis) &&
+        (nullptr != tthis->m_xSemaphore))
+    {
+        tthis->m_reader(*tthis);
+
+        /* Discard the rest of the body, otherwise the buffers will run full. */
+        while(false == tthis->m_isEnd)
+        {
+            size_t  itemSize    = 0U;
+            void*   item        = xRingbufferReceiveUpTo(tthis->m_ringBuffer, &itemSize, pdMS_TO_TICKS(POLL_PERIOD), BUFFER_SIZE);
+
+            if (nullptr != item)
+            {
+                vRingbufferReturnItem(tthis->m_ringBuffer, item);
+            }
+            else
+            {
+                MutexGuard<Mutex> guard(tthis->m_mutex);
+
+                tthis->m_overflow.clear();
+                tthis->m_overflowIdx = 0U;
+            }
+        }
+
+        (void)xSemaphoreGive(tthis->m_xSemaphore);
+    }
+
+    vTaskDelete(nullptr);
+
+    return;
+}
+
+bool HttpBodyStream::join(TickType_t timeout)
+{
+    bool isJoined = true;
+
+    if (nullptr != m_taskHandle)
+    {
+        if (pdTRUE != xSemaphoreTake(m_xSemaphore, timeout))
+        {
+            isJoined = false;
+        }
+        else
+        {
+            vSemaphoreDelete(m_xSemaphore);
+            m_xSemaphore = nullptr;
+
+            vRingbufferDelete(m_ringBuffer);
+            m_ringBuffer = nullptr;
+
+            m_reader = nullptr;
+            m_taskHandle = nullptr;
+
+            m_overflow.clear();
+            m_overflowIdx = 0U;
+        }
+    }
+
+    return isJoined;
+}
+
+size_t HttpBodyStream::receive(char* buffer, size_t size, TickType_t timeout)
+{
+    size_t  count       = 0U;
+    size_t  itemSize    = 0U;
+    void*   item        = xRingbufferReceiveUpTo(m_ringBuffer, &itemSize, 0U, size);
+
+    if (nullptr == item)
+    {
+        count = readOverflow(buffer, size);
+
+        /* Nothing in the overflow buffer, wait for new data in the ring buffer. */
+        if (0U == count)
+        {
+            item = xRingbufferReceiveUpTo(m_ringBuffer, &itemSize, timeout, size);
+        }
+    }
+
+    if (nullptr != item)
+    {
+        memcpy(buffer, item, itemSize);
+        vRingbufferReturnItem(m_ringBuffer, item);
+
+        count = itemSize;
+    }
+
+    return count;
+}
+
+size_t HttpBodyStream::readOverflow(char* buffer, size_t size)
+{
+    size_t              count   = 0U;
+    MutexGuard<Mutex>   guard(m_mutex);
+
+    /* The writer may have filled the ring buffer meanwhile, but then the
+     * overflow buffer contains newer data.
+     */
+    if (BUFFER_SIZE == xRingbufferGetCurFreeSize(m_ringBuffer))
+    {
+        count = getOverflowSize();
+
+        if (size < count)
+        {
+            count = size;
+        }
+
+        if (0U < count)
+        {
+            memcpy(buffer, &m_overflow.getData()[m_overflowIdx], count);
+            m_overflowIdx += count;
+
+            /* Release the memory as soon as all data is read. */
+            if (0U == getOverflowSize())
+            {
+                m_overflow.clear();
+                m_overflowIdx = 0U;
+            }
+        }
+    }
+
+    return count;
+}
+
+bool HttpBodyStream::isEmpty() const
+{
+    MutexGuard<Mutex> guard(m_mutex);
+
+    return (BUFFER_SIZE == xRingbufferGetCurFreeSize(m_ringBuffer)) && (0U == getOverflowSize());
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,303 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP body stream
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef __HTTP_BODY_STREAM_H__
+#define __HTTP_BODY_STREAM_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <Arduino.h>
+#include <Stream.h>
+#include <functional>
+#include <freertos/ringbuf.h>
+#include <Mutex.hpp>
+#include <PayloadBuffer.h>
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * Prototype of a body reader, which reads the HTTP response body from the stream.
+ * It runs in the body stream task context.
+ */
+typedef std::function<void(Stream& stream)> HttpBodyReader;
+
+/**
+ * The HTTP body stream provides the HTTP response body to a reader, while it
+ * is received. The received data is written to a small ring buffer and a
+ * reader task reads it from there, e.g. with ArduinoJson deserializeJson().
+ * Therefore the complete body is never kept in memory.
+ *
+ * The writer runs in the TCP task context and is never blocked. The used TCP
+ * stack acknowledges received data by itself, therefore the sender can't be
+ * throttled. If the ring buffer is full, because the reader is too slow, the
+ * data is kept in an overflow buffer on the heap, until the reader caught up.
+ * Only if the overflow buffer exceeds its limit, the stream fails and the
+ * reader gets the end of the body. If the reader returns before the whole
+ * body is read, the rest is discarded.
+ */
+class HttpBodyStream : public Stream
+{
+public:
+
+    /**
+     * Constructs a HTTP body stream.
+     */
+    HttpBodyStream();
+
+    /**
+     * Destroys the HTTP body stream.
+     */
+    ~HttpBodyStream();
+
+    /**
+     * Start the reader task, which calls the reader.
+     * If the stream is already started, it will fail.
+     *
+     * @param[in] reader    Body reader
+     *
+     * @return If successful started, it will return true otherwise false.
+     */
+    bool begin(const HttpBodyReader& reader);
+
+    /**
+     * Signal the end of the body and wait a limited time until the reader
+     * task is finished. If the reader is still busy, the reader task is
+     * released later by the next begin() or stop().
+     */
+    void end();
+
+    /**
+     * Signal the end of the body and wait until the reader task is finished.
+     * Use it before anything the reader accesses is destroyed. It must not be
+     * called in the TCP task context.
+     */
+    void stop();
+
+    /**
+     * Is the stream started and the end of the body not signalled yet?
+     *
+     * @return If started, it will return true otherwise false.
+     */
+    bool isStarted() const
+    {
+        return (nullptr != m_taskHandle) && (false == m_isEnd);
+    }
+
+    /**
+     * Is body data lost, because the reader was too slow?
+     *
+     * @return If body data is lost, it will return true otherwise false.
+     */
+    bool isFailed() const
+    {
+        return m_isFailed;
+    }
+
+    /**
+     * Get number of bytes, which can be read without waiting.
+     *
+     * @return Number of bytes
+     */
+    int available() final;
+
+    /**
+     * Read a single byte. Waits until data is available, the end of the body
+     * is reached or the stream timeout happened.
+     *
+     * @return Byte or -1 in case of the end of the body or a timeout.
+     */
+    int read() final;
+
+    /**
+     * Get the next byte, without removing it from the stream. Waits like read().
+     *
+     * @return Byte or -1 in case of the end of the body or a timeout.
+     */
+    int peek() final;
+
+    /**
+     * Read several bytes. Waits until all bytes are read, the end of the body
+     * is reached or the stream timeout happened.
+     *
+     * @param[out] buffer   Buffer
+     * @param[in] length    Buffer size in byte
+     *
+     * @return Number of read bytes
+     */
+    size_t readBytes(char* buffer, size_t length) final;
+
+    /**
+     * Nothing to flush, the written data is read by the reader task.
+     */
+    void flush() final
+    {
+    }
+
+    /**
+     * Write a single byte of the body.
+     *
+     * @param[in] data  Byte
+     *
+     * @return Number of written bytes
+     */
+    size_t write(uint8_t data) final;
+
+    /**
+     * Write body data without waiting. If the data doesn't fit into the
+     * ring buffer, it is kept in the overflow buffer. If the overflow buffer
+     * limit is exceeded, the data is dropped, the stream fails and the reader
+     * will get the end of the body.
+     *
+     * @param[in] buffer    Body data
+     * @param[in] size      Body data size in byte
+     *
+     * @return Number of written bytes
+     */
+    size_t write(const uint8_t* buffer, size_t size) final;
+
+    /** Ring buffer size in byte. It shall take the data of a TCP receive window. */
+    static const size_t         BUFFER_SIZE         = 4096U;
+
+    /** Max. size in byte of the body data, which is kept in the overflow buffer. */
+    static const size_t         OVERFLOW_MAX_SIZE   = 32768U;
+
+    /** Max. time in ms to wait for the reader task in end(). */
+    static const uint32_t       END_TIMEOUT         = 100U;
+
+private:
+
+    /** Reader task stack size in bytes */
+    static const uint32_t       TASK_STACK_SIZE     = 6144U;
+
+    /** Reader task priority. */
+    static const UBaseType_t    TASK_PRIORITY       = 1U;
+
+    /** MCU core where the reader task shall run. */
+    static const BaseType_t     TASK_RUN_CORE       = 1;
+
+    /** Period in ms, to check for the end of the body while waiting for data. */
+    static const uint32_t       POLL_PERIOD         = 10U;
+
+    RingbufHandle_t     m_ringBuffer;   /**< Ring buffer, which contains the not read body data. */
+    TaskHandle_t        m_taskHandle;   /**< Reader task handle */
+    SemaphoreHandle_t   m_xSemaphore;   /**< Binary semaphore used to signal the task exit. */
+    HttpBodyReader      m_reader;       /**< Body reader */
+    volatile bool       m_isEnd;        /**< Is the end of the body reached? */
+    volatile bool       m_isFailed;     /**< Body data was lost, because the reader was too slow. */
+    int                 m_peekByte;     /**< Byte which was peeked or -1. */
+    Mutex               m_taskMutex;    /**< Protects the reader task and the ring buffer lifetime. */
+    mutable Mutex       m_mutex;        /**< Protects the overflow buffer. */
+    PayloadBuffer       m_overflow;     /**< Body data, which didn't fit into the ring buffer. */
+    size_t              m_overflowIdx;  /**< Index of the next not read byte in the overflow buffer. */
+
+    HttpBodyStream(const HttpBodyStream& stream);
+    HttpBodyStream& operator=(const HttpBodyStream& stream);
+
+    /**
+     * Reader task, which calls the reader and discards the body data the
+     * reader left.
+     *
+     * @param[in] parameters    Task parameters
+     */
+    static void readerTask(void* parameters);
+
+    /**
+     * Wait until the reader task is finished and release its resources.
+     *
+     * @param[in] timeout   Max. time to wait in ticks
+     *
+     * @return If no reader task is running anymore, it will return true otherwise false.
+     */
+    bool join(TickType_t timeout);
+
+    /**
+     * Receive body data, either from the ring buffer or if it is empty from
+     * the overflow buffer.
+     *
+     * @param[out] buffer   Buffer
+     * @param[in] size      Buffer size in byte
+     * @param[in] timeout   Max. time to wait for data in ticks
+     *
+     * @return Number of received bytes
+     */
+    size_t receive(char* buffer, size_t size, TickType_t timeout);
+
+    /**
+     * Read from the overflow buffer. This is only possible if the ring buffer
+     * is empty, because the overflow buffer contains the newer data.
+     *
+     * @param[out] buffer   Buffer
+     * @param[in] size      Buffer size in byte
+     *
+     * @return Number of read bytes
+     */
+    size_t readOverflow(char* buffer, size_t size);
+
+    /**
+     * Get the number of body data bytes in the overflow buffer, which are not
+     * read yet. The mutex must be taken by the caller.
+     *
+     * @return Number of bytes
+     */
+    size_t getOverflowSize() const
+    {
+        return m_overflow.getSize() - m_overflowIdx;
+    }
+
+    /**
+     * Are the ring buffer and the overflow buffer empty?
+     *
+     * @return If empty, it will return true otherwise false.
+     */
+    bool isEmpty() const;
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HTTP_BODY_STREAM_H__ */
+
+/** @} */
\ No newline at end of file
@@ -0,0 +1,240 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP request, which is executed by the HTTP scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "HttpRequest.h"
+#include "HttpScheduler.h"
+
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+HttpRequest::HttpRequest() :
+    m_url(),
+    m_hostKey(),
+    m_method(METHOD_GET),
+    m_parNames(),
+    m_parValues(),
+    m_parCnt(0U),
+    m_onRspCallback(nullptr),
+    m_onClosedCallback(nullptr),
+    m_onErrorCallback(nullptr),
+    m_onBodyCallback(nullptr),
+    m_onUnchangedCallback(nullptr),
+    m_etag(),
+    m_lastModified(),
+    m_state(STATE_IDLE),
+    m_connectionId(0U),
+    m_timestamp(0U),
+    m_delay(0U)
+{
+}
+
+HttpRequest::~HttpRequest()
+{
+    abort();
+}
+
+bool HttpRequest::begin(const String& url)
+{
+    bool    status          = false;
+    int     protocolEnd     = url.indexOf("://");
+
+    /* If a request is pending, the URL can not be changed. */
+    if (true == isPending())
+    {
+        LOG_WARNING("Request is pending.");
+    }
+    /* The URL must contain the protocol. */
+    else if (0 > protocolEnd)
+    {
+        LOG_ERROR("Failed to parse protocol.");
+    }
+    else
+    {
+        int     hostBegin   = protocolEnd + 3; /* Overstep '://' too. */
+        int     hostEnd     = url.indexOf('/', hostBegin);
+        String  host        = (0 > hostEnd) ? url.substring(hostBegin) : url.substring(hostBegin, hostEnd);
+        int     authEnd     = host.indexOf('@');
+
+        /* The authorization doesn't identify the connection. */
+        if (0 <= authEnd)
+        {
+            host.remove(0, authEnd + 1);
+        }
+
+        /* The validators belong to the resource. */
+        if (m_url != url)
+        {
+            clearValidators();
+        }
+
+        m_url       = url;
+        m_hostKey   = url.substring(0, hostBegin) + host;
+        m_parCnt    = 0U;
+
+        status = true;
+    }
+
+    return status;
+}
+
+void HttpRequest::addPar(const String& name, const String& value)
+{
+    if ((false == isPending()) &&
+        (MAX_PARS > m_parCnt))
+    {
+        m_parNames[m_parCnt]    = name;
+        m_parValues[m_parCnt]   = value;
+        ++m_parCnt;
+    }
+}
+
+void HttpRequest::regOnResponse(const OnResponse& onResponse)
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_onRspCallback = onResponse;
+}
+
+void HttpRequest::regOnClosed(const OnClosed& onClosed)
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_onClosedCallback = onClosed;
+}
+
+void HttpRequest::regOnError(const OnError& onError)
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_onErrorCallback = onError;
+}
+
+void HttpRequest::regOnBody(const OnBody& onBody)
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_onBodyCallback = onBody;
+}
+
+void HttpRequest::regOnUnchanged(const OnUnchanged& onUnchanged)
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_onUnchangedCallback = onUnchanged;
+}
+
+void HttpRequest::clearValidators()
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    m_etag.clear();
+    m_lastModified.clear();
+}
+
+bool HttpRequest::GET()
+{
+    return schedule(METHOD_GET);
+}
+
+bool HttpRequest::POST()
+{
+    return schedule(METHOD_POST);
+}
+
+void HttpRequest::abort()
+{
+    HttpScheduler::getInstance().abort(*this);
+}
+
+bool HttpRequest::isPending() const
+{
+    MutexGuard<MutexRecursive> guard(HttpScheduler::getInstance().m_mutex);
+
+    return (STATE_IDLE != m_state);
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+bool HttpRequest::schedule(Method method)
+{
+    bool status = false;
+
+    if (true == m_url.isEmpty())
+    {
+        LOG_ERROR("No URL.");
+    }
+    else
+    {
+        m_method = method;
+
+        status = HttpScheduler::getInstance().schedule(*this);
+    }
+
+    return status;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
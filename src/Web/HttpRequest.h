@@ -0,0 +1,265 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP request, which is executed by the HTTP scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef __HTTP_REQUEST_H__
+#define __HTTP_REQUEST_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <WString.h>
+
+#include "AsyncHttpClient.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/* Forward declarations */
+class HttpScheduler;
+
+/**
+ * HTTP request, which is executed by the central HTTP scheduler, instead of
+ * using a own HTTP client with a own connection. It provides the same
+ * interface as the AsyncHttpClient for the request handling.
+ *
+ * Only one request can be pending at a time. After the response is received
+ * or the request failed, the closed callback is called. All callbacks are
+ * called in a different task context!
+ *
+ * If a unchanged callback is registered, GET requests are conditional. The
+ * validators (ETag, Last-Modified) of the last successful response are sent
+ * with the next request to the same URL. If the server responds with 304
+ * (Not Modified), the unchanged callback is called instead of the response
+ * callback.
+ */
+class HttpRequest
+{
+public:
+
+    /**
+     * Prototype of HTTP response callback for a complete received response.
+     */
+    typedef AsyncHttpClient::OnResponse OnResponse;
+
+    /**
+     * Prototype of callback for a finished request.
+     */
+    typedef AsyncHttpClient::OnClosed OnClosed;
+
+    /**
+     * Prototype of callback in case a error happened.
+     */
+    typedef AsyncHttpClient::OnError OnError;
+
+    /**
+     * Prototype of callback, which reads the response body while it is received.
+     */
+    typedef AsyncHttpClient::OnBody OnBody;
+
+    /**
+     * Prototype of callback for a unchanged resource (304 Not Modified).
+     */
+    typedef std::function<void()> OnUnchanged;
+
+    /**
+     * Constructs a HTTP request.
+     */
+    HttpRequest();
+
+    /**
+     * Destroys the HTTP request. A pending request is aborted.
+     */
+    ~HttpRequest();
+
+    /**
+     * Prepare the request for the given URL.
+     * Note, calling this will clear the URL encoded parameters.
+     *
+     * @param[in] url   URL
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool begin(const String& url);
+
+    /**
+     * Add parameter to request (application/x-www-form-urlencoded).
+     *
+     * @param[in] name  Parameter name
+     * @param[in] value Parameter value
+     */
+    void addPar(const String& name, const String& value);
+
+    /**
+     * Register callback function on response reception.
+     *
+     * @param[in] onResponse    Callback
+     */
+    void regOnResponse(const OnResponse& onResponse);
+
+    /**
+     * Register callback function on finished request.
+     *
+     * @param[in] onClosed  Callback
+     */
+    void regOnClosed(const OnClosed& onClosed);
+
+    /**
+     * Register callback function on error.
+     *
+     * @param[in] onError   Callback
+     */
+    void regOnError(const OnError& onError);
+
+    /**
+     * Register callback function, which reads the response body via stream
+     * while it is received, see AsyncHttpClient::regOnBody(). Such a request
+     * is never coalesced with other requests.
+     *
+     * @param[in] onBody    Callback
+     */
+    void regOnBody(const OnBody& onBody);
+
+    /**
+     * Register callback function on a unchanged resource. This makes the
+     * GET requests conditional.
+     *
+     * @param[in] onUnchanged   Callback
+     */
+    void regOnUnchanged(const OnUnchanged& onUnchanged);
+
+    /**
+     * Forget the validators of the last response, so the next request is
+     * not conditional. Use it, if the data of the last response got lost.
+     */
+    void clearValidators();
+
+    /**
+     * Schedule a GET request.
+     *
+     * @return If request is successful scheduled, it will return true otherwise false.
+     */
+    bool GET();
+
+    /**
+     * Schedule a POST request with the URL encoded parameters as payload.
+     *
+     * @return If request is successful scheduled, it will return true otherwise false.
+     */
+    bool POST();
+
+    /**
+     * Abort a pending request and avoid any follow up callback.
+     */
+    void abort();
+
+    /**
+     * Is the request pending?
+     *
+     * @return If the request is pending, it will return true otherwise false.
+     */
+    bool isPending() const;
+
+private:
+
+    friend class HttpScheduler;
+
+    /**
+     * Request methods
+     */
+    enum Method
+    {
+        METHOD_GET = 0, /**< GET */
+        METHOD_POST     /**< POST */
+    };
+
+    /**
+     * Request states
+     */
+    enum State
+    {
+        STATE_IDLE = 0, /**< Not scheduled */
+        STATE_QUEUED,   /**< Waiting for a connection */
+        STATE_ACTIVE    /**< Sent, waiting for the response */
+    };
+
+    /** Max. number of URL encoded parameters. */
+    static const uint8_t    MAX_PARS    = 4U;
+
+    String          m_url;              /**< URL */
+    String          m_hostKey;          /**< Protocol, host and port, which identifies the connection. */
+    Method          m_method;           /**< Request method */
+    String          m_parNames[MAX_PARS];   /**< URL encoded parameter names */
+    String          m_parValues[MAX_PARS];  /**< URL encoded parameter values */
+    uint8_t         m_parCnt;           /**< Number of URL encoded parameters */
+    OnResponse      m_onRspCallback;    /**< Callback which to call for a complete response. */
+    OnClosed        m_onClosedCallback; /**< Callback which to call for a finished request. */
+    OnError         m_onErrorCallback;  /**< Callback which to call for a error. */
+    OnBody          m_onBodyCallback;   /**< Callback which reads the response body via stream. */
+    OnUnchanged     m_onUnchangedCallback;  /**< Callback which to call for a unchanged resource. */
+    String          m_etag;             /**< ETag of the last response */
+    String          m_lastModified;     /**< Last-Modified of the last response */
+    State           m_state;            /**< Request state */
+    uint8_t         m_connectionId;     /**< Id of the connection, which executes the request. */
+    uint32_t        m_timestamp;        /**< Timestamp in ms, when the request was scheduled. */
+    uint32_t        m_delay;            /**< Delay in ms, before the request is started. */
+
+    HttpRequest(const HttpRequest& request);
+    HttpRequest& operator=(const HttpRequest& request);
+
+    /**
+     * Schedule the request.
+     *
+     * @param[in] method    Request method
+     *
+     * @return If request is successful scheduled, it will return true otherwise false.
+     */
+    bool schedule(Method method);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HTTP_REQUEST_H__ */
+
+/** @} */
\ No newline at end of file
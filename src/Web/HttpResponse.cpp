@@ -63,48 +63,8 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
 {
     if (this != &rsp)
     {
-        DLinkedListConstIterator<HttpHeader*>   it(rsp.m_headers);
-
-        m_httpVersion   = rsp.m_httpVersion;
-        m_statusCode    = rsp.m_statusCode;
-        m_reasonPhrase  = rsp.m_reasonPhrase;
-
-        if (nullptr != m_payload)
-        {
-            delete[] m_payload;
-        }
-
-        if (nullptr != rsp.m_payload)
-        {
-            m_payload = new(std::nothrow) uint8_t[rsp.m_size];
-
-            if (nullptr == m_payload)
-            {
-                m_size = 0U;
-                m_wrIndex = 0U;
-            }
-            else
-            {
-                memcpy(m_payload, rsp.m_payload, rsp.m_size);
-                m_size = rsp.m_size;
-                m_wrIndex = rsp.m_wrIndex;
-            }
-        }
-
-        if (true == it.first())
-        {
-            do
-            {
-                HttpHeader* header = new(std::nothrow) HttpHeader;
-
-                if (nullptr != header)
-                {
-                    *header = **it.current();
-                    (void)m_headers.append(header);
-                }
-            }
-            while(true == it.next());
-        }
+        m_header    = rsp.m_header;
+        m_payload   = rsp.m_payload;
     }
 
     return *this;
@@ -112,134 +72,49 @@ HttpResponse& HttpResponse::operator=(const HttpResponse& rsp)
 
 void HttpResponse::clear()
 {
-    clearHeaders();
+    m_header.reset();
     clearPayload();
-    m_wrIndex = 0U;
 }
 
-void HttpResponse::addStatusLine(const String& line)
+HttpRspParser::Result HttpResponse::parseHeader(const char* data, size_t len, size_t& index)
 {
-    const char* SP          = " ";
-    int         idx         = 0;
-    int         begin       = 0;
-    String      statusCode;
-
-    /* Status-Line = HTTP-Version SP Status-Code SP Reason-Phrase CRLF */
-
-    /* HTTP-Version */
-    idx             = line.indexOf(SP);
-    m_httpVersion   = line.substring(begin, idx);
-
-    /* Overstep all spaces */
-    while(('\0' != line[idx]) && (' ' == line[idx]))
-    {
-        ++idx;
-    }
-    begin = idx;
-
-    /* Status-Code */
-    idx             = line.indexOf(SP, begin);
-    statusCode      = line.substring(begin, idx);
-    m_statusCode    = statusCode.toInt();
-
-    /* Overstep all spaces */
-    while(('\0' != line[idx]) && (' ' == line[idx]))
-    {
-        ++idx;
-    }
-    begin = idx;
-
-    /* Reason-Phrase */
-    m_reasonPhrase  = line.substring(begin);
+    return m_header.parse(data, len, index);
 }
 
-void HttpResponse::addHeader(const String& line)
+void HttpResponse::reservePayload(size_t size)
 {
-    HttpHeader* header = new(std::nothrow) HttpHeader(line);
-
-    if (nullptr != header)
-    {
-        m_headers.append(header);
-    }
-}
-
-void HttpResponse::extendPayload(size_t size)
-{
-    uint8_t* tmp = m_payload;
-
-    m_payload = new(std::nothrow) uint8_t[m_size + size];
-
-    if (nullptr != m_payload)
-    {
-        m_size += size;
-    }
-
-    if ((nullptr != m_payload) &&
-        (nullptr != tmp))
-    {
-        memcpy(m_payload, tmp, m_wrIndex);
-    }
-
-    if (nullptr != tmp)
-    {
-        delete[] tmp;
-    }
+    /* If it fails, the payload buffer will grow during adding. */
+    (void)m_payload.reserve(size);
 }
 
 void HttpResponse::addPayload(const uint8_t* payload, size_t size)
 {
-    if ((nullptr == m_payload) ||
-        ((m_size - m_wrIndex) < size))
-    {
-        extendPayload(size);
-    }
-
-    if ((nullptr != m_payload) &&
-        ((m_size - m_wrIndex) >= size))
-    {
-        memcpy(&m_payload[m_wrIndex], payload, size);
-        m_wrIndex += size;
-    }
+    (void)m_payload.append(payload, size);
 }
 
 String HttpResponse::getHttpVersion() const
 {
-    return m_httpVersion;
+    return String(m_header.getHttpVersion());
 }
 
 uint16_t HttpResponse::getStatusCode() const
 {
-    return m_statusCode;
+    return m_header.getStatusCode();
 }
 
 String HttpResponse::getReasonPhrase() const
 {
-    return m_reasonPhrase;
+    return String(m_header.getReasonPhrase());
 }
 
-String HttpResponse::getHeader(const String& name)
+String HttpResponse::getHeader(const String& name) const
 {
-    String                              value;
-    DLinkedListIterator<HttpHeader*>    it(m_headers);
+    String      value;
+    const char* headerValue = m_header.getHeader(name.c_str());
 
-    if (true == it.first())
+    if (nullptr != headerValue)
     {
-        HttpHeader* hdr     = nullptr;
-        bool        isFound = false;
-
-        do
-        {
-            hdr = *it.current();
-
-            if ((nullptr != hdr) &&
-                (0U != hdr->getName().equalsIgnoreCase(name)))
-            {
-                value = hdr->getValue();
-                isFound = true;
-            }
-        }
-        while((false == isFound) &&
-                (true == it.next()));
+        value = headerValue;
     }
 
     return value;
@@ -247,8 +122,8 @@ String HttpResponse::getHeader(const String& name)
 
 const uint8_t* HttpResponse::getPayload(size_t& size) const
 {
-    size = m_size;
-    return m_payload;
+    size = m_payload.getSize();
+    return m_payload.getData();
 }
 
 /******************************************************************************
@@ -259,28 +134,9 @@ const uint8_t* HttpResponse::getPayload(size_t& size) const
  * Private Methods
  *****************************************************************************/
 
-void HttpResponse::clearHeaders()
-{
-    DLinkedListIterator<HttpHeader*> it(m_headers);
-
-    while(true == it.first())
-    {
-        HttpHeader* header = *it.current();
-
-        it.remove();
-        delete header;
-    }
-}
-
 void HttpResponse::clearPayload()
 {
-    if (nullptr != m_payload)
-    {
-        delete[] m_payload;
-        m_payload = nullptr;
-    }
-
-    m_size = 0U;
+    m_payload.clear();
 }
 
 /******************************************************************************
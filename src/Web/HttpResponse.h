@@ -44,9 +44,8 @@
  * Includes
  *****************************************************************************/
 #include <WString.h>
-#include <LinkedList.hpp>
-
-#include "HttpHeader.h"
+#include <PayloadBuffer.h>
+#include <HttpRspParser.h>
 
 /******************************************************************************
  * Macros
@@ -67,13 +66,8 @@ public:
      * Construct a empty response.
      */
     HttpResponse() :
-        m_httpVersion(),
-        m_statusCode(0U),
-        m_reasonPhrase(),
-        m_headers(),
-        m_payload(nullptr),
-        m_size(0U),
-        m_wrIndex(0U)
+        m_header(),
+        m_payload()
     {
     }
 
@@ -91,13 +85,8 @@ public:
      * @param[in] rsp   Response
      */
     HttpResponse(const HttpResponse& rsp) :
-        m_httpVersion(),
-        m_statusCode(0U),
-        m_reasonPhrase(),
-        m_headers(),
-        m_payload(nullptr),
-        m_size(0U),
-        m_wrIndex(0U)
+        m_header(),
+        m_payload()
     {
         *this = rsp;
     }
@@ -117,25 +106,26 @@ public:
     void clear();
 
     /**
-     * Add status line during parsing the response.
+     * Parse the status line and the headers of the received response data.
+     * The data can be passed several times partly. Parsing stops after the
+     * empty line, which terminates the header.
      *
-     * @param[in] line  Status line
-     */
-    void addStatusLine(const String& line);
-
-    /**
-     * Add header during parsing the response.
+     * @param[in]       data    Received data
+     * @param[in]       len     Received data size in byte
+     * @param[in,out]   index   Current data index
      *
-     * @param[in] line  Single header line
+     * @return Parse result
      */
-    void addHeader(const String& line);
+    HttpRspParser::Result parseHeader(const char* data, size_t len, size_t& index);
 
     /**
-     * Extend payload size in bytes.
+     * Reserve the payload buffer for the expected payload size, e.g. given
+     * by the Content-Length header. Without it, the payload buffer grows
+     * geometrically.
      *
      * @param[in] size  Size in bytes
      */
-    void extendPayload(size_t size);
+    void reservePayload(size_t size);
 
     /**
      * Add a complete payload or add it several times partly.
@@ -171,7 +161,7 @@ public:
      *
      * @param[in] name  Field name
      */
-    String getHeader(const String& name);
+    String getHeader(const String& name) const;
 
     /**
      * Get payload.
@@ -184,18 +174,8 @@ public:
 
 private:
 
-    String                      m_httpVersion;  /**< HTTP version */
-    uint16_t                    m_statusCode;   /**< Status code */
-    String                      m_reasonPhrase; /**< Reason phrase */
-    DLinkedList<HttpHeader*>    m_headers;      /**< List of headers */
-    uint8_t*                    m_payload;      /**< Payload */
-    size_t                      m_size;         /**< Payload size in byte */
-    size_t                      m_wrIndex;      /**< Payload write index */
-
-    /**
-     * Clear headers.
-     */
-    void clearHeaders();
+    HttpRspParser   m_header;   /**< Status line and headers */
+    PayloadBuffer   m_payload;  /**< Payload */
 
     /**
      * Clears the payload.
@@ -0,0 +1,622 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "HttpScheduler.h"
+
+#include <Arduino.h>
+#include <Logging.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+void HttpScheduler::process()
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     connectionId    = 0U;
+    uint8_t                     index           = 0U;
+
+    for(connectionId = 0U; connectionId < MAX_CONNECTIONS; ++connectionId)
+    {
+        superviseConnection(connectionId);
+    }
+
+    for(index = 0U; index < MAX_REQUESTS; ++index)
+    {
+        HttpRequest* request = m_requests[index];
+
+        if ((nullptr != request) &&
+            (HttpRequest::STATE_QUEUED == request->m_state) &&
+            (request->m_delay <= (millis() - request->m_timestamp)) &&
+            (true == getConnection(*request, connectionId)))
+        {
+            sendRequest(connectionId, *request);
+        }
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+HttpScheduler::HttpScheduler() :
+    m_mutex(),
+    m_connections(),
+    m_requests(),
+    m_connectTimer()
+{
+    uint8_t connectionId    = 0U;
+    uint8_t index           = 0U;
+
+    (void)m_mutex.create();
+
+    for(index = 0U; index < MAX_REQUESTS; ++index)
+    {
+        m_requests[index] = nullptr;
+    }
+
+    /* Note: All registered callbacks are running in the TCP task context! */
+    for(connectionId = 0U; connectionId < MAX_CONNECTIONS; ++connectionId)
+    {
+        AsyncHttpClient& client = m_connections[connectionId].client;
+
+        client.setKeepAlive(true);
+
+        client.regOnResponse(
+            [this, connectionId](const HttpResponse& rsp)
+            {
+                onResponse(connectionId, rsp);
+            }
+        );
+
+        client.regOnClosed(
+            [this, connectionId]()
+            {
+                onClosed(connectionId);
+            }
+        );
+
+        client.regOnError(
+            [this, connectionId]()
+            {
+                onError(connectionId);
+            }
+        );
+    }
+}
+
+HttpScheduler::~HttpScheduler()
+{
+    uint8_t connectionId = 0U;
+
+    for(connectionId = 0U; connectionId < MAX_CONNECTIONS; ++connectionId)
+    {
+        m_connections[connectionId].client.regOnResponse(nullptr);
+        m_connections[connectionId].client.regOnClosed(nullptr);
+        m_connections[connectionId].client.regOnError(nullptr);
+        m_connections[connectionId].client.regOnBody(nullptr);
+        m_connections[connectionId].client.abort();
+    }
+
+    m_mutex.destroy();
+}
+
+bool HttpScheduler::schedule(HttpRequest& request)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    bool                        status  = false;
+    uint8_t                     index   = 0U;
+
+    if (HttpRequest::STATE_IDLE == request.m_state)
+    {
+        /* Find a free entry. */
+        while((MAX_REQUESTS > index) && (nullptr != m_requests[index]))
+        {
+            ++index;
+        }
+
+        if (MAX_REQUESTS <= index)
+        {
+            LOG_WARNING("Too many pending requests.");
+        }
+        else
+        {
+            HttpRequest* activeRequest = getActiveRequest(request);
+
+            /* The same GET request is already sent? Use its response. */
+            if (nullptr != activeRequest)
+            {
+                request.m_state         = HttpRequest::STATE_ACTIVE;
+                request.m_connectionId  = activeRequest->m_connectionId;
+
+                LOG_DEBUG("Request %s coalesced.", request.m_url.c_str());
+            }
+            else
+            {
+                request.m_state         = HttpRequest::STATE_QUEUED;
+                request.m_timestamp     = millis();
+                request.m_delay         = static_cast<uint32_t>(random(JITTER_MAX));
+            }
+
+            m_requests[index] = &request;
+
+            status = true;
+        }
+    }
+
+    return status;
+}
+
+void HttpScheduler::abort(HttpRequest& request)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     index       = 0U;
+    bool                        isShared    = false;
+
+    for(index = 0U; index < MAX_REQUESTS; ++index)
+    {
+        HttpRequest* other = m_requests[index];
+
+        if (&request == other)
+        {
+            m_requests[index] = nullptr;
+        }
+        else if ((nullptr != other) &&
+                 (HttpRequest::STATE_ACTIVE == other->m_state) &&
+                 (request.m_connectionId == other->m_connectionId))
+        {
+            isShared = true;
+        }
+        else
+        {
+            /* Nothing to do. */
+            ;
+        }
+    }
+
+    /* If the request is already sent and no coalesced request waits for the
+     * response, the body callback of the owner must not be called anymore.
+     * Therefore it is removed and the connection is aborted.
+     */
+    if ((HttpRequest::STATE_ACTIVE == request.m_state) &&
+        (MAX_CONNECTIONS > request.m_connectionId) &&
+        (false == isShared))
+    {
+        Connection& connection = m_connections[request.m_connectionId];
+
+        LOG_DEBUG("Request %s aborted.", request.m_url.c_str());
+
+        connection.client.regOnBody(nullptr);
+        connection.client.abort();
+        connection.state = CONNECTION_STATE_CLOSING;
+    }
+
+    /* The body callback accesses the owner of the request. It may still run,
+     * even if the response is already finished. Therefore wait until it returned,
+     * before the owner is destroyed.
+     */
+    for(index = 0U; index < MAX_CONNECTIONS; ++index)
+    {
+        Connection& connection = m_connections[index];
+
+        if (&request == connection.bodyOwner)
+        {
+            connection.client.stopBodyReader();
+            connection.bodyOwner = nullptr;
+        }
+    }
+
+    request.m_state = HttpRequest::STATE_IDLE;
+
+    return;
+}
+
+void HttpScheduler::superviseConnection(uint8_t connectionId)
+{
+    Connection& connection = m_connections[connectionId];
+
+    switch(connection.state)
+    {
+    case CONNECTION_STATE_CLOSED:
+        /* Nothing to do. */
+        break;
+
+    case CONNECTION_STATE_BUSY:
+        if (true == connection.timer.isTimeout())
+        {
+            LOG_WARNING("Response timeout.");
+
+            finishRequests(connectionId, nullptr, true);
+            connection.client.disconnect();
+            connection.state = CONNECTION_STATE_CLOSING;
+        }
+        break;
+
+    case CONNECTION_STATE_IDLE:
+        if (true == connection.timer.isTimeout())
+        {
+            connection.client.disconnect();
+            connection.state = CONNECTION_STATE_CLOSING;
+        }
+        break;
+
+    case CONNECTION_STATE_CLOSING:
+        /* The closed callback may be missing, if the connection was already closed. */
+        if (true == connection.client.isDisconnected())
+        {
+            connection.hostKey.clear();
+            connection.state = CONNECTION_STATE_CLOSED;
+        }
+        break;
+
+    default:
+        /* Should never happen. */
+        break;
+    }
+
+    return;
+}
+
+bool HttpScheduler::getConnection(const HttpRequest& request, uint8_t& connectionId)
+{
+    bool    isFound = false;
+    uint8_t idx     = 0U;
+
+    /* Reuse a connection to the same host. */
+    for(idx = 0U; (idx < MAX_CONNECTIONS) && (false == isFound); ++idx)
+    {
+        Connection& connection = m_connections[idx];
+
+        if ((CONNECTION_STATE_IDLE == connection.state) &&
+            (request.m_hostKey == connection.hostKey))
+        {
+            connectionId    = idx;
+            isFound         = true;
+        }
+    }
+
+    /* Establish a new connection, but keep a gap to the last one. */
+    if ((false == isFound) &&
+        ((false == m_connectTimer.isTimerRunning()) || (true == m_connectTimer.isTimeout())))
+    {
+        for(idx = 0U; (idx < MAX_CONNECTIONS) && (false == isFound); ++idx)
+        {
+            Connection& connection = m_connections[idx];
+
+            if ((CONNECTION_STATE_CLOSED == connection.state) &&
+                (true == connection.client.isDisconnected()))
+            {
+                connectionId    = idx;
+                isFound         = true;
+            }
+        }
+
+        if (true == isFound)
+        {
+            m_connectTimer.start(CONNECT_GAP);
+        }
+        else
+        {
+            bool isClosing = false;
+
+            /* No free connection? Close a idle one to a different host,
+             * which will be available in one of the next cycles.
+             */
+            for(idx = 0U; (idx < MAX_CONNECTIONS) && (false == isClosing); ++idx)
+            {
+                Connection& connection = m_connections[idx];
+
+                if (CONNECTION_STATE_IDLE == connection.state)
+                {
+                    connection.client.disconnect();
+                    connection.state = CONNECTION_STATE_CLOSING;
+                    isClosing = true;
+                }
+            }
+        }
+    }
+
+    return isFound;
+}
+
+void HttpScheduler::sendRequest(uint8_t connectionId, HttpRequest& request)
+{
+    Connection& connection  = m_connections[connectionId];
+    bool        status      = connection.client.begin(request.m_url);
+    uint8_t     idx         = 0U;
+
+    if (true == status)
+    {
+        /* The body callback of the previous request may still run. */
+        connection.client.stopBodyReader();
+
+        /* The body callback is copied, because it runs in the body stream task context. */
+        connection.client.regOnBody(request.m_onBodyCallback);
+        connection.bodyOwner = (nullptr != request.m_onBodyCallback) ? &request : nullptr;
+
+        for(idx = 0U; idx < request.m_parCnt; ++idx)
+        {
+            connection.client.addPar(request.m_parNames[idx], request.m_parValues[idx]);
+        }
+
+        /* Conditional GET request? */
+        if ((HttpRequest::METHOD_GET == request.m_method) &&
+            (nullptr != request.m_onUnchangedCallback))
+        {
+            if (false == request.m_etag.isEmpty())
+            {
+                connection.client.addHeader("If-None-Match", request.m_etag);
+            }
+
+            if (false == request.m_lastModified.isEmpty())
+            {
+                connection.client.addHeader("If-Modified-Since", request.m_lastModified);
+            }
+        }
+
+        if (HttpRequest::METHOD_POST == request.m_method)
+        {
+            status = connection.client.POST();
+        }
+        else
+        {
+            status = connection.client.GET();
+        }
+    }
+
+    if (false == status)
+    {
+        LOG_WARNING("Request %s failed.", request.m_url.c_str());
+
+        for(idx = 0U; idx < MAX_REQUESTS; ++idx)
+        {
+            if (&request == m_requests[idx])
+            {
+                finishRequest(idx, nullptr, true);
+            }
+        }
+
+        if (false == connection.client.isConnected())
+        {
+            connection.client.disconnect();
+            connection.state = CONNECTION_STATE_CLOSING;
+        }
+    }
+    else
+    {
+        connection.state    = CONNECTION_STATE_BUSY;
+        connection.hostKey  = request.m_hostKey;
+        connection.timer.start(RESPONSE_TIMEOUT);
+
+        request.m_state         = HttpRequest::STATE_ACTIVE;
+        request.m_connectionId  = connectionId;
+
+        /* All waiting requests with the same URL get this response too. */
+        for(idx = 0U; idx < MAX_REQUESTS; ++idx)
+        {
+            HttpRequest* other = m_requests[idx];
+
+            if ((nullptr != other) &&
+                (HttpRequest::STATE_QUEUED == other->m_state) &&
+                (true == isSameGetRequest(request, *other)))
+            {
+                other->m_state          = HttpRequest::STATE_ACTIVE;
+                other->m_connectionId   = connectionId;
+
+                LOG_DEBUG("Request %s coalesced.", other->m_url.c_str());
+            }
+        }
+    }
+
+    return;
+}
+
+HttpRequest* HttpScheduler::getActiveRequest(const HttpRequest& request)
+{
+    HttpRequest*    activeRequest   = nullptr;
+    uint8_t         idx             = 0U;
+
+    for(idx = 0U; (idx < MAX_REQUESTS) && (nullptr == activeRequest); ++idx)
+    {
+        HttpRequest* other = m_requests[idx];
+
+        if ((nullptr != other) &&
+            (HttpRequest::STATE_ACTIVE == other->m_state) &&
+            (true == isSameGetRequest(request, *other)))
+        {
+            activeRequest = other;
+        }
+    }
+
+    return activeRequest;
+}
+
+bool HttpScheduler::isSameGetRequest(const HttpRequest& request, const HttpRequest& other) const
+{
+    /* A streamed response body can be read only once and
+     * a 304 (Not Modified) response is only valid for the same validators.
+     */
+    return (HttpRequest::METHOD_GET == request.m_method) &&
+           (HttpRequest::METHOD_GET == other.m_method) &&
+           (nullptr == request.m_onBodyCallback) &&
+           (nullptr == other.m_onBodyCallback) &&
+           (request.m_etag == other.m_etag) &&
+           (request.m_lastModified == other.m_lastModified) &&
+           (request.m_url == other.m_url);
+}
+
+void HttpScheduler::finishRequests(uint8_t connectionId, const HttpResponse* rsp, bool isError)
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < MAX_REQUESTS; ++idx)
+    {
+        HttpRequest* request = m_requests[idx];
+
+        if ((nullptr != request) &&
+            (HttpRequest::STATE_ACTIVE == request->m_state) &&
+            (connectionId == request->m_connectionId))
+        {
+            finishRequest(idx, rsp, isError);
+        }
+    }
+
+    return;
+}
+
+void HttpScheduler::finishRequest(uint8_t index, const HttpResponse* rsp, bool isError)
+{
+    HttpRequest* request = m_requests[index];
+
+    m_requests[index]   = nullptr;
+    request->m_state    = HttpRequest::STATE_IDLE;
+
+    if (nullptr == rsp)
+    {
+        /* Nothing to do. */
+        ;
+    }
+    else if ((HTTP_STATUS_NOT_MODIFIED == rsp->getStatusCode()) &&
+             (nullptr != request->m_onUnchangedCallback))
+    {
+        request->m_onUnchangedCallback();
+    }
+    else
+    {
+        /* Remember the validators for the next conditional request. */
+        if ((HTTP_STATUS_OK == rsp->getStatusCode()) &&
+            (nullptr != request->m_onUnchangedCallback))
+        {
+            request->m_etag         = rsp->getHeader("ETag");
+            request->m_lastModified = rsp->getHeader("Last-Modified");
+        }
+        else
+        {
+            request->m_etag.clear();
+            request->m_lastModified.clear();
+        }
+
+        if (nullptr != request->m_onRspCallback)
+        {
+            request->m_onRspCallback(*rsp);
+        }
+    }
+
+    if ((true == isError) &&
+        (nullptr != request->m_onErrorCallback))
+    {
+        request->m_onErrorCallback();
+    }
+
+    if (nullptr != request->m_onClosedCallback)
+    {
+        request->m_onClosedCallback();
+    }
+
+    return;
+}
+
+void HttpScheduler::onResponse(uint8_t connectionId, const HttpResponse& rsp)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    Connection&                 connection  = m_connections[connectionId];
+
+    finishRequests(connectionId, &rsp, false);
+
+    /* Keep the connection alive for the next request. */
+    if (CONNECTION_STATE_BUSY == connection.state)
+    {
+        connection.state = CONNECTION_STATE_IDLE;
+        connection.timer.start(KEEP_ALIVE_TIMEOUT);
+    }
+
+    return;
+}
+
+void HttpScheduler::onClosed(uint8_t connectionId)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    Connection&                 connection  = m_connections[connectionId];
+
+    /* Requests without response are finished too. */
+    finishRequests(connectionId, nullptr, false);
+
+    connection.hostKey.clear();
+    connection.state = CONNECTION_STATE_CLOSED;
+    connection.timer.stop();
+
+    return;
+}
+
+void HttpScheduler::onError(uint8_t connectionId)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+
+    /* The connection will be closed by the client. */
+    finishRequests(connectionId, nullptr, true);
+
+    return;
+}
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
@@ -0,0 +1,285 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP scheduler
+ * @author Andreas Merkle <web@blue-andi.de>
+ *
+ * @addtogroup web
+ *
+ * @{
+ */
+
+#ifndef __HTTP_SCHEDULER_H__
+#define __HTTP_SCHEDULER_H__
+
+/******************************************************************************
+ * Compile Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include <stdint.h>
+#include <Mutex.hpp>
+#include <SimpleTimer.hpp>
+
+#include "AsyncHttpClient.h"
+#include "HttpRequest.h"
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and Classes
+ *****************************************************************************/
+/**
+ * The HTTP scheduler executes the HTTP requests of all plugins with a
+ * small pool of HTTP clients. This limits the number of concurrent
+ * connections and therefore the heap usage.
+ *
+ * - Connections are kept alive and reused by requests to the same host and port.
+ * - Pending GET requests with the same URL are coalesced and get the same response,
+ *   except the response body is streamed.
+ * - Every request is delayed by a random time and new connections are established
+ *   with a minimum gap, to avoid that several plugins connect at the same time.
+ * - GET requests can be conditional, see HttpRequest::regOnUnchanged().
+ */
+class HttpScheduler
+{
+public:
+
+    /**
+     * Get the HTTP scheduler instance.
+     *
+     * @return HTTP scheduler instance
+     */
+    static HttpScheduler& getInstance()
+    {
+        static HttpScheduler instance; /* singleton idiom to force initialization in the first usage. */
+
+        return instance;
+    }
+
+    /**
+     * Process the scheduler: start the pending requests and supervise the
+     * connections. Call this periodically.
+     */
+    void process();
+
+    /** Max. number of connections. */
+    static const uint8_t    MAX_CONNECTIONS     = 2U;
+
+    /** Max. number of pending requests. */
+    static const uint8_t    MAX_REQUESTS        = 16U;
+
+    /** Max. random delay of a request in ms. */
+    static const uint32_t   JITTER_MAX          = 1000U;
+
+    /** Min. time between two connection establishments in ms. */
+    static const uint32_t   CONNECT_GAP         = 250U;
+
+    /** Max. time to wait for a response in ms. */
+    static const uint32_t   RESPONSE_TIMEOUT    = 15000U;
+
+    /** Time in ms, after a idle connection is closed. */
+    static const uint32_t   KEEP_ALIVE_TIMEOUT  = 20000U;
+
+    /** HTTP status code: OK */
+    static const uint16_t   HTTP_STATUS_OK              = 200U;
+
+    /** HTTP status code: Not Modified */
+    static const uint16_t   HTTP_STATUS_NOT_MODIFIED    = 304U;
+
+private:
+
+    friend class HttpRequest;
+
+    /**
+     * Connection states
+     */
+    enum ConnectionState
+    {
+        CONNECTION_STATE_CLOSED = 0,    /**< No connection */
+        CONNECTION_STATE_BUSY,          /**< Request sent or connection establishment in progress. */
+        CONNECTION_STATE_IDLE,          /**< Connection is alive and can be reused. */
+        CONNECTION_STATE_CLOSING        /**< Connection is closing. */
+    };
+
+    /**
+     * A connection of the pool.
+     */
+    struct Connection
+    {
+        AsyncHttpClient client;     /**< HTTP client */
+        ConnectionState state;      /**< Connection state */
+        String          hostKey;    /**< Protocol, host and port the client is connected to. */
+        SimpleTimer     timer;      /**< Timer for response timeout and keep alive timeout */
+        HttpRequest*    bodyOwner;  /**< Request, whose body callback may still run in the body stream task. */
+
+        /**
+         * Constructs a connection.
+         */
+        Connection() :
+            client(),
+            state(CONNECTION_STATE_CLOSED),
+            hostKey(),
+            timer(),
+            bodyOwner(nullptr)
+        {
+        }
+    };
+
+    mutable MutexRecursive  m_mutex;                        /**< Mutex to protect against concurrent access. */
+    Connection              m_connections[MAX_CONNECTIONS]; /**< Connection pool */
+    HttpRequest*            m_requests[MAX_REQUESTS];       /**< Pending requests */
+    SimpleTimer             m_connectTimer;                 /**< Timer to keep the gap between connection establishments. */
+
+    /**
+     * Constructs the HTTP scheduler.
+     */
+    HttpScheduler();
+
+    /**
+     * Destroys the HTTP scheduler.
+     */
+    ~HttpScheduler();
+
+    HttpScheduler(const HttpScheduler& scheduler);
+    HttpScheduler& operator=(const HttpScheduler& scheduler);
+
+    /**
+     * Schedule a request. A GET request, which has the same URL as an other
+     * pending GET request, gets the same response.
+     *
+     * @param[in] request   Request
+     *
+     * @return If successful scheduled, it will return true otherwise false.
+     */
+    bool schedule(HttpRequest& request);
+
+    /**
+     * Abort a request. Its callbacks won't be called anymore.
+     * If the request is already sent and no other request waits for the
+     * same response, the connection is aborted too.
+     *
+     * @param[in] request   Request
+     */
+    void abort(HttpRequest& request);
+
+    /**
+     * Supervise the connection timeouts.
+     *
+     * @param[in] connectionId  Connection id
+     */
+    void superviseConnection(uint8_t connectionId);
+
+    /**
+     * Get a connection for the request, which is ready to send.
+     *
+     * @param[in] request       Request
+     * @param[out] connectionId Connection id
+     *
+     * @return If a connection is available, it will return true otherwise false.
+     */
+    bool getConnection(const HttpRequest& request, uint8_t& connectionId);
+
+    /**
+     * Send the request via the connection.
+     *
+     * @param[in] connectionId  Connection id
+     * @param[in] request       Request
+     */
+    void sendRequest(uint8_t connectionId, HttpRequest& request);
+
+    /**
+     * Get a pending GET request with the same URL, which is already sent.
+     *
+     * @param[in] request   Request
+     *
+     * @return Sent request or nullptr if there is none.
+     */
+    HttpRequest* getActiveRequest(const HttpRequest& request);
+
+    /**
+     * Is the request a GET request with the same URL?
+     *
+     * @param[in] request   Request
+     * @param[in] other     Other request
+     *
+     * @return If same GET request, it will return true otherwise false.
+     */
+    bool isSameGetRequest(const HttpRequest& request, const HttpRequest& other) const;
+
+    /**
+     * Finish all requests, which are sent via the connection and remove them.
+     *
+     * @param[in] connectionId  Connection id
+     * @param[in] rsp           Response or nullptr if the request failed.
+     * @param[in] isError       Notify error?
+     */
+    void finishRequests(uint8_t connectionId, const HttpResponse* rsp, bool isError);
+
+    /**
+     * Finish the request and remove it.
+     *
+     * @param[in] index     Request index
+     * @param[in] rsp       Response or nullptr if the request failed.
+     * @param[in] isError   Notify error?
+     */
+    void finishRequest(uint8_t index, const HttpResponse* rsp, bool isError);
+
+    /**
+     * This method is called by a HTTP client if a response is received.
+     *
+     * @param[in] connectionId  Connection id
+     * @param[in] rsp           Response
+     */
+    void onResponse(uint8_t connectionId, const HttpResponse& rsp);
+
+    /**
+     * This method is called by a HTTP client if the connection is closed.
+     *
+     * @param[in] connectionId  Connection id
+     */
+    void onClosed(uint8_t connectionId);
+
+    /**
+     * This method is called by a HTTP client if a error happened.
+     *
+     * @param[in] connectionId  Connection id
+     */
+    void onError(uint8_t connectionId);
+};
+
+/******************************************************************************
+ * Functions
+ *****************************************************************************/
+
+#endif  /* __HTTP_SCHEDULER_H__ */
+
+/** @} */
\ No newline at end of file
@@ -41,6 +41,7 @@
 #include "WiFiUtil.h"
 #include "FileSystem.h"
 #include "RestUtil.h"
+#include "SpectrumAnalyzer.h"
 
 #include <Util.h>
 #include <WiFi.h>
@@ -68,9 +69,13 @@
 static void handleButton(AsyncWebServerRequest* request);
 static void handleFadeEffect(AsyncWebServerRequest* request);
 static void handleSlots(AsyncWebServerRequest* request);
+static void handleDisplayStats(AsyncWebServerRequest* request);
+static void addTimingStatistic(JsonObject& jsonObj, const DisplayMgr::TimingStatistic& statistic);
 static void handlePluginInstall(AsyncWebServerRequest* request);
 static void handlePluginUninstall(AsyncWebServerRequest* request);
 static void handlePlugins(AsyncWebServerRequest* request);
+static void handlePluginTopics(AsyncWebServerRequest* request);
+static void handlePluginTopicsBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
 static void handleSensors(AsyncWebServerRequest* request);
 static void handleSettings(AsyncWebServerRequest* request);
 static void handleSetting(AsyncWebServerRequest* request);
@@ -109,8 +114,10 @@ void RestApi::init(AsyncWebServer& srv)
     (void)srv.on("/rest/api/v1/button", handleButton);
     (void)srv.on("/rest/api/v1/display/fadeEffect", handleFadeEffect);
     (void)srv.on("/rest/api/v1/display/slots", handleSlots);
+    (void)srv.on("/rest/api/v1/display/stats", handleDisplayStats);
     (void)srv.on("/rest/api/v1/plugin/install", handlePluginInstall);
     (void)srv.on("/rest/api/v1/plugin/uninstall", handlePluginUninstall);
+    (void)srv.on("/rest/api/v1/plugins/topics", HTTP_ANY, handlePluginTopics, nullptr, handlePluginTopicsBody);
     (void)srv.on("/rest/api/v1/plugins", handlePlugins);
     (void)srv.on("/rest/api/v1/sensors", handleSensors);
     (void)srv.on("/rest/api/v1/settings", handleSettings);
@@ -292,6 +299,187 @@ static void handleSlots(AsyncWebServerRequest* request)
     return;
 }
 
+/**
+ * Get the display timing statistics in us, or enable/disable/reset them.
+ * The histograms show which plugin exceeds the display refresh period.
+ * The plugin startup information (start duration in us and timestamp of
+ * the first activation in ms since boot) and the number of skipped frames,
+ * which were not shown because nothing changed, are always available.
+ * GET \c "/api/v1/display/stats"
+ * POST \c "/api/v1/display/stats?enable=<0|1>&reset=1"
+ *
+ * @param[in] request   HTTP request
+ */
+static void handleDisplayStats(AsyncWebServerRequest* request)
+{
+    uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
+    const size_t        JSON_DOC_SIZE   = 8192U;
+    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+    DisplayMgr&         displayMgr      = DisplayMgr::getInstance();
+
+    if (nullptr == request)
+    {
+        return;
+    }
+
+    if (HTTP_GET == request->method())
+    {
+        JsonVariant                     dataObj     = RestUtil::prepareRspSuccess(jsonDoc);
+        DisplayMgr::Statistics          statistics;
+        DisplayMgr::PluginStatistics    pluginStatistics;
+        DisplayMgr::PluginStartup       pluginStartup;
+        JsonArray                       jsonStartup = dataObj.createNestedArray("startup");
+        uint8_t                         slotId      = 0U;
+
+        for(slotId = 0U; slotId < displayMgr.getMaxSlots(); ++slotId)
+        {
+            IPluginMaintenance* plugin = displayMgr.getPluginInSlot(slotId);
+
+            if ((nullptr != plugin) &&
+                (true == displayMgr.getPluginStartup(slotId, pluginStartup)))
+            {
+                JsonObject jsonSlot = jsonStartup.createNestedObject();
+
+                jsonSlot["slotId"]          = slotId;
+                jsonSlot["name"]            = plugin->getName();
+                jsonSlot["uid"]             = plugin->getUID();
+                jsonSlot["isStarted"]       = pluginStartup.isStarted;
+                jsonSlot["duration"]        = pluginStartup.duration;
+                jsonSlot["firstActivation"] = pluginStartup.firstActivation;
+            }
+        }
+
+        dataObj["skippedFrames"] = displayMgr.getSkippedFrames();
+
+        if (false == displayMgr.getStatistics(statistics))
+        {
+            dataObj["enabled"] = false;
+        }
+        else
+        {
+            JsonArray   jsonLimits  = dataObj.createNestedArray("bucketLimits");
+            JsonObject  jsonFade    = dataObj.createNestedObject("fade");
+            JsonObject  jsonShow    = dataObj.createNestedObject("show");
+            JsonObject  jsonWait    = dataObj.createNestedObject("waitReady");
+            JsonObject  jsonTotal   = dataObj.createNestedObject("total");
+            JsonObject  jsonPeriod  = dataObj.createNestedObject("refreshPeriod");
+            JsonArray   jsonSlots   = dataObj.createNestedArray("slots");
+            uint8_t     idx         = 0U;
+
+            dataObj["enabled"] = true;
+
+            /* The last bucket has no upper limit. */
+            for(idx = 0U; idx < (DisplayMgr::STATISTICS_BUCKETS - 1U); ++idx)
+            {
+                (void)jsonLimits.add(statistics.total.getBucketLimit(idx));
+            }
+
+            addTimingStatistic(jsonFade, statistics.fade);
+            addTimingStatistic(jsonShow, statistics.show);
+            addTimingStatistic(jsonWait, statistics.waitReady);
+            addTimingStatistic(jsonTotal, statistics.total);
+            addTimingStatistic(jsonPeriod, statistics.refreshPeriod);
+
+            for(slotId = 0U; slotId < displayMgr.getMaxSlots(); ++slotId)
+            {
+                IPluginMaintenance* plugin = displayMgr.getPluginInSlot(slotId);
+
+                if ((nullptr != plugin) &&
+                    (true == displayMgr.getPluginStatistics(slotId, pluginStatistics)))
+                {
+                    JsonObject jsonSlot     = jsonSlots.createNestedObject();
+                    JsonObject jsonProcess  = jsonSlot.createNestedObject("process");
+                    JsonObject jsonUpdate   = jsonSlot.createNestedObject("update");
+
+                    jsonSlot["slotId"]  = slotId;
+                    jsonSlot["name"]    = plugin->getName();
+                    jsonSlot["uid"]     = plugin->getUID();
+
+                    addTimingStatistic(jsonProcess, pluginStatistics.process);
+                    addTimingStatistic(jsonUpdate, pluginStatistics.update);
+                }
+            }
+        }
+
+        httpStatusCode = HttpStatus::STATUS_CODE_OK;
+    }
+    else if (HTTP_POST == request->method())
+    {
+        bool isSuccessful = true;
+
+        if (true == request->hasArg("enable"))
+        {
+            String enable = request->arg("enable");
+
+            if (enable == "1")
+            {
+                isSuccessful = displayMgr.enableStatistics(true);
+            }
+            else if (enable == "0")
+            {
+                isSuccessful = displayMgr.enableStatistics(false);
+            }
+            else
+            {
+                isSuccessful = false;
+            }
+        }
+
+        if ((true == isSuccessful) &&
+            (true == request->hasArg("reset")) &&
+            (request->arg("reset") == "1"))
+        {
+            displayMgr.resetStatistics();
+        }
+
+        if (false == isSuccessful)
+        {
+            RestUtil::prepareRspError(jsonDoc, "Invalid parameter or out of memory.");
+            httpStatusCode = HttpStatus::STATUS_CODE_BAD_REQUEST;
+        }
+        else
+        {
+            JsonVariant dataObj = RestUtil::prepareRspSuccess(jsonDoc);
+
+            dataObj["enabled"]  = displayMgr.isStatisticsEnabled();
+            httpStatusCode      = HttpStatus::STATUS_CODE_OK;
+        }
+    }
+    else
+    {
+        RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
+        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+    }
+
+    RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
+
+    return;
+}
+
+/**
+ * Add a timing statistic to the JSON object.
+ *
+ * @param[in] jsonObj   JSON object
+ * @param[in] statistic Timing statistic
+ */
+static void addTimingStatistic(JsonObject& jsonObj, const DisplayMgr::TimingStatistic& statistic)
+{
+    JsonArray   jsonBuckets = jsonObj.createNestedArray("buckets");
+    uint8_t     idx         = 0U;
+
+    jsonObj["min"]      = statistic.getMin();
+    jsonObj["avg"]      = statistic.getAvg();
+    jsonObj["max"]      = statistic.getMax();
+    jsonObj["count"]    = statistic.getCount();
+
+    for(idx = 0U; idx < DisplayMgr::TimingStatistic::BUCKET_CNT; ++idx)
+    {
+        (void)jsonBuckets.add(statistic.getBucketCount(idx));
+    }
+
+    return;
+}
+
 /**
  * Install plugin
  * POST \c "/api/v1/plugin/install?name=<plugin-name>"
@@ -486,6 +674,143 @@ static void handlePlugins(AsyncWebServerRequest* request)
     return;
 }
 
+/**
+ * Read or write many plugin topics with one request. The body contains a JSON
+ * array of operations, see PluginMgr::processTopicOperation(). The results are
+ * streamed in the same order, therefore only one result is kept in memory.
+ * The body must be sent with the content type "application/json".
+ * POST \c "/api/v1/plugins/topics"
+ *
+ * Example body:
+ * [{ "uid": 1234, "topic": "text", "value": { "show": "Hello" } }, { "alias": "weather", "topic": "weather" }]
+ *
+ * @param[in] request   HTTP request
+ */
+static void handlePluginTopics(AsyncWebServerRequest* request)
+{
+    const size_t        JSON_DOC_SIZE           = 512U;
+    const size_t        JSON_DOC_OPS_SIZE       = 4096U;
+    const size_t        JSON_DOC_RESULT_SIZE    = 1024U;
+    DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
+    uint32_t            httpStatusCode          = HttpStatus::STATUS_CODE_OK;
+    char*               body                    = nullptr;
+    bool                isStreamed              = false;
+
+    if (nullptr == request)
+    {
+        return;
+    }
+
+    body = static_cast<char*>(request->_tempObject);
+
+    if (HTTP_POST != request->method())
+    {
+        RestUtil::prepareRspErrorHttpMethodNotSupported(jsonDoc);
+        httpStatusCode = HttpStatus::STATUS_CODE_NOT_FOUND;
+    }
+    else if (nullptr == body)
+    {
+        RestUtil::prepareRspError(jsonDoc, "Operations are missing or too large.");
+        httpStatusCode = HttpStatus::STATUS_CODE_BAD_REQUEST;
+    }
+    else
+    {
+        DynamicJsonDocument     jsonDocOps(JSON_DOC_OPS_SIZE);
+        DeserializationError    error       = deserializeJson(jsonDocOps, body); /* Zero-copy, the body is kept until the request is destroyed. */
+
+        if ((DeserializationError::Ok != error) ||
+            (false == jsonDocOps.is<JsonArray>()))
+        {
+            RestUtil::prepareRspError(jsonDoc, "Invalid operations.");
+            httpStatusCode = HttpStatus::STATUS_CODE_BAD_REQUEST;
+        }
+        else
+        {
+            AsyncResponseStream*    response        = request->beginResponseStream("application/json");
+            DynamicJsonDocument     jsonDocResult(JSON_DOC_RESULT_SIZE);
+            bool                    isFirst         = true;
+
+            response->setCode(HttpStatus::STATUS_CODE_OK);
+            (void)response->print("{\"data\":{\"results\":[");
+
+            for(JsonVariant operation : jsonDocOps.as<JsonArray>())
+            {
+                jsonDocResult.clear();
+                (void)PluginMgr::getInstance().processTopicOperation(operation.as<JsonObject>(), jsonDocResult.to<JsonObject>());
+
+                if (true == jsonDocResult.overflowed())
+                {
+                    LOG_ERROR("JSON document has less memory available.");
+                }
+
+                if (false == isFirst)
+                {
+                    (void)response->print(",");
+                }
+
+                (void)serializeJson(jsonDocResult, *response);
+                isFirst = false;
+            }
+
+            (void)response->print("]},\"status\":\"ok\"}");
+            request->send(response);
+
+            isStreamed = true;
+        }
+    }
+
+    if (false == isStreamed)
+    {
+        RestUtil::sendJsonRsp(request, jsonDoc, httpStatusCode);
+    }
+
+    return;
+}
+
+/**
+ * Receive the body of a plugin topics request.
+ *
+ * @param[in] request   HTTP request
+ * @param[in] data      Next body data part, starting at index
+ * @param[in] len       Body data part size in byte
+ * @param[in] index     Current body offset
+ * @param[in] total     Total body size in byte
+ */
+static void handlePluginTopicsBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)
+{
+    const size_t MAX_BODY_SIZE = 4096U;
+
+    if ((nullptr == request) ||
+        (nullptr == data))
+    {
+        return;
+    }
+
+    /* Begin of body? A too large body is ignored and the request fails later. */
+    if ((0U == index) &&
+        (MAX_BODY_SIZE >= total))
+    {
+        /* The request releases it with free(). */
+        request->_tempObject = malloc(total + 1U);
+    }
+
+    if ((nullptr != request->_tempObject) &&
+        (total >= (index + len)))
+    {
+        char* body = static_cast<char*>(request->_tempObject);
+
+        memcpy(&body[index], data, len);
+
+        /* End of body? */
+        if (total == (index + len))
+        {
+            body[total] = '\0';
+        }
+    }
+
+    return;
+}
+
 /**
  * List all sensors.
  * GET \c "/api/v1/sensors"
@@ -1025,7 +1350,7 @@ static bool storeSetting(KeyValue* parameter, const String& value, String& error
 static void handleStatus(AsyncWebServerRequest* request)
 {
     uint32_t            httpStatusCode  = HttpStatus::STATUS_CODE_OK;
-    const size_t        JSON_DOC_SIZE   = 512U;
+    const size_t        JSON_DOC_SIZE   = 768U;
     DynamicJsonDocument jsonDoc(JSON_DOC_SIZE);
 
     if (nullptr == request)
@@ -1047,6 +1372,10 @@ static void handleStatus(AsyncWebServerRequest* request)
         JsonObject  swObj           = dataObj.createNestedObject("software");
         JsonObject  internalRamObj  = swObj.createNestedObject("internalRam");
         JsonObject  wifiObj         = dataObj.createNestedObject("wifi");
+        JsonObject  fftObj          = dataObj.createNestedObject("fft");
+        JsonObject  fftDurationObj  = fftObj.createNestedObject("duration");
+
+        SpectrumAnalyzer::FftDuration fftDuration = SpectrumAnalyzer::getInstance().getFftDuration();
 
         /* Only in station mode it makes sense to retrieve the RSSI.
          * Otherwise keep it -100 dbm.
@@ -1077,6 +1406,11 @@ static void handleStatus(AsyncWebServerRequest* request)
         wifiObj["rssi"]         = rssi;                             // dBm
         wifiObj["quality"]      = WiFiUtil::getSignalQuality(rssi); // percent
 
+        fftObj["isFloat"]       = (0 != CONFIG_SPECTRUM_ANALYZER_FLOAT_FFT);
+        fftDurationObj["min"]   = fftDuration.getMin();     // us
+        fftDurationObj["avg"]   = fftDuration.getAvg();     // us
+        fftDurationObj["max"]   = fftDuration.getMax();     // us
+
         httpStatusCode          = HttpStatus::STATUS_CODE_OK;
     }
 
@@ -48,6 +48,7 @@
 #include "WsCmdReset.h"
 #include "WsCmdSlotDuration.h"
 #include "WsCmdSlots.h"
+#include "WsCmdTopics.h"
 #include "WsCmdUninstall.h"
 
 #include <Logging.h>
@@ -115,6 +116,9 @@ static WsCmdEffect          gWsCmdEffect;
 /** Websocket get/set plugin alias name command */
 static WsCmdAlias           gWsCmdAlias;
 
+/** Websocket read/write plugin topics command */
+static WsCmdTopics          gWsCmdTopics;
+
 /** Websocket command list */
 static WsCmd*       gWsCommands[] =
 {
@@ -131,7 +135,8 @@ static WsCmd*       gWsCommands[] =
     &gWsCmdIperf,
     &gWsCmdButton,
     &gWsCmdEffect,
-    &gWsCmdAlias
+    &gWsCmdAlias,
+    &gWsCmdTopics
 };
 
 /******************************************************************************
@@ -168,6 +173,13 @@ void WebSocketSrv::init(AsyncWebServer& srv)
     return;
 }
 
+void WebSocketSrv::process()
+{
+    gWsCmdGetDisp.process(m_webSocket);
+
+    return;
+}
+
 /******************************************************************************
  * Protected Methods
  *****************************************************************************/
@@ -229,6 +241,10 @@ void WebSocketSrv::onConnect(AsyncWebSocket* server, AsyncWebSocketClient* clien
 void WebSocketSrv::onDisconnect(AsyncWebSocket* server, AsyncWebSocketClient* client)
 {
     LOG_INFO("ws[%s][%u] Client disconnected.", server->url(), client->id());
+
+    /* Stop pushing the display content to the client. */
+    gWsCmdGetDisp.unsubscribe(client->id());
+
     return;
 }
 
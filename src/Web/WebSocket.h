@@ -83,6 +83,12 @@ public:
      */
     void init(AsyncWebServer& srv);
 
+    /**
+     * Process the websocket server, e.g. push the display content to the
+     * subscribed clients. Call this periodically.
+     */
+    void process();
+
 private:
 
     AsyncWebSocket  m_webSocket;    /**< Websocket */
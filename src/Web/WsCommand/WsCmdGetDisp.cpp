@@ -37,6 +37,9 @@
 
 #include <Util.h>
 #include <Display.h>
+#include <FramebufferCodec.h>
+#include <Logging.h>
+#include <new>
 
 /******************************************************************************
  * Compiler Switches
@@ -70,6 +73,13 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
         return;
     }
 
+    /* Subscription requires the period. */
+    if ((MODE_SUBSCRIBE == m_mode) &&
+        (2U != m_cnt))
+    {
+        m_isError = true;
+    }
+
     /* Any error happended? */
     if (true == m_isError)
     {
@@ -77,37 +87,170 @@ void WsCmdGetDisp::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
     }
     else
     {
-        uint32_t    index       = 0U;
-        String      rsp         = "ACK";
-        const char  DELIMITER   = ';';
-        IDisplay&   display     = Display::getInstance();
-        uint32_t    framebuffer[display.getWidth() * display.getHeight()];
-        uint8_t     slotId      = DisplayMgr::SLOT_ID_INVALID;
+        MutexGuard<MutexRecursive> guard(m_mutex);
 
-        DisplayMgr::getInstance().getFBCopy(framebuffer, UTIL_ARRAY_NUM(framebuffer), &slotId);
-
-        rsp += DELIMITER;
-        rsp += slotId;
-
-        for(index = 0U; index <  UTIL_ARRAY_NUM(framebuffer); ++index)
+        if (false == allocBuffers())
+        {
+            server->text(client->id(), "NACK;\"Out of memory.\"");
+        }
+        else if (MODE_TEXT == m_mode)
+        {
+            sendText(server, client);
+        }
+        else if (MODE_BINARY == m_mode)
         {
-            rsp += DELIMITER;
-            rsp += Util::uint32ToHex(framebuffer[index]);
+            sendBinary(server, client);
         }
+        else
+        {
+            String      rsp         = "ACK";
+            const char  DELIMITER   = ';';
+
+            /* A period of 0 removes the subscription. */
+            if (0U == m_period)
+            {
+                unsubscribe(client->id());
+
+                rsp += DELIMITER;
+                rsp += m_period;
+
+                server->text(client->id(), rsp);
+            }
+            else
+            {
+                if (MIN_PERIOD > m_period)
+                {
+                    m_period = MIN_PERIOD;
+                }
 
-        server->text(client->id(), rsp);
+                if (false == subscribe(client->id(), m_period))
+                {
+                    server->text(client->id(), "NACK;\"Too many subscribers.\"");
+                }
+                else
+                {
+                    rsp += DELIMITER;
+                    rsp += m_period;
+
+                    server->text(client->id(), rsp);
+                }
+            }
+        }
     }
 
-    m_isError = false;
+    m_isError   = false;
+    m_cnt       = 0U;
+    m_mode      = MODE_TEXT;
+    m_period    = 0U;
 
     return;
 }
 
 void WsCmdGetDisp::setPar(const char* par)
 {
-    UTIL_NOT_USED(par);
+    if (0U == m_cnt)
+    {
+        if (0 == strcmp(par, "BIN"))
+        {
+            m_mode = MODE_BINARY;
+        }
+        else if (0 == strcmp(par, "SUB"))
+        {
+            m_mode = MODE_SUBSCRIBE;
+        }
+        else
+        {
+            m_isError = true;
+        }
+    }
+    else if ((1U == m_cnt) &&
+             (MODE_SUBSCRIBE == m_mode))
+    {
+        if (false == Util::strToUInt32(String(par), m_period))
+        {
+            m_isError = true;
+        }
+    }
+    else
+    {
+        m_isError = true;
+    }
+
+    ++m_cnt;
+
+    return;
+}
+
+void WsCmdGetDisp::process(AsyncWebSocket& server)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     idx         = 0U;
+    bool                        isCaptured  = false;
+    uint8_t                     slotId      = DisplayMgr::SLOT_ID_INVALID;
+    IDisplay&                   display     = Display::getInstance();
+
+    for(idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        Subscriber& subscriber = m_subscribers[idx];
+
+        if ((true == subscriber.isUsed) &&
+            (true == subscriber.timer.isTimeout()))
+        {
+            subscriber.timer.start(subscriber.period);
+
+            /* If the client can not keep up, the frame is skipped. The reference frame
+             * is kept, so the next delta frame is still based on what the client has.
+             */
+            if (true == server.availableForWrite(subscriber.clientId))
+            {
+                size_t size = 0U;
+
+                /* The framebuffer is copied only once for all subscribers. */
+                if (false == isCaptured)
+                {
+                    DisplayMgr::getInstance().getFBCopy(m_frame, m_frameLength, &slotId);
+                    isCaptured = true;
+                }
+
+                if (true == subscriber.isRefValid)
+                {
+                    size = FramebufferCodec::encodeDelta(m_txBuffer, m_txBufferSize, slotId, display.getWidth(), display.getHeight(), m_frame, subscriber.refFrame);
+                }
 
-    m_isError = true;
+                /* No reference frame or the delta frame is larger than a full frame? */
+                if (0U == size)
+                {
+                    size = FramebufferCodec::encodeFull(m_txBuffer, m_txBufferSize, slotId, display.getWidth(), display.getHeight(), m_frame, true);
+                }
+
+                /* Nothing changed, nothing to send. */
+                if (FramebufferCodec::HEADER_SIZE < size)
+                {
+                    server.binary(subscriber.clientId, m_txBuffer, size);
+
+                    memcpy(subscriber.refFrame, m_frame, m_frameLength * sizeof(uint32_t));
+                    subscriber.isRefValid = true;
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+void WsCmdGetDisp::unsubscribe(uint32_t clientId)
+{
+    MutexGuard<MutexRecursive>  guard(m_mutex);
+    uint8_t                     idx     = 0U;
+
+    for(idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+    {
+        if ((true == m_subscribers[idx].isUsed) &&
+            (clientId == m_subscribers[idx].clientId))
+        {
+            releaseSubscriber(m_subscribers[idx]);
+        }
+    }
 
     return;
 }
@@ -120,6 +263,170 @@ void WsCmdGetDisp::setPar(const char* par)
  * Private Methods
  *****************************************************************************/
 
+bool WsCmdGetDisp::allocBuffers()
+{
+    IDisplay&   display         = Display::getInstance();
+    size_t      frameLength     = static_cast<size_t>(display.getWidth()) * static_cast<size_t>(display.getHeight());
+    size_t      txBufferSize    = FramebufferCodec::getFullFrameSize(display.getWidth(), display.getHeight());
+
+    if (nullptr == m_frame)
+    {
+        m_frame = new(std::nothrow) uint32_t[frameLength];
+
+        if (nullptr != m_frame)
+        {
+            m_frameLength = frameLength;
+        }
+    }
+
+    if (nullptr == m_txBuffer)
+    {
+        m_txBuffer = new(std::nothrow) uint8_t[txBufferSize];
+
+        if (nullptr != m_txBuffer)
+        {
+            m_txBufferSize = txBufferSize;
+        }
+    }
+
+    return (nullptr != m_frame) && (nullptr != m_txBuffer);
+}
+
+void WsCmdGetDisp::releaseBuffers()
+{
+    if (nullptr != m_frame)
+    {
+        delete[] m_frame;
+        m_frame         = nullptr;
+        m_frameLength   = 0U;
+    }
+
+    if (nullptr != m_txBuffer)
+    {
+        delete[] m_txBuffer;
+        m_txBuffer      = nullptr;
+        m_txBufferSize  = 0U;
+    }
+
+    return;
+}
+
+bool WsCmdGetDisp::subscribe(uint32_t clientId, uint32_t period)
+{
+    Subscriber* subscriber  = nullptr;
+    uint8_t     idx         = 0U;
+
+    /* Already subscribed? */
+    for(idx = 0U; (idx < MAX_SUBSCRIBERS) && (nullptr == subscriber); ++idx)
+    {
+        if ((true == m_subscribers[idx].isUsed) &&
+            (clientId == m_subscribers[idx].clientId))
+        {
+            subscriber = &m_subscribers[idx];
+        }
+    }
+
+    /* Find a free entry. */
+    for(idx = 0U; (idx < MAX_SUBSCRIBERS) && (nullptr == subscriber); ++idx)
+    {
+        if (false == m_subscribers[idx].isUsed)
+        {
+            uint32_t* refFrame = new(std::nothrow) uint32_t[m_frameLength];
+
+            if (nullptr != refFrame)
+            {
+                subscriber              = &m_subscribers[idx];
+                subscriber->isUsed      = true;
+                subscriber->clientId    = clientId;
+                subscriber->refFrame    = refFrame;
+            }
+        }
+    }
+
+    if (nullptr != subscriber)
+    {
+        /* Start with a full frame. */
+        subscriber->period      = period;
+        subscriber->isRefValid  = false;
+        subscriber->timer.start(0U);
+
+        LOG_INFO("Client %u subscribed display content with %u ms period.", clientId, period);
+    }
+
+    return (nullptr != subscriber);
+}
+
+void WsCmdGetDisp::releaseSubscriber(Subscriber& subscriber)
+{
+    if (true == subscriber.isUsed)
+    {
+        LOG_INFO("Client %u unsubscribed display content.", subscriber.clientId);
+    }
+
+    if (nullptr != subscriber.refFrame)
+    {
+        delete[] subscriber.refFrame;
+        subscriber.refFrame = nullptr;
+    }
+
+    subscriber.isUsed       = false;
+    subscriber.isRefValid   = false;
+    subscriber.timer.stop();
+
+    return;
+}
+
+void WsCmdGetDisp::sendText(AsyncWebSocket* server, AsyncWebSocketClient* client)
+{
+    /* Max. length of a 32-bit hex value plus delimiter */
+    const size_t    COLOR_STR_LEN   = 9U;
+    uint32_t        index           = 0U;
+    String          rsp;
+    const char      DELIMITER       = ';';
+    uint8_t         slotId          = DisplayMgr::SLOT_ID_INVALID;
+
+    DisplayMgr::getInstance().getFBCopy(m_frame, m_frameLength, &slotId);
+
+    /* Reserve the space once, instead of growing the response per pixel. */
+    (void)rsp.reserve(8U + (m_frameLength * COLOR_STR_LEN));
+
+    rsp  = "ACK";
+    rsp += DELIMITER;
+    rsp += slotId;
+
+    for(index = 0U; index < m_frameLength; ++index)
+    {
+        rsp += DELIMITER;
+        rsp += Util::uint32ToHex(m_frame[index]);
+    }
+
+    server->text(client->id(), rsp);
+
+    return;
+}
+
+void WsCmdGetDisp::sendBinary(AsyncWebSocket* server, AsyncWebSocketClient* client)
+{
+    IDisplay&   display = Display::getInstance();
+    uint8_t     slotId  = DisplayMgr::SLOT_ID_INVALID;
+    size_t      size    = 0U;
+
+    DisplayMgr::getInstance().getFBCopy(m_frame, m_frameLength, &slotId);
+
+    size = FramebufferCodec::encodeFull(m_txBuffer, m_txBufferSize, slotId, display.getWidth(), display.getHeight(), m_frame, false);
+
+    if (0U == size)
+    {
+        server->text(client->id(), "NACK;\"Internal error.\"");
+    }
+    else
+    {
+        server->binary(client->id(), m_txBuffer, size);
+    }
+
+    return;
+}
+
 /******************************************************************************
  * External Functions
  *****************************************************************************/
@@ -45,6 +45,9 @@
  *****************************************************************************/
 #include "WsCmd.h"
 
+#include <SimpleTimer.hpp>
+#include <Mutex.hpp>
+
 /******************************************************************************
  * Macros
  *****************************************************************************/
@@ -55,18 +58,42 @@
 
 /**
  * Websocket command get display content
+ *
+ * The display content can be requested once as text or binary frame.
+ * Additionally a client can subscribe to get the display content pushed
+ * periodically as binary frames. Only the first frame is a full frame,
+ * the following are delta frames, which contain only the changes.
+ * The pushed frames are flagged, so a client can distinguish them from
+ * the response to a single request.
+ * See FramebufferCodec for the binary frame format.
  */
 class WsCmdGetDisp: public WsCmd
 {
 public:
 
+    /** Max. number of clients, which can subscribe at the same time. */
+    static const uint8_t    MAX_SUBSCRIBERS = 4U;
+
+    /** Min. period in ms, a subscriber will get the display content. */
+    static const uint32_t   MIN_PERIOD      = 40U;
+
     /**
      * Constructs a websocket get display command.
      */
     WsCmdGetDisp() :
         WsCmd("GETDISP"),
-        m_isError(false)
+        m_isError(false),
+        m_cnt(0U),
+        m_mode(MODE_TEXT),
+        m_period(0U),
+        m_mutex(),
+        m_subscribers(),
+        m_frame(nullptr),
+        m_frameLength(0U),
+        m_txBuffer(nullptr),
+        m_txBufferSize(0U)
     {
+        (void)m_mutex.create();
     }
 
     /**
@@ -74,6 +101,15 @@ public:
      */
     ~WsCmdGetDisp()
     {
+        uint8_t idx = 0U;
+
+        for(idx = 0U; idx < MAX_SUBSCRIBERS; ++idx)
+        {
+            releaseSubscriber(m_subscribers[idx]);
+        }
+
+        releaseBuffers();
+        m_mutex.destroy();
     }
 
     /**
@@ -91,12 +127,118 @@ public:
      */
     void setPar(const char* par) final;
 
+    /**
+     * Push the display content to all subscribers, whose period elapsed.
+     * Call this periodically, but not in the websocket context.
+     *
+     * @param[in] server    Websocket server
+     */
+    void process(AsyncWebSocket& server);
+
+    /**
+     * Remove the subscription of a client, e.g. because it disconnected.
+     *
+     * @param[in] clientId  Websocket client id
+     */
+    void unsubscribe(uint32_t clientId);
+
 private:
 
-    bool    m_isError;  /**< Any error happened during parameter reception? */
+    /**
+     * Response modes.
+     */
+    enum Mode
+    {
+        MODE_TEXT = 0,  /**< Display content once as text */
+        MODE_BINARY,    /**< Display content once as binary frame */
+        MODE_SUBSCRIBE  /**< Subscribe to periodic binary frames */
+    };
+
+    /**
+     * Subscriber of the display content.
+     */
+    struct Subscriber
+    {
+        bool        isUsed;         /**< Is the subscriber entry in use? */
+        uint32_t    clientId;       /**< Websocket client id */
+        SimpleTimer timer;          /**< Timer used for the period */
+        uint32_t    period;         /**< Period in ms */
+        uint32_t*   refFrame;       /**< Last frame, which was sent to the client */
+        bool        isRefValid;     /**< Is the last frame valid? */
+
+        /**
+         * Constructs an unused subscriber entry.
+         */
+        Subscriber() :
+            isUsed(false),
+            clientId(0U),
+            timer(),
+            period(0U),
+            refFrame(nullptr),
+            isRefValid(false)
+        {
+        }
+    };
+
+    bool            m_isError;                          /**< Any error happened during parameter reception? */
+    uint8_t         m_cnt;                              /**< Number of received parameters */
+    Mode            m_mode;                             /**< Requested response mode */
+    uint32_t        m_period;                           /**< Requested subscription period in ms */
+    MutexRecursive  m_mutex;                            /**< Mutex to protect against concurrent access. */
+    Subscriber      m_subscribers[MAX_SUBSCRIBERS];     /**< Subscribers */
+    uint32_t*       m_frame;                            /**< Framebuffer copy, used for the responses */
+    size_t          m_frameLength;                      /**< Framebuffer copy length in pixels */
+    uint8_t*        m_txBuffer;                         /**< Binary frame buffer */
+    size_t          m_txBufferSize;                     /**< Binary frame buffer size in bytes */
 
     WsCmdGetDisp(const WsCmdGetDisp& cmd);
     WsCmdGetDisp& operator=(const WsCmdGetDisp& cmd);
+
+    /**
+     * Allocate the framebuffer copy and the binary frame buffer.
+     * They are allocated once and kept to avoid heap fragmentation.
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool allocBuffers();
+
+    /**
+     * Release the framebuffer copy and the binary frame buffer.
+     */
+    void releaseBuffers();
+
+    /**
+     * Subscribe a client or update its period.
+     *
+     * @param[in] clientId  Websocket client id
+     * @param[in] period    Period in ms
+     *
+     * @return If successful, it will return true otherwise false.
+     */
+    bool subscribe(uint32_t clientId, uint32_t period);
+
+    /**
+     * Release the resources of a subscriber entry and mark it unused.
+     *
+     * @param[in] subscriber    Subscriber entry
+     */
+    void releaseSubscriber(Subscriber& subscriber);
+
+    /**
+     * Send the display content as text response.
+     *
+     * @param[in] server    Websocket server
+     * @param[in] client    Websocket client
+     */
+    void sendText(AsyncWebSocket* server, AsyncWebSocketClient* client);
+
+    /**
+     * Send the display content as binary full frame.
+     *
+     * @param[in] server    Websocket server
+     * @param[in] client    Websocket client
+     */
+    void sendBinary(AsyncWebSocket* server, AsyncWebSocketClient* client);
 };
 
 /******************************************************************************
@@ -0,0 +1,170 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Websocket command to read/write many plugin topics
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "WsCmdTopics.h"
+#include "PluginMgr.h"
+
+#include <Logging.h>
+#include <ArduinoJson.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+void WsCmdTopics::execute(AsyncWebSocket* server, AsyncWebSocketClient* client)
+{
+    if ((nullptr == server) ||
+        (nullptr == client))
+    {
+        return;
+    }
+
+    /* Any error happended? */
+    if ((true == m_isError) ||
+        (0U == m_parCnt))
+    {
+        server->text(client->id(), "NACK;\"Parameter invalid.\"");
+    }
+    else
+    {
+        const size_t            JSON_DOC_OPS_SIZE       = 4096U;
+        const size_t            JSON_DOC_RESULT_SIZE    = 1024U;
+        DynamicJsonDocument     jsonDocOps(JSON_DOC_OPS_SIZE);
+        DeserializationError    error                   = deserializeJson(jsonDocOps, m_operations);
+
+        if ((DeserializationError::Ok != error) ||
+            (false == jsonDocOps.is<JsonArray>()))
+        {
+            server->text(client->id(), "NACK;\"Invalid operations.\"");
+        }
+        else
+        {
+            String              rsp         = "ACK";
+            const char          DELIMITER   = ';';
+            DynamicJsonDocument jsonDocResult(JSON_DOC_RESULT_SIZE);
+            bool                isFirst     = true;
+
+            rsp += DELIMITER;
+            rsp += '[';
+
+            for(JsonVariant operation : jsonDocOps.as<JsonArray>())
+            {
+                String result;
+
+                jsonDocResult.clear();
+                (void)PluginMgr::getInstance().processTopicOperation(operation.as<JsonObject>(), jsonDocResult.to<JsonObject>());
+
+                if (false == isFirst)
+                {
+                    rsp += ',';
+                }
+
+                (void)serializeJson(jsonDocResult, result);
+                rsp += result;
+                isFirst = false;
+            }
+
+            rsp += ']';
+
+            server->text(client->id(), rsp);
+        }
+    }
+
+    m_isError = false;
+    m_parCnt = 0U;
+    m_operations.clear();
+
+    return;
+}
+
+void WsCmdTopics::setPar(const char* par)
+{
+    /* The JSON array may contain the parameter delimiter, therefore all
+     * parameters are joined again.
+     */
+    if (0U < m_parCnt)
+    {
+        m_operations += ';';
+    }
+
+    m_operations += par;
+
+    if (MAX_OPERATIONS_SIZE < m_operations.length())
+    {
+        m_isError = true;
+        m_operations.clear();
+    }
+
+    if (UINT8_MAX > m_parCnt)
+    {
+        ++m_parCnt;
+    }
+
+    return;
+}
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
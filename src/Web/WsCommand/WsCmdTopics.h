@@ -25,7 +25,7 @@
     DESCRIPTION
 *******************************************************************************/
 /**
- * @brief  HTTP header
+ * @brief  Websocket command to read/write many plugin topics
  * @author Andreas Merkle <web@blue-andi.de>
  *
  * @addtogroup web
@@ -33,8 +33,8 @@
  * @{
  */
 
-#ifndef __HTTP_HEADER_H__
-#define __HTTP_HEADER_H__
+#ifndef __WSCMDTOPICS_H__
+#define __WSCMDTOPICS_H__
 
 /******************************************************************************
  * Compile Switches
@@ -43,7 +43,7 @@
 /******************************************************************************
  * Includes
  *****************************************************************************/
-#include <WString.h>
+#include "WsCmd.h"
 
 /******************************************************************************
  * Macros
@@ -52,127 +52,66 @@
 /******************************************************************************
  * Types and Classes
  *****************************************************************************/
-
 /**
- * Request/Response http header
+ * Websocket command to read/write many plugin topics at once.
+ * The parameter is a JSON array of topic operations, see
+ * PluginMgr::processTopicOperation(). The response contains the JSON
+ * array of results in the same order.
  */
-class HttpHeader
+class WsCmdTopics: public WsCmd
 {
 public:
 
     /**
-     * Constructs a empty header.
-     */
-    HttpHeader() :
-        m_name(),
-        m_value()
-    {
-    }
-
-    /**
-     * Constructs header, based on the given values.
-     *
-     * @param[in] name  Field name
-     * @param[in] value Field value
-     */
-    HttpHeader(const String& name, const String& value) :
-        m_name(name),
-        m_value(value)
-    {
-    }
-
-    /**
-     * Constructs a header, based on a single header line.
-     *
-     * @param[in] line  Header line, which contains name and value.
-     */
-    HttpHeader(const String& line) :
-        m_name(),
-        m_value()
-    {
-        parse(line);
-    }
-
-    /**
-     * Destroys the header.
-     */
-    ~HttpHeader()
-    {
-    }
-
-    /**
-     * Get field name.
-     *
-     * @return Field name
+     * Constructs the websocket command.
      */
-    const String& getName() const
+    WsCmdTopics() :
+        WsCmd("TOPICS"),
+        m_isError(false),
+        m_parCnt(0U),
+        m_operations()
     {
-        return m_name;
     }
 
     /**
-     * Get field value.
-     *
-     * @return Field value
+     * Destroys websocket command.
      */
-    const String& getValue() const
+    ~WsCmdTopics()
     {
-        return m_value;
     }
 
     /**
-     * Set field name.
+     * Execute command.
      *
-     * @param[in] name  Field name
+     * @param[in] server    Websocket server
+     * @param[in] client    Websocket client
      */
-    void setName(const String& name)
-    {
-        m_name = name;
-    }
+    void execute(AsyncWebSocket* server, AsyncWebSocketClient* client) final;
 
     /**
-     * Set field value.
+     * Set command parameter. Call this for each parameter, until executing it.
      *
-     * @param[in] value Field value
+     * @param[in] par   Parameter string
      */
-    void setValue(const String& value)
-    {
-        m_value = value;
-    }
+    void setPar(const char* par) final;
 
-    /**
-     * Assign a header.
-     *
-     * @param[in] hdr   Header, which to assign.
-     *
-     * @return Header
-     */
-    HttpHeader& operator=(const HttpHeader& hdr);
-
-    /**
-     * Parse "<name>: <value>" string.
-     *
-     * @param[in] line  String line
-     */
-    void parse(const String& line);
+private:
 
-    /**
-     * Get header as single line.
-     *
-     * @return Header
-     */
-    String toString() const;
+    /** Max. size of the operations in byte. */
+    static const size_t MAX_OPERATIONS_SIZE = 4096U;
 
-private:
+    bool        m_isError;      /**< Any error happened during parameter reception? */
+    uint8_t     m_parCnt;       /**< Received number of parameters */
+    String      m_operations;   /**< Topic operations as JSON array */
 
-    String  m_name;     /**< Header field name */
-    String  m_value;    /**< Header field value */
+    WsCmdTopics(const WsCmdTopics& cmd);
+    WsCmdTopics& operator=(const WsCmdTopics& cmd);
 };
 
 /******************************************************************************
  * Functions
  *****************************************************************************/
 
-#endif  /* __HTTP_HEADER_H__ */
+#endif  /* __WSCMDTOPICS_H__ */
 
 /** @} */
\ No newline at end of file
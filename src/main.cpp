@@ -42,6 +42,7 @@
 #include "InitState.h"
 #include "TaskMon.h"
 #include "MemMon.h"
+#include "PluginMgr.h"
 
 /******************************************************************************
  * Macros
@@ -133,6 +134,9 @@ void loop()
     /* Memory monitor */
     MemMon::getInstance().process();
 
+    /* Start plugins in the background, whose start was deferred. */
+    PluginMgr::getInstance().process();
+
     /* Schedule other tasks with same or lower priority. */
     delay(LOOP_TASK_PERIOD);
 
@@ -36,6 +36,8 @@
 #include "TestGfx.h"
 
 #include <unity.h>
+#include <stdio.h>
+#include <Arduino.h>
 #include <FS.h>
 #include <BmpImgLoader.h>
 #include <YAGfxBitmap.h>
@@ -55,10 +57,16 @@
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
+static void checkTestImage(BmpImgLoader& loader, FS& fs, const char* fileName);
+static uint32_t measureLoadTime(BmpImgLoader& loader, FS& fs, const char* fileName, uint32_t loads);
+static bool createBenchmarkImage(const char* fileName, uint16_t width, uint16_t height);
+static void benchmarkBmpImgLoader();
 
 /******************************************************************************
  * Local Variables
  *****************************************************************************/
+/** Temporary image, which is used for the benchmark. */
+static const char*  BENCHMARK_IMAGE = "./test/benchmark.bmp";
 
 /******************************************************************************
  * Public Methods
@@ -85,43 +93,186 @@ extern void testBmpImgLoader()
     YAGfxDynamicBitmap  bitmap;
     FS                  localFileSystem;
 
-    /* Load test image:
+    /* All test images have the same content, only the format is different:
      * 2x2 pixels
      * (0, 0) blue
      * (1, 0) green
      * (0, 1) red
      * (1, 1) white
-     * 24 bpp, no compression
-     * No color palette
      */
-    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test24bpp.bmp", bitmap));
-    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
-    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
-    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
-    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
-    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
-    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
 
-    /* Load test image:
-     * 2x2 pixels
-     * (0, 0) blue
-     * (1, 0) green
-     * (0, 1) red
-     * (1, 1) white
-     * 32 bpp, bitfield (not supported)
-     * No color palette
-     */
-    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED, loader.load(localFileSystem, "./test/test32bpp.bmp", bitmap));
+    /* 24 bpp, no compression, no color palette */
+    checkTestImage(loader, localFileSystem, "./test/test24bpp.bmp");
+
+    /* 32 bpp, bitfields in a v3 header, no color palette */
+    checkTestImage(loader, localFileSystem, "./test/test32bpp.bmp");
+
+    /* 16 bpp, RGB565 bitfields, no color palette */
+    checkTestImage(loader, localFileSystem, "./test/test16bpp.bmp");
+
+    /* 8 bpp, RLE8 compression, color palette */
+    checkTestImage(loader, localFileSystem, "./test/test8bppRle.bmp");
+
+    /* Not a bitmap file */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_FORMAT_UNSUPPORTED, loader.load(localFileSystem, "./test/README", bitmap));
     TEST_ASSERT_FALSE(bitmap.isAllocated());
     TEST_ASSERT_EQUAL_UINT16(0, bitmap.getWidth());
     TEST_ASSERT_EQUAL_UINT16(0, bitmap.getHeight());
 
+    /* File not found */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_NOT_FOUND, loader.load(localFileSystem, "./test/notExisting.bmp", bitmap));
+    TEST_ASSERT_FALSE(bitmap.isAllocated());
+
     /* Load valid bitmap file. */
     TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, "./test/test24bpp.bmp", bitmap));
 
+    benchmarkBmpImgLoader();
+
     return;
 }
 
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Load a 2x2 test image and check its content.
+ *
+ * @param[in] loader    Bitmap image loader
+ * @param[in] fs        File system
+ * @param[in] fileName  Name of the test image
+ */
+static void checkTestImage(BmpImgLoader& loader, FS& fs, const char* fileName)
+{
+    YAGfxDynamicBitmap bitmap;
+
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(fs, fileName, bitmap));
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2, bitmap.getHeight());
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00, bitmap.getColor(1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0xff0000, bitmap.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(0xffffff, bitmap.getColor(1, 1));
+}
+
+/**
+ * Measure the time to load a bitmap image several times.
+ *
+ * @param[in] loader    Bitmap image loader
+ * @param[in] fs        File system
+ * @param[in] fileName  Name of the image
+ * @param[in] loads     Number of loads
+ *
+ * @return Duration in ms
+ */
+static uint32_t measureLoadTime(BmpImgLoader& loader, FS& fs, const char* fileName, uint32_t loads)
+{
+    YAGfxDynamicBitmap  bitmap;
+    uint32_t            idx         = 0U;
+    uint32_t            timestamp   = millis();
+
+    for(idx = 0U; idx < loads; ++idx)
+    {
+        TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(fs, fileName, bitmap));
+    }
+
+    return millis() - timestamp;
+}
+
+/**
+ * Create a uncompressed 24 bpp bottom-up bitmap image with a color gradient.
+ *
+ * @param[in] fileName  Name of the image
+ * @param[in] width     Image width in pixels
+ * @param[in] height    Image height in pixels
+ *
+ * @return If successful, it will return true otherwise false.
+ */
+static bool createBenchmarkImage(const char* fileName, uint16_t width, uint16_t height)
+{
+    bool        isSuccessful    = false;
+    FILE*       fd              = fopen(fileName, "wb");
+    uint32_t    rowSize         = (24U * width + 31U) / 32U * 4U;
+    uint32_t    offset          = 14U + 40U;
+    uint32_t    fileSize        = offset + rowSize * height;
+
+    if (nullptr != fd)
+    {
+        uint8_t     header[14U + 40U]   = { 0 };
+        uint8_t*    row                 = new uint8_t[rowSize];
+        uint16_t    x                   = 0U;
+        uint16_t    y                   = 0U;
+
+        /* Bitmap file header */
+        header[0U]  = 'B';
+        header[1U]  = 'M';
+        header[2U]  = static_cast<uint8_t>(fileSize >> 0U);
+        header[3U]  = static_cast<uint8_t>(fileSize >> 8U);
+        header[4U]  = static_cast<uint8_t>(fileSize >> 16U);
+        header[10U] = static_cast<uint8_t>(offset);
+
+        /* BITMAPINFOHEADER */
+        header[14U] = 40U;
+        header[18U] = static_cast<uint8_t>(width >> 0U);
+        header[19U] = static_cast<uint8_t>(width >> 8U);
+        header[22U] = static_cast<uint8_t>(height >> 0U);
+        header[23U] = static_cast<uint8_t>(height >> 8U);
+        header[26U] = 1U;   /* Planes */
+        header[28U] = 24U;  /* Bits per pixel */
+
+        isSuccessful = (sizeof(header) == fwrite(header, 1U, sizeof(header), fd));
+
+        for(y = 0U; (y < height) && (true == isSuccessful); ++y)
+        {
+            memset(row, 0, rowSize);
+
+            for(x = 0U; x < width; ++x)
+            {
+                row[x * 3U + 0U] = static_cast<uint8_t>(x);
+                row[x * 3U + 1U] = static_cast<uint8_t>(y);
+                row[x * 3U + 2U] = static_cast<uint8_t>(x + y);
+            }
+
+            isSuccessful = (rowSize == fwrite(row, 1U, rowSize, fd));
+        }
+
+        delete[] row;
+        fclose(fd);
+    }
+
+    return isSuccessful;
+}
+
+/**
+ * Benchmark the bitmap image loader with the test images and a larger
+ * icon, which is typical for the large LED matrix.
+ */
+static void benchmarkBmpImgLoader()
+{
+    BmpImgLoader        loader;
+    FS                  localFileSystem;
+    YAGfxDynamicBitmap  bitmap;
+    const uint32_t      SMALL_LOADS = 2000U;
+    const uint32_t      LARGE_LOADS = 200U;
+    const uint16_t      LARGE_SIZE  = 64U;
+    uint32_t            duration    = 0U;
+
+    duration = measureLoadTime(loader, localFileSystem, "./test/test24bpp.bmp", SMALL_LOADS);
+    printf("test24bpp.bmp: %u loads in %u ms\n", SMALL_LOADS, duration);
+
+    duration = measureLoadTime(loader, localFileSystem, "./test/test32bpp.bmp", SMALL_LOADS);
+    printf("test32bpp.bmp: %u loads in %u ms\n", SMALL_LOADS, duration);
+
+    TEST_ASSERT_TRUE(createBenchmarkImage(BENCHMARK_IMAGE, LARGE_SIZE, LARGE_SIZE));
+
+    duration = measureLoadTime(loader, localFileSystem, BENCHMARK_IMAGE, LARGE_LOADS);
+    printf("%ux%u 24 bpp: %u loads in %u ms\n", LARGE_SIZE, LARGE_SIZE, LARGE_LOADS, duration);
+
+    /* Check the gradient. */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, loader.load(localFileSystem, BENCHMARK_IMAGE, bitmap));
+    TEST_ASSERT_EQUAL_UINT32(0x000000, bitmap.getColor(0, LARGE_SIZE - 1));
+    TEST_ASSERT_EQUAL_UINT32(0x020002, bitmap.getColor(2, LARGE_SIZE - 1));
+    TEST_ASSERT_EQUAL_UINT32(0x7e3f3f, bitmap.getColor(LARGE_SIZE - 1, 0));
+
+    (void)remove(BENCHMARK_IMAGE);
+}
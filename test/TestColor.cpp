@@ -52,6 +52,7 @@
 /******************************************************************************
  * Prototypes
  *****************************************************************************/
+static void testPackedColor();
 
 /******************************************************************************
  * Local Variables
@@ -133,6 +134,8 @@ extern void testColor()
     TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getGreen());
     TEST_ASSERT_EQUAL_UINT8(0x96u, myColorA.getBlue());
 
+#if (0 == CONFIG_YAGFX_PACKED_COLOR)
+
     /* Dim a color by 0%, which means no change.
      * And additional check non-destructive base colors.
      */
@@ -141,9 +144,68 @@ extern void testColor()
     TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getGreen());
     TEST_ASSERT_EQUAL_UINT8(0xc8u, myColorA.getBlue());
 
+#endif  /* (0 == CONFIG_YAGFX_PACKED_COLOR) */
+
+    testPackedColor();
+
     return;
 }
 
 /******************************************************************************
  * Local Functions
  *****************************************************************************/
+
+/**
+ * Test the packed and premultiplied color.
+ */
+static void testPackedColor()
+{
+    Rgb888Packed    colorA;
+    Rgb888Packed    colorB(0x12U, 0x34U, 0x56U);
+    Rgb888Packed    colorC(0xc8U, 0xc8U, 0xc8U, 192U);
+
+    /* Default color is black with max. intensity. */
+    TEST_ASSERT_EQUAL_UINT32(0u, colorA);
+    TEST_ASSERT_EQUAL_UINT8(Rgb888Packed::MAX_BRIGHT, colorA.getIntensity());
+
+    /* The intensity is not part of the RGB24 value. */
+    TEST_ASSERT_EQUAL_UINT32(0x00123456u, colorB);
+    TEST_ASSERT_EQUAL_UINT16(0x11aau, colorB.to565());
+
+    /* Base colors are stored premultiplied. */
+    TEST_ASSERT_EQUAL_UINT32(0x00969696u, colorC);
+    TEST_ASSERT_EQUAL_UINT8(192U, colorC.getIntensity());
+
+    /* Set a single base color with respect to the current intensity. */
+    colorC.setGreen(0xc8U);
+    TEST_ASSERT_EQUAL_UINT32(0x00969696u, colorC);
+
+    /* Changing the intensity scales the premultiplied base colors. */
+    colorB.setIntensity(128U);
+    TEST_ASSERT_EQUAL_UINT8(0x09u, colorB.getRed());
+    TEST_ASSERT_EQUAL_UINT8(0x1au, colorB.getGreen());
+    TEST_ASSERT_EQUAL_UINT8(0x2bu, colorB.getBlue());
+
+    /* Once black, always black. */
+    colorB.setIntensity(0U);
+    colorB.setIntensity(255U);
+    TEST_ASSERT_EQUAL_UINT32(0u, colorB);
+
+    /* Setting the color doesn't change the intensity. */
+    colorA.setIntensity(0U);
+    colorA.set(0x00ffffffU);
+    TEST_ASSERT_EQUAL_UINT32(0u, colorA);
+    colorA.set(0xffU, 0xffU, 0xffU, 0xffU);
+    TEST_ASSERT_EQUAL_UINT32(0x00ffffffu, colorA);
+
+    /* Same color wheel as the non-packed color. */
+    {
+        Rgb888 reference;
+
+        reference.turnColorWheel(100U);
+        colorA.turnColorWheel(100U);
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(reference), colorA);
+    }
+
+    return;
+}
@@ -0,0 +1,339 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Fade effect blend kernel tests and benchmark
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestFadeBlend.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <Arduino.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+#include <FadeBlend.h>
+#include <FadeLinear.h>
+#include <FadeMoveX.h>
+#include <FadeCross.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void fillRandom(YAGfxBitmap& bitmap);
+static bool isEqual(const YAGfxBitmap& bitmap1, const YAGfxBitmap& bitmap2);
+static void testKernel();
+static void testEffects();
+static void benchmarkCanvas(uint16_t width, uint16_t height);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Number of pixels, which shall be blended per measurement to get a stable result. */
+static const uint32_t   PIXELS_PER_MEASUREMENT  = 4UL * 1024UL * 1024UL;
+
+/** Canvas width in pixels */
+static const uint16_t   WIDTH                   = 32U;
+
+/** Canvas height in pixels */
+static const uint16_t   HEIGHT                  = 8U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the fade effect blend kernel and benchmark it.
+ */
+extern void testFadeBlend()
+{
+    testKernel();
+    testEffects();
+
+    /* LED matrix */
+    benchmarkCanvas(32U, 8U);
+
+    /* Large LED matrix */
+    benchmarkCanvas(64U, 64U);
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Fill bitmap with random colors.
+ *
+ * @param[in] bitmap    Bitmap
+ */
+static void fillRandom(YAGfxBitmap& bitmap)
+{
+    int16_t x = 0;
+    int16_t y = 0;
+
+    for(y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for(x = 0; x < bitmap.getWidth(); ++x)
+        {
+            bitmap.drawPixel(x, y, static_cast<uint32_t>(rand()) & 0x00ffffffU);
+        }
+    }
+}
+
+/**
+ * Compare two bitmaps pixel by pixel.
+ *
+ * @param[in] bitmap1   Bitmap 1
+ * @param[in] bitmap2   Bitmap 2
+ *
+ * @return If both contain the same colors, it will return true otherwise false.
+ */
+static bool isEqual(const YAGfxBitmap& bitmap1, const YAGfxBitmap& bitmap2)
+{
+    bool    isEqual = true;
+    int16_t x       = 0;
+    int16_t y       = 0;
+
+    for(y = 0; y < bitmap1.getHeight(); ++y)
+    {
+        for(x = 0; x < bitmap1.getWidth(); ++x)
+        {
+            if (static_cast<uint32_t>(bitmap1.getColor(x, y)) != static_cast<uint32_t>(bitmap2.getColor(x, y)))
+            {
+                isEqual = false;
+            }
+        }
+    }
+
+    return isEqual;
+}
+
+/**
+ * Test the packed blend kernel.
+ */
+static void testKernel()
+{
+    Color   prev[3U]    = { 0x00ff00ffU, 0x00123456U, 0x00ffffffU };
+    Color   next[3U]    = { 0x0000ff00U, 0x00654321U, 0x00000000U };
+    Color   dst[3U];
+
+    /* The color channels shall not influence each other. */
+    TEST_ASSERT_EQUAL_UINT32(0x007f7f7fU, FadeBlend::blendPacked(0x00ff00ffU, 0x0000ff00U, 128U));
+    TEST_ASSERT_EQUAL_UINT32(0x00ff00ffU, FadeBlend::blendPacked(0x00ff00ffU, 0x0000ff00U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(0x0000ff00U, FadeBlend::blendPacked(0x00ff00ffU, 0x0000ff00U, 256U));
+    TEST_ASSERT_EQUAL_UINT32(0x00ffffffU, FadeBlend::blendPacked(0x00ffffffU, 0x00ffffffU, 77U));
+
+    /* Max. alpha leads to the next colors. */
+    FadeBlend::blendSpan(dst, prev, next, 3U, FadeBlend::ALPHA_NEXT);
+    TEST_ASSERT_EQUAL_UINT32(next[0], dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(next[1], dst[1]);
+    TEST_ASSERT_EQUAL_UINT32(next[2], dst[2]);
+
+    /* Min. alpha leads to the previous colors. */
+    FadeBlend::blendSpan(dst, prev, next, 3U, FadeBlend::ALPHA_PREV);
+    TEST_ASSERT_EQUAL_UINT32(prev[0], dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(prev[1], dst[1]);
+    TEST_ASSERT_EQUAL_UINT32(prev[2], dst[2]);
+
+    /* No source means black. Alpha 128 is mapped to 129/256. */
+    FadeBlend::blendSpan(dst, nullptr, next, 3U, 128U);
+    TEST_ASSERT_EQUAL_UINT32(0x00008000U, dst[0]);
+    TEST_ASSERT_EQUAL_UINT32(0x00000000U, dst[2]);
+
+    /* The color intensity of the source shall be considered. */
+    prev[0].setIntensity(0U);
+    FadeBlend::blendSpan(dst, prev, next, 1U, FadeBlend::ALPHA_PREV);
+    TEST_ASSERT_EQUAL_UINT32(0U, dst[0]);
+}
+
+/**
+ * Test the fade effects, which are based on the blend kernel.
+ */
+static void testEffects()
+{
+    YAGfxDynamicBitmap  prev(WIDTH, HEIGHT);
+    YAGfxDynamicBitmap  next(WIDTH, HEIGHT);
+    YAGfxDynamicBitmap  prevCopy(WIDTH, HEIGHT);
+    YAGfxDynamicBitmap  nextCopy(WIDTH, HEIGHT);
+    YAGfxDynamicBitmap  dst(WIDTH, HEIGHT);
+    FadeLinear          fadeLinear;
+    FadeMoveX           fadeMoveX;
+    FadeCross           fadeCross;
+    const uint32_t      CHECK_STEP  = 25U;
+    uint32_t            steps       = 0U;
+    int16_t             y           = 0;
+
+    fillRandom(prev);
+    fillRandom(next);
+    prevCopy = prev;
+    nextCopy = next;
+
+    /* Linear fade out ends in black, fade in ends in the next content. */
+    fadeLinear.init();
+    while(false == fadeLinear.fadeOut(dst, prev, next))
+    {
+        ++steps;
+    }
+    TEST_ASSERT_EQUAL_UINT32(Color::MAX_BRIGHT / FadeLinear::FADING_STEP - 1U, steps);
+    TEST_ASSERT_EQUAL_UINT32(0U, dst.getColor(0, 0));
+
+    while(false == fadeLinear.fadeIn(dst, prev, next))
+    {
+        ;
+    }
+    TEST_ASSERT_TRUE(isEqual(next, dst));
+
+    /* Half way the cross fade shows both contents at the same time. */
+    fadeCross.init();
+    steps = 0U;
+    while(false == fadeCross.fadeOut(dst, prev, next))
+    {
+        if (CHECK_STEP == steps)
+        {
+            uint32_t expected = FadeBlend::blendPacked(prev.getColor(1, 1), next.getColor(1, 1), CHECK_STEP * FadeCross::FADING_STEP);
+
+            TEST_ASSERT_EQUAL_UINT32(expected, dst.getColor(1, 1));
+        }
+
+        ++steps;
+    }
+    TEST_ASSERT_TRUE(isEqual(next, dst));
+    TEST_ASSERT_TRUE(fadeCross.fadeIn(dst, prev, next));
+    TEST_ASSERT_TRUE(isEqual(next, dst));
+
+    /* After the first move, the previous content is shifted by one pixel
+     * and the first column of the next content appears on the right side.
+     */
+    fadeMoveX.init();
+    (void)fadeMoveX.fadeOut(dst, prev, next);
+    (void)fadeMoveX.fadeOut(dst, prev, next);
+    for(y = 0; y < HEIGHT; ++y)
+    {
+        TEST_ASSERT_EQUAL_UINT32(prev.getColor(1, y), dst.getColor(0, y));
+        TEST_ASSERT_EQUAL_UINT32(next.getColor(0, y), dst.getColor(WIDTH - 1, y));
+    }
+
+    /* The framebuffers shall never be touched by a fade effect. */
+    TEST_ASSERT_TRUE(isEqual(prevCopy, prev));
+    TEST_ASSERT_TRUE(isEqual(nextCopy, next));
+    TEST_ASSERT_EQUAL_UINT8(Color::MAX_BRIGHT, prev.getColor(0, 0).getIntensity());
+}
+
+/**
+ * Benchmark a canvas with the given size. The former way of dimming the
+ * source bitmap via color intensity and copying it afterwards, is compared
+ * with the blend kernel.
+ *
+ * @param[in] width     Canvas width in pixels
+ * @param[in] height    Canvas height in pixels
+ */
+static void benchmarkCanvas(uint16_t width, uint16_t height)
+{
+    const uint32_t      FRAMES          = PIXELS_PER_MEASUREMENT / (width * height);
+    YAGfxDynamicBitmap  prev(width, height);
+    YAGfxDynamicBitmap  next(width, height);
+    YAGfxDynamicBitmap  dst(width, height);
+    uint32_t            frame           = 0U;
+    unsigned long       timestamp       = 0U;
+    uint32_t            intensityTime   = 0U;
+    uint32_t            dimTime         = 0U;
+    uint32_t            blendTime       = 0U;
+
+    fillRandom(prev);
+    fillRandom(next);
+
+    /* Dim the source bitmap itself and copy it. */
+    timestamp = millis();
+    for(frame = 0U; frame < FRAMES; ++frame)
+    {
+        uint8_t intensity   = static_cast<uint8_t>(frame);
+        int16_t x           = 0;
+        int16_t y           = 0;
+
+        for(y = 0; y < height; ++y)
+        {
+            for(x = 0; x < width; ++x)
+            {
+                prev.getColor(x, y).setIntensity(intensity);
+            }
+        }
+
+        dst.copy(prev);
+    }
+    intensityTime = static_cast<uint32_t>((static_cast<uint64_t>(millis() - timestamp) * 1000000ULL) / FRAMES);
+
+    /* Dim with the blend kernel. */
+    timestamp = millis();
+    for(frame = 0U; frame < FRAMES; ++frame)
+    {
+        FadeBlend::dim(dst, next, static_cast<uint8_t>(frame));
+    }
+    dimTime = static_cast<uint32_t>((static_cast<uint64_t>(millis() - timestamp) * 1000000ULL) / FRAMES);
+
+    /* Cross fade with the blend kernel. */
+    timestamp = millis();
+    for(frame = 0U; frame < FRAMES; ++frame)
+    {
+        FadeBlend::blend(dst, prev, next, static_cast<uint8_t>(frame));
+    }
+    blendTime = static_cast<uint32_t>((static_cast<uint64_t>(millis() - timestamp) * 1000000ULL) / FRAMES);
+
+    printf("fade %ux%u: setIntensity+copy %u ns/frame, dim %u ns/frame, cross %u ns/frame (%u frames)\n",
+        width,
+        height,
+        intensityTime,
+        dimTime,
+        blendTime,
+        FRAMES);
+}
\ No newline at end of file
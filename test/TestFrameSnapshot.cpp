@@ -0,0 +1,325 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Lock-free frame snapshot tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestFrameSnapshot.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <thread>
+#include <atomic>
+#include <Arduino.h>
+#include <FrameSnapshot.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/**
+ * Result of a single reader in the stress test.
+ */
+struct ReaderResult
+{
+    uint32_t    reads;          /**< Number of successful reads */
+    uint32_t    tornFrames;     /**< Number of frames, which contain pixels of different frames */
+    uint32_t    outOfOrder;     /**< Number of frames, which are older than the previous read one */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testBasics();
+static void testStress();
+static uint32_t writerTask(FrameSnapshot* snapshot, uint32_t duration, std::atomic<uint32_t>* dropped, std::atomic<bool>* isDone);
+static void readerTask(FrameSnapshot* snapshot, std::atomic<uint8_t>* started, std::atomic<bool>* isDone, ReaderResult* result);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Frame length in pixels (32 x 8 LED matrix) */
+static const size_t     FRAME_LENGTH    = 32U * 8U;
+
+/** Stress test duration in ms. */
+static const uint32_t   STRESS_DURATION = 500U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the lock-free frame snapshot, incl. a stress test with concurrent readers.
+ */
+extern void testFrameSnapshot()
+{
+    testBasics();
+    testStress();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the single threaded behaviour.
+ */
+static void testBasics()
+{
+    FrameSnapshot   snapshot;
+    uint32_t        frame[FRAME_LENGTH];
+    uint32_t        info        = 0U;
+    uint32_t*       pixels      = nullptr;
+    size_t          idx         = 0U;
+
+    /* Not created yet */
+    TEST_ASSERT_NULL(snapshot.beginWrite());
+    TEST_ASSERT_FALSE(snapshot.read(frame, FRAME_LENGTH, info));
+    TEST_ASSERT_FALSE(snapshot.create(0U));
+
+    TEST_ASSERT_TRUE(snapshot.create(FRAME_LENGTH));
+    TEST_ASSERT_EQUAL(FRAME_LENGTH, snapshot.getLength());
+
+    /* Nothing published yet */
+    TEST_ASSERT_FALSE(snapshot.read(frame, FRAME_LENGTH, info));
+
+    /* A frame, which is written but not published, is not visible. */
+    pixels = snapshot.beginWrite();
+    TEST_ASSERT_NOT_NULL(pixels);
+
+    for(idx = 0U; idx < FRAME_LENGTH; ++idx)
+    {
+        pixels[idx] = idx;
+    }
+
+    TEST_ASSERT_FALSE(snapshot.read(frame, FRAME_LENGTH, info));
+
+    snapshot.endWrite(7U);
+    TEST_ASSERT_TRUE(snapshot.read(frame, FRAME_LENGTH, info));
+    TEST_ASSERT_EQUAL_UINT32(7U, info);
+
+    for(idx = 0U; idx < FRAME_LENGTH; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(idx, frame[idx]);
+    }
+
+    /* The writer never gets the published buffer. */
+    pixels = snapshot.beginWrite();
+    TEST_ASSERT_NOT_NULL(pixels);
+
+    for(idx = 0U; idx < FRAME_LENGTH; ++idx)
+    {
+        pixels[idx] = idx;
+    }
+
+    pixels[0] = 0xffU;
+    TEST_ASSERT_TRUE(snapshot.read(frame, FRAME_LENGTH, info));
+    TEST_ASSERT_EQUAL_UINT32(0U, frame[0]);
+    snapshot.endWrite(8U);
+
+    /* A smaller destination gets the first pixels only. */
+    frame[1] = 0U;
+    frame[2] = 0U;
+    TEST_ASSERT_TRUE(snapshot.read(frame, 2U, info));
+    TEST_ASSERT_EQUAL_UINT32(8U, info);
+    TEST_ASSERT_EQUAL_UINT32(0xffU, frame[0]);
+    TEST_ASSERT_EQUAL_UINT32(1U, frame[1]);
+    TEST_ASSERT_EQUAL_UINT32(0U, frame[2]);
+
+    snapshot.destroy();
+    TEST_ASSERT_EQUAL(0U, snapshot.getLength());
+    TEST_ASSERT_FALSE(snapshot.read(frame, FRAME_LENGTH, info));
+
+    return;
+}
+
+/**
+ * Stress test with a single writer and the max. number of concurrent readers.
+ * Every frame is filled with its frame number, so a reader can detect
+ * torn frames.
+ */
+static void testStress()
+{
+    FrameSnapshot           snapshot;
+    std::atomic<uint32_t>   dropped(0U);
+    std::atomic<bool>       isDone(false);
+    std::atomic<uint8_t>    started(0U);
+    ReaderResult            results[FrameSnapshot::MAX_READERS];
+    std::thread*            readers[FrameSnapshot::MAX_READERS];
+    uint8_t                 idx         = 0U;
+    uint32_t                totalReads  = 0U;
+    uint32_t                frames      = 0U;
+
+    TEST_ASSERT_TRUE(snapshot.create(FRAME_LENGTH));
+
+    for(idx = 0U; idx < FrameSnapshot::MAX_READERS; ++idx)
+    {
+        results[idx].reads      = 0U;
+        results[idx].tornFrames = 0U;
+        results[idx].outOfOrder = 0U;
+
+        readers[idx] = new std::thread(readerTask, &snapshot, &started, &isDone, &results[idx]);
+    }
+
+    /* Wait until all readers are running, otherwise the writer may be finished before. */
+    while(FrameSnapshot::MAX_READERS > started.load())
+    {
+        std::this_thread::yield();
+    }
+
+    frames = writerTask(&snapshot, STRESS_DURATION, &dropped, &isDone);
+
+    for(idx = 0U; idx < FrameSnapshot::MAX_READERS; ++idx)
+    {
+        readers[idx]->join();
+        delete readers[idx];
+
+        TEST_ASSERT_EQUAL_UINT32(0U, results[idx].tornFrames);
+        TEST_ASSERT_EQUAL_UINT32(0U, results[idx].outOfOrder);
+
+        totalReads += results[idx].reads;
+    }
+
+    /* With up to MAX_READERS readers, the writer never drops a frame. */
+    TEST_ASSERT_EQUAL_UINT32(0U, dropped.load());
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, totalReads);
+
+    printf("snapshot: %u frames written, %u frames read by %u readers\n", frames, totalReads, FrameSnapshot::MAX_READERS);
+
+    return;
+}
+
+/**
+ * Writer, which publishes frames filled with the frame number.
+ *
+ * @param[in] snapshot  Frame snapshot
+ * @param[in] duration  Duration in ms, how long frames shall be published.
+ * @param[out] dropped  Number of dropped frames
+ * @param[out] isDone   Set, after the duration elapsed.
+ *
+ * @return Number of published frames
+ */
+static uint32_t writerTask(FrameSnapshot* snapshot, uint32_t duration, std::atomic<uint32_t>* dropped, std::atomic<bool>* isDone)
+{
+    uint32_t frame = 0U;
+    uint32_t start = millis();
+
+    /* Don't yield, the readers shall interrupt the writer at random positions. */
+    while(duration > (millis() - start))
+    {
+        ++frame;
+
+        uint32_t* pixels = snapshot->beginWrite();
+
+        if (nullptr == pixels)
+        {
+            ++(*dropped);
+        }
+        else
+        {
+            size_t idx = 0U;
+
+            for(idx = 0U; idx < FRAME_LENGTH; ++idx)
+            {
+                pixels[idx] = frame;
+            }
+
+            snapshot->endWrite(frame);
+        }
+    }
+
+    *isDone = true;
+
+    return frame;
+}
+
+/**
+ * Reader, which checks every read frame for consistency.
+ *
+ * @param[in] snapshot  Frame snapshot
+ * @param[out] started  Number of started readers
+ * @param[in] isDone    Stop reading, if set.
+ * @param[out] result   Reader result
+ */
+static void readerTask(FrameSnapshot* snapshot, std::atomic<uint8_t>* started, std::atomic<bool>* isDone, ReaderResult* result)
+{
+    uint32_t    frame[FRAME_LENGTH];
+    uint32_t    info        = 0U;
+    uint32_t    lastInfo    = 0U;
+
+    ++(*started);
+
+    while(false == isDone->load())
+    {
+        if (true == snapshot->read(frame, FRAME_LENGTH, info))
+        {
+            size_t idx = 0U;
+
+            for(idx = 0U; idx < FRAME_LENGTH; ++idx)
+            {
+                if (info != frame[idx])
+                {
+                    ++result->tornFrames;
+                    break;
+                }
+            }
+
+            if (lastInfo > info)
+            {
+                ++result->outOfOrder;
+            }
+
+            lastInfo = info;
+            ++result->reads;
+        }
+    }
+
+    return;
+}
\ No newline at end of file
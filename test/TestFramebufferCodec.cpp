@@ -0,0 +1,251 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Binary framebuffer codec tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestFramebufferCodec.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <FramebufferCodec.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testFullFrame();
+static void testDeltaFrame();
+static void testInvalidFrames();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Framebuffer width in pixels */
+static const uint16_t   WIDTH       = 32U;
+
+/** Framebuffer height in pixels */
+static const uint16_t   HEIGHT      = 8U;
+
+/** Number of pixels in the framebuffer */
+static const size_t     PIXELS      = WIDTH * HEIGHT;
+
+/** Full frame size in bytes */
+static const size_t     FRAME_SIZE  = FramebufferCodec::HEADER_SIZE + (PIXELS * FramebufferCodec::BYTES_PER_PIXEL);
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the binary framebuffer codec.
+ */
+extern void testFramebufferCodec()
+{
+    testFullFrame();
+    testDeltaFrame();
+    testInvalidFrames();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test encoding and decoding of full frames.
+ */
+static void testFullFrame()
+{
+    uint32_t    frame[PIXELS];
+    uint32_t    decoded[PIXELS];
+    uint8_t     buffer[FRAME_SIZE];
+    size_t      index   = 0U;
+    size_t      size    = 0U;
+    uint8_t     slotId  = 0U;
+
+    for(index = 0U; index < PIXELS; ++index)
+    {
+        frame[index] = (index * 0x010203U) & 0x00ffffffU;
+    }
+
+    TEST_ASSERT_EQUAL(FRAME_SIZE, FramebufferCodec::getFullFrameSize(WIDTH, HEIGHT));
+
+    /* Buffer too small */
+    TEST_ASSERT_EQUAL(0U, FramebufferCodec::encodeFull(buffer, FRAME_SIZE - 1U, 3U, WIDTH, HEIGHT, frame, false));
+
+    /* Full frame of a subscription */
+    size = FramebufferCodec::encodeFull(buffer, sizeof(buffer), 3U, WIDTH, HEIGHT, frame, true);
+    TEST_ASSERT_EQUAL(FRAME_SIZE, size);
+    TEST_ASSERT_EQUAL_UINT8(FramebufferCodec::FRAME_FLAG_SUBSCRIPTION, buffer[0]);
+
+    memset(decoded, 0, sizeof(decoded));
+    TEST_ASSERT_TRUE(FramebufferCodec::decode(buffer, size, slotId, WIDTH, HEIGHT, decoded));
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(frame, decoded, PIXELS);
+
+    /* Full frame as response to a single request */
+    size = FramebufferCodec::encodeFull(buffer, sizeof(buffer), 3U, WIDTH, HEIGHT, frame, false);
+    TEST_ASSERT_EQUAL(FRAME_SIZE, size);
+    TEST_ASSERT_EQUAL_UINT8(0U, buffer[0]);
+    TEST_ASSERT_EQUAL_UINT8(3U, buffer[1]);
+    TEST_ASSERT_EQUAL_UINT8(WIDTH, buffer[2]);
+    TEST_ASSERT_EQUAL_UINT8(0U, buffer[3]);
+    TEST_ASSERT_EQUAL_UINT8(HEIGHT, buffer[4]);
+    TEST_ASSERT_EQUAL_UINT8(0U, buffer[5]);
+
+    /* Pixels are stored in RGB order. */
+    TEST_ASSERT_EQUAL_UINT8((frame[1] >> 16U) & 0xffU, buffer[FramebufferCodec::HEADER_SIZE + 3U]);
+    TEST_ASSERT_EQUAL_UINT8((frame[1] >> 8U) & 0xffU, buffer[FramebufferCodec::HEADER_SIZE + 4U]);
+    TEST_ASSERT_EQUAL_UINT8((frame[1] >> 0U) & 0xffU, buffer[FramebufferCodec::HEADER_SIZE + 5U]);
+
+    memset(decoded, 0, sizeof(decoded));
+    TEST_ASSERT_TRUE(FramebufferCodec::decode(buffer, size, slotId, WIDTH, HEIGHT, decoded));
+    TEST_ASSERT_EQUAL_UINT8(3U, slotId);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(frame, decoded, PIXELS);
+
+    return;
+}
+
+/**
+ * Test encoding and decoding of delta frames.
+ */
+static void testDeltaFrame()
+{
+    uint32_t    refFrame[PIXELS];
+    uint32_t    frame[PIXELS];
+    uint32_t    decoded[PIXELS];
+    uint8_t     buffer[FRAME_SIZE];
+    size_t      index   = 0U;
+    size_t      size    = 0U;
+    uint8_t     slotId  = 0U;
+
+    for(index = 0U; index < PIXELS; ++index)
+    {
+        refFrame[index] = (index * 0x030201U) & 0x00ffffffU;
+    }
+
+    /* No change results in the header only. */
+    memcpy(frame, refFrame, sizeof(frame));
+    size = FramebufferCodec::encodeDelta(buffer, sizeof(buffer), 1U, WIDTH, HEIGHT, frame, refFrame);
+    TEST_ASSERT_EQUAL(FramebufferCodec::HEADER_SIZE, size);
+    TEST_ASSERT_EQUAL_UINT8(FramebufferCodec::FRAME_FLAG_DELTA | FramebufferCodec::FRAME_FLAG_SUBSCRIPTION, buffer[0]);
+
+    /* A single changed pixel after a long unchanged run:
+     * 200 unchanged pixels need two skip runs, the changed pixel a literal run.
+     */
+    frame[200] ^= 0x00102030U;
+    size = FramebufferCodec::encodeDelta(buffer, sizeof(buffer), 1U, WIDTH, HEIGHT, frame, refFrame);
+    TEST_ASSERT_EQUAL(FramebufferCodec::HEADER_SIZE + 2U + 1U + FramebufferCodec::BYTES_PER_PIXEL, size);
+    TEST_ASSERT_EQUAL_UINT8(127U, buffer[FramebufferCodec::HEADER_SIZE + 0U]);
+    TEST_ASSERT_EQUAL_UINT8(71U, buffer[FramebufferCodec::HEADER_SIZE + 1U]);
+    TEST_ASSERT_EQUAL_UINT8(0x80U, buffer[FramebufferCodec::HEADER_SIZE + 2U]);
+    TEST_ASSERT_EQUAL_UINT8(0x10U, buffer[FramebufferCodec::HEADER_SIZE + 3U]);
+    TEST_ASSERT_EQUAL_UINT8(0x20U, buffer[FramebufferCodec::HEADER_SIZE + 4U]);
+    TEST_ASSERT_EQUAL_UINT8(0x30U, buffer[FramebufferCodec::HEADER_SIZE + 5U]);
+
+    memcpy(decoded, refFrame, sizeof(decoded));
+    TEST_ASSERT_TRUE(FramebufferCodec::decode(buffer, size, slotId, WIDTH, HEIGHT, decoded));
+    TEST_ASSERT_EQUAL_UINT8(1U, slotId);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(frame, decoded, PIXELS);
+
+    /* Scattered changes, incl. the first and the last pixel. */
+    for(index = 0U; index < PIXELS; index += 7U)
+    {
+        frame[index] = ~frame[index] & 0x00ffffffU;
+    }
+    frame[PIXELS - 1U] = 0x00abcdefU;
+
+    size = FramebufferCodec::encodeDelta(buffer, sizeof(buffer), 2U, WIDTH, HEIGHT, frame, refFrame);
+    TEST_ASSERT_NOT_EQUAL(0U, size);
+    TEST_ASSERT_LESS_THAN(FRAME_SIZE, size);
+
+    memcpy(decoded, refFrame, sizeof(decoded));
+    TEST_ASSERT_TRUE(FramebufferCodec::decode(buffer, size, slotId, WIDTH, HEIGHT, decoded));
+    TEST_ASSERT_EQUAL_UINT8(2U, slotId);
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(frame, decoded, PIXELS);
+
+    /* Every pixel changed: The delta frame needs more space than a full frame. */
+    for(index = 0U; index < PIXELS; ++index)
+    {
+        frame[index] = refFrame[index] ^ 0x00010101U;
+    }
+
+    TEST_ASSERT_EQUAL(0U, FramebufferCodec::encodeDelta(buffer, sizeof(buffer), 2U, WIDTH, HEIGHT, frame, refFrame));
+
+    return;
+}
+
+/**
+ * Test that corrupted frames are rejected.
+ */
+static void testInvalidFrames()
+{
+    uint32_t        frame[PIXELS];
+    uint8_t         slotId      = 0U;
+    const uint8_t   DELTA       = FramebufferCodec::FRAME_FLAG_DELTA | FramebufferCodec::FRAME_FLAG_SUBSCRIPTION;
+    const uint8_t   WRONG_SIZE[FramebufferCodec::HEADER_SIZE]       = { DELTA, 0U, WIDTH + 1U, 0U, HEIGHT, 0U };
+    const uint8_t   WRONG_FLAGS[FramebufferCodec::HEADER_SIZE]      = { DELTA | 0x04U, 0U, WIDTH, 0U, HEIGHT, 0U };
+    const uint8_t   TRUNCATED[FramebufferCodec::HEADER_SIZE + 3U]   = { DELTA, 0U, WIDTH, 0U, HEIGHT, 0U, 0x81U, 0x01U, 0x02U };
+    const uint8_t   OUT_OF_RANGE[FramebufferCodec::HEADER_SIZE + 3U] = { DELTA, 0U, WIDTH, 0U, HEIGHT, 0U, 0x7fU, 0x7fU, 0x7fU };
+
+    memset(frame, 0, sizeof(frame));
+
+    TEST_ASSERT_FALSE(FramebufferCodec::decode(WRONG_SIZE, sizeof(WRONG_SIZE), slotId, WIDTH, HEIGHT, frame));
+    TEST_ASSERT_FALSE(FramebufferCodec::decode(WRONG_FLAGS, sizeof(WRONG_FLAGS), slotId, WIDTH, HEIGHT, frame));
+    TEST_ASSERT_FALSE(FramebufferCodec::decode(TRUNCATED, sizeof(TRUNCATED), slotId, WIDTH, HEIGHT, frame));
+    TEST_ASSERT_FALSE(FramebufferCodec::decode(OUT_OF_RANGE, sizeof(OUT_OF_RANGE), slotId, WIDTH, HEIGHT, frame));
+
+    return;
+}
\ No newline at end of file
@@ -76,10 +76,15 @@
 extern void testGfx()
 {
     TestGfx     testGfx;
-    const Color COLOR   = 0x1234;
-    int16_t     x       = 0;
-    int16_t     y       = 0;
-    Color       color   = 0U;
+    const Color COLOR           = 0x1234;
+    int16_t     x               = 0;
+    int16_t     y               = 0;
+    Color       color           = 0U;
+    uint32_t    drawPixelCalls  = 0U;
+    int16_t     dirtyX          = 0;
+    int16_t     dirtyY          = 0;
+    uint16_t    dirtyWidth      = 0U;
+    uint16_t    dirtyHeight     = 0U;
     YAGfxStaticBitmap<TestGfx::WIDTH, TestGfx::HEIGHT>  bitmap;
 
     /* Verify screen size */
@@ -176,6 +181,84 @@ extern void testGfx()
     testGfx.fillScreen(0U);
     TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, TestGfx::HEIGHT, 0U));
 
+    /* Fill a span, which is clipped on both sides of the bitmap. */
+    bitmap.fillScreen(0U);
+    bitmap.fillSpan(-2, 1, TestGfx::WIDTH + 4U, COLOR);
+    for(x = 0; x < TestGfx::WIDTH; ++x)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(x, 0));
+        TEST_ASSERT_EQUAL_UINT32(COLOR, bitmap.getColor(x, 1));
+        TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(x, 2));
+    }
+
+    /* Spans outside the bitmap shall be ignored. */
+    bitmap.fillSpan(0, -1, TestGfx::WIDTH, COLOR);
+    bitmap.fillSpan(0, TestGfx::HEIGHT, TestGfx::WIDTH, COLOR);
+    bitmap.fillSpan(TestGfx::WIDTH, 0, 1U, COLOR);
+    bitmap.fillSpan(-1, 0, 1U, COLOR);
+    TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(TestGfx::WIDTH - 1, 0));
+    TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(0, TestGfx::HEIGHT - 1));
+
+    /* Draw a span, which starts left outside the bitmap. */
+    {
+        Color colors[3U] = { 1U, 2U, 3U };
+
+        bitmap.drawSpan(-1, 0, colors, UTIL_ARRAY_NUM(colors));
+        TEST_ASSERT_EQUAL_UINT32(colors[1], bitmap.getColor(0, 0));
+        TEST_ASSERT_EQUAL_UINT32(colors[2], bitmap.getColor(1, 0));
+        TEST_ASSERT_EQUAL_UINT32(0U, bitmap.getColor(2, 0));
+        TEST_ASSERT_EQUAL_PTR(&bitmap.getColor(0, 1), bitmap.getRow(1));
+        TEST_ASSERT_NULL(bitmap.getRow(TestGfx::HEIGHT));
+    }
+
+    /* Copy via rows, but destination uses the generic per pixel fallback. */
+    drawPixelCalls = testGfx.getCallCounterDrawPixel();
+    testGfx.drawBitmap(0, 0, bitmap);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 1, TestGfx::WIDTH, 1U, COLOR));
+    TEST_ASSERT_EQUAL_UINT32(TestGfx::WIDTH * TestGfx::HEIGHT, testGfx.getCallCounterDrawPixel() - drawPixelCalls);
+
+    /* Clear screen */
+    testGfx.fillScreen(0U);
+    TEST_ASSERT_TRUE(testGfx.verify(0, 0, TestGfx::WIDTH, TestGfx::HEIGHT, 0U));
+
+    /* The whole bitmap is dirty, until it is cleared. */
+    TEST_ASSERT_TRUE(bitmap.isDirty());
+    TEST_ASSERT_TRUE(bitmap.getDirtyRect(dirtyX, dirtyY, dirtyWidth, dirtyHeight));
+    TEST_ASSERT_EQUAL_INT16(0, dirtyX);
+    TEST_ASSERT_EQUAL_INT16(0, dirtyY);
+    TEST_ASSERT_EQUAL_UINT16(TestGfx::WIDTH, dirtyWidth);
+    TEST_ASSERT_EQUAL_UINT16(TestGfx::HEIGHT, dirtyHeight);
+
+    bitmap.clearDirty();
+    TEST_ASSERT_FALSE(bitmap.isDirty());
+    TEST_ASSERT_FALSE(bitmap.getDirtyRect(dirtyX, dirtyY, dirtyWidth, dirtyHeight));
+
+    /* Drawing the same content again shall not make the bitmap dirty. */
+    bitmap.drawPixel(0, 1, COLOR);
+    bitmap.fillSpan(0, 1, TestGfx::WIDTH, COLOR);
+    bitmap.drawBitmap(0, 0, bitmap);
+    TEST_ASSERT_FALSE(bitmap.isDirty());
+
+    /* Only the changed pixels shall be part of the dirty area. */
+    bitmap.fillSpan(-2, 1, 5U, 0U);
+    bitmap.drawPixel(1, 3, COLOR);
+    bitmap.drawPixel(TestGfx::WIDTH, 0, COLOR);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRect(dirtyX, dirtyY, dirtyWidth, dirtyHeight));
+    TEST_ASSERT_EQUAL_INT16(0, dirtyX);
+    TEST_ASSERT_EQUAL_INT16(1, dirtyY);
+    TEST_ASSERT_EQUAL_UINT16(3U, dirtyWidth);
+    TEST_ASSERT_EQUAL_UINT16(3U, dirtyHeight);
+
+    /* Write access via getColor() makes the pixel dirty. */
+    bitmap.clearDirty();
+    bitmap.getColor(TestGfx::WIDTH - 1, TestGfx::HEIGHT - 1).setIntensity(0U);
+    TEST_ASSERT_TRUE(bitmap.getDirtyRect(dirtyX, dirtyY, dirtyWidth, dirtyHeight));
+    TEST_ASSERT_EQUAL_INT16(TestGfx::WIDTH - 1, dirtyX);
+    TEST_ASSERT_EQUAL_INT16(TestGfx::HEIGHT - 1, dirtyY);
+    TEST_ASSERT_EQUAL_UINT16(1U, dirtyWidth);
+    TEST_ASSERT_EQUAL_UINT16(1U, dirtyHeight);
+
     return;
 }
 
@@ -0,0 +1,364 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Graphics benchmark
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestGfxBenchmark.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <Arduino.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+#include <BaseGfxBitmap.hpp>
+#include <Rgb888.h>
+#include <Rgb888Packed.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/**
+ * Canvas, which provides only the mandatory pixel access. All bulk operations
+ * use the generic per pixel fallback of the graphics interface, which is used
+ * as reference for the benchmark.
+ */
+class PixelGfx : public YAGfx
+{
+public:
+
+    /**
+     * Constructs the canvas.
+     *
+     * @param[in] width     Canvas width in pixels
+     * @param[in] height    Canvas height in pixels
+     */
+    PixelGfx(uint16_t width, uint16_t height) :
+        YAGfx(),
+        m_bitmap(width, height)
+    {
+    }
+
+    /**
+     * Destroys the canvas.
+     */
+    ~PixelGfx()
+    {
+    }
+
+    /**
+     * Get width in pixels.
+     *
+     * @return Width in pixels
+     */
+    uint16_t getWidth() const final
+    {
+        return m_bitmap.getWidth();
+    }
+
+    /**
+     * Get height in pixels.
+     *
+     * @return Height in pixels
+     */
+    uint16_t getHeight() const final
+    {
+        return m_bitmap.getHeight();
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    Color& getColor(int16_t x, int16_t y) final
+    {
+        return m_bitmap.getColor(x, y);
+    }
+
+    /**
+     * Get pixel color at given position.
+     *
+     * @param[in] x x-coordinate
+     * @param[in] y y-coordinate
+     *
+     * @return Color
+     */
+    const Color& getColor(int16_t x, int16_t y) const final
+    {
+        return m_bitmap.getColor(x, y);
+    }
+
+    /**
+     * Draw a single pixel at given position.
+     *
+     * @param[in] x     x-coordinate
+     * @param[in] y     y-coordinate
+     * @param[in] color Color
+     */
+    void drawPixel(int16_t x, int16_t y, const Color& color) final
+    {
+        m_bitmap.drawPixel(x, y, color);
+    }
+
+private:
+
+    YAGfxDynamicBitmap  m_bitmap;   /**< Pixel buffer */
+
+    PixelGfx();
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static uint32_t measureFrameTime(YAGfx& dst, const YAGfxBitmap& src, uint32_t frames);
+static void benchmarkCanvas(uint16_t width, uint16_t height);
+
+template < typename TColor >
+static uint32_t measureWorkload(uint16_t width, uint16_t height, uint32_t frames, uint32_t& checksum);
+
+static void benchmarkColor(uint16_t width, uint16_t height);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Number of pixels, which shall be drawn per measurement to get a stable result. */
+static const uint32_t   PIXELS_PER_MEASUREMENT  = 4UL * 1024UL * 1024UL;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Benchmark the bulk graphic operations.
+ */
+extern void testGfxBenchmark()
+{
+    /* LED matrix */
+    benchmarkCanvas(32U, 8U);
+
+    /* Large LED matrix */
+    benchmarkCanvas(64U, 64U);
+
+    /* Compare the color representations. */
+    benchmarkColor(32U, 8U);
+    benchmarkColor(64U, 64U);
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Measure the time of the TestGfx drawing workload per frame. Every frame is
+ * finally read back as RGB24 values, like it is done to show it or to
+ * provide a framebuffer copy.
+ *
+ * @tparam TColor           The color representation.
+ *
+ * @param[in] width         Canvas width in pixels
+ * @param[in] height        Canvas height in pixels
+ * @param[in] frames        Number of frames to draw
+ * @param[out] checksum     Checksum over the read back RGB24 values
+ *
+ * @return Duration per frame in ns
+ */
+template < typename TColor >
+static uint32_t measureWorkload(uint16_t width, uint16_t height, uint32_t frames, uint32_t& checksum)
+{
+    BaseGfxDynamicBitmap<TColor>    canvas(width, height);
+    BaseGfxDynamicBitmap<TColor>    bitmap(width, height);
+    const TColor                    COLOR(0x00123456U);
+    const TColor                    BLACK(0U);
+    uint32_t                        frame       = 0U;
+    int16_t                         x           = 0;
+    int16_t                         y           = 0;
+    unsigned long                   timestamp   = 0U;
+    unsigned long                   duration    = 0U;
+
+    srand(0U);
+    for(y = 0; y < height; ++y)
+    {
+        for(x = 0; x < width; ++x)
+        {
+            bitmap.drawPixel(x, y, TColor(static_cast<uint32_t>(rand()) & 0x00ffffffU));
+        }
+    }
+
+    checksum    = 0U;
+    timestamp   = millis();
+
+    for(frame = 0U; frame < frames; ++frame)
+    {
+        canvas.fillScreen(BLACK);
+        canvas.drawLine(0, 0, width - 1, height - 1, COLOR);
+        canvas.drawRectangle(0, 0, width, height, COLOR);
+        canvas.fillRect(0, 0, width / 2U, height / 2U, COLOR);
+        canvas.drawBitmap(0, 0, bitmap);
+
+        for(y = 0; y < height; ++y)
+        {
+            const TColor* row = canvas.getRow(y);
+
+            for(x = 0; x < width; ++x)
+            {
+                checksum += static_cast<uint32_t>(row[x]);
+            }
+        }
+    }
+
+    duration = millis() - timestamp;
+
+    return static_cast<uint32_t>((static_cast<uint64_t>(duration) * 1000000ULL) / frames);
+}
+
+/**
+ * Benchmark the TestGfx drawing workload with the color representation,
+ * which stores the intensity separate and with the packed one.
+ *
+ * @param[in] width     Canvas width in pixels
+ * @param[in] height    Canvas height in pixels
+ */
+static void benchmarkColor(uint16_t width, uint16_t height)
+{
+    const uint32_t  FRAMES          = PIXELS_PER_MEASUREMENT / (width * height);
+    uint32_t        checksum        = 0U;
+    uint32_t        checksumPacked  = 0U;
+    uint32_t        frameTime       = measureWorkload<Rgb888>(width, height, FRAMES, checksum);
+    uint32_t        frameTimePacked = measureWorkload<Rgb888Packed>(width, height, FRAMES, checksumPacked);
+
+    /* Both representations shall lead to the same result. */
+    TEST_ASSERT_EQUAL_UINT32(checksum, checksumPacked);
+
+    printf("color %ux%u: Rgb888 %u ns/frame, Rgb888Packed %u ns/frame (%u frames)\n",
+        width,
+        height,
+        frameTime,
+        frameTimePacked,
+        FRAMES);
+}
+/**
+ * Measure the time of a complete frame update via drawBitmap().
+ *
+ * @param[in] dst       Destination canvas
+ * @param[in] src       Source framebuffer
+ * @param[in] frames    Number of frames to draw
+ *
+ * @return Duration per frame in ns
+ */
+static uint32_t measureFrameTime(YAGfx& dst, const YAGfxBitmap& src, uint32_t frames)
+{
+    uint32_t        frame       = 0U;
+    unsigned long   timestamp   = millis();
+    unsigned long   duration    = 0U;
+
+    for(frame = 0U; frame < frames; ++frame)
+    {
+        dst.drawBitmap(0, 0, src);
+    }
+
+    duration = millis() - timestamp;
+
+    return static_cast<uint32_t>((static_cast<uint64_t>(duration) * 1000000ULL) / frames);
+}
+
+/**
+ * Benchmark a canvas with the given size. The per pixel fallback is compared
+ * with the span based bitmap implementation.
+ *
+ * @param[in] width     Canvas width in pixels
+ * @param[in] height    Canvas height in pixels
+ */
+static void benchmarkCanvas(uint16_t width, uint16_t height)
+{
+    const uint32_t      FRAMES          = PIXELS_PER_MEASUREMENT / (width * height);
+    YAGfxDynamicBitmap  src(width, height);
+    YAGfxDynamicBitmap  spanDst(width, height);
+    PixelGfx            pixelDst(width, height);
+    int16_t             x               = 0;
+    int16_t             y               = 0;
+    uint32_t            pixelFrameTime  = 0U;
+    uint32_t            spanFrameTime   = 0U;
+
+    for(y = 0; y < height; ++y)
+    {
+        for(x = 0; x < width; ++x)
+        {
+            src.drawPixel(x, y, static_cast<uint32_t>(rand()) & 0x00ffffffU);
+        }
+    }
+
+    pixelFrameTime  = measureFrameTime(pixelDst, src, FRAMES);
+    spanFrameTime   = measureFrameTime(spanDst, src, FRAMES);
+
+    /* Both ways shall lead to the same result. */
+    for(y = 0; y < height; ++y)
+    {
+        for(x = 0; x < width; ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(src.getColor(x, y), pixelDst.getColor(x, y));
+            TEST_ASSERT_EQUAL_UINT32(src.getColor(x, y), spanDst.getColor(x, y));
+        }
+    }
+
+    printf("drawBitmap %ux%u: per pixel %u ns/frame, span %u ns/frame (%u frames)\n",
+        width,
+        height,
+        pixelFrameTime,
+        spanFrameTime,
+        FRAMES);
+
+    return;
+}
\ No newline at end of file
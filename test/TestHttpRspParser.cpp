@@ -0,0 +1,563 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  HTTP response header parser tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestHttpRspParser.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <HttpRspParser.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static HttpRspParser::Result parseAtOnce(HttpRspParser& parser, const char* data, size_t len, size_t& index);
+static HttpRspParser::Result parseSegmented(HttpRspParser& parser, const char* data, size_t len, size_t segmentSize, size_t& index);
+static uint32_t nextRandom();
+static void testResponse();
+static void testSpecialCases();
+static void testSkippedHeaders();
+static void testInvalid();
+static void testFuzz();
+static void testBenchmark();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Typical response, followed by the begin of the body. */
+static const char*      RESPONSE        =
+    "HTTP/1.1 200 OK\r\n"
+    "Content-Type: application/json; charset=utf-8\r\n"
+    "Content-Length:1234\r\n"
+    "ETag: \"abc\"  \t\r\n"
+    "X-Empty:   \r\n"
+    "\r\n"
+    "{\"key\": \"value\"}";
+
+/** GitHub API response with many header fields, which don't fit into the buffer together. */
+static const char*      GITHUB_RESPONSE =
+    "HTTP/1.1 200 OK\r\n"
+    "Server: GitHub.com\r\n"
+    "Date: Sun, 18 Oct 2026 10:12:31 GMT\r\n"
+    "Content-Type: application/json; charset=utf-8\r\n"
+    "Cache-Control: private, max-age=60, s-maxage=60\r\n"
+    "Vary: Accept, Authorization, Cookie, X-GitHub-OTP\r\n"
+    "ETag: W/\"4f8b5d2c7e0a4b1d9c3e6f1a2b7d8e9f0a1b2c3d4e5f60718293a4b5c6d7e8f9\"\r\n"
+    "Last-Modified: Sat, 17 Oct 2026 21:04:55 GMT\r\n"
+    "X-OAuth-Scopes: repo, read:org, gist\r\n"
+    "X-Accepted-OAuth-Scopes: repo\r\n"
+    "github-authentication-token-expiration: 2026-11-17 10:00:00 UTC\r\n"
+    "X-GitHub-Media-Type: github.v3; format=json\r\n"
+    "x-github-api-version-selected: 2022-11-28\r\n"
+    "X-RateLimit-Limit: 5000\r\n"
+    "X-RateLimit-Remaining: 4987\r\n"
+    "X-RateLimit-Reset: 1792318351\r\n"
+    "X-RateLimit-Used: 13\r\n"
+    "X-RateLimit-Resource: core\r\n"
+    "Access-Control-Expose-Headers: ETag, Link, Location, Retry-After, X-GitHub-OTP, X-RateLimit-Limit, "
+        "X-RateLimit-Remaining, X-RateLimit-Used, X-RateLimit-Resource, X-RateLimit-Reset, X-OAuth-Scopes, "
+        "X-Accepted-OAuth-Scopes, X-Poll-Interval, X-GitHub-Media-Type, X-GitHub-SSO, X-GitHub-Request-Id, "
+        "Deprecation, Sunset\r\n"
+    "Access-Control-Allow-Origin: *\r\n"
+    "Strict-Transport-Security: max-age=31536000; includeSubdomains; preload\r\n"
+    "X-Frame-Options: deny\r\n"
+    "X-Content-Type-Options: nosniff\r\n"
+    "X-XSS-Protection: 0\r\n"
+    "Referrer-Policy: origin-when-cross-origin, strict-origin-when-cross-origin\r\n"
+    "Content-Security-Policy: default-src 'none'\r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "Connection: keep-alive\r\n"
+    "X-GitHub-Request-Id: C2A4:3B5F:1D2E3F4:1E2F3A5:67123ABC\r\n"
+    "\r\n"
+    "2\r\n{}";
+
+/** Number of fuzz test runs */
+static const uint32_t   FUZZ_RUNS       = 20000U;
+
+/** Number of benchmark runs */
+static const uint32_t   BENCHMARK_RUNS  = 100000U;
+
+/** State of the pseudo random number generator */
+static uint32_t         gRandomState    = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the HTTP response header parser, incl. a fuzz test and a benchmark.
+ */
+extern void testHttpRspParser()
+{
+    testResponse();
+    testSpecialCases();
+    testSkippedHeaders();
+    testInvalid();
+    testFuzz();
+    testBenchmark();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test a typical response, parsed at once and byte by byte.
+ */
+static void testResponse()
+{
+    HttpRspParser   parser;
+    size_t          len     = strlen(RESPONSE);
+    size_t          bodyIdx = strstr(RESPONSE, "\r\n\r\n") - RESPONSE + 4U;
+    size_t          index   = 0U;
+
+    /* Empty */
+    TEST_ASSERT_FALSE(parser.isComplete());
+    TEST_ASSERT_EQUAL_UINT8(0U, parser.getHeaderCount());
+    TEST_ASSERT_NULL(parser.getHeader("Content-Type"));
+    TEST_ASSERT_NULL(parser.getHeaderName(0U));
+    TEST_ASSERT_NULL(parser.getHeaderValue(0U));
+
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, RESPONSE, len, index));
+    TEST_ASSERT_TRUE(parser.isComplete());
+
+    /* The body is not consumed. */
+    TEST_ASSERT_EQUAL_UINT32(bodyIdx, index);
+
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.1", parser.getHttpVersion());
+    TEST_ASSERT_EQUAL_UINT16(200U, parser.getStatusCode());
+    TEST_ASSERT_EQUAL_STRING("OK", parser.getReasonPhrase());
+    TEST_ASSERT_EQUAL_UINT8(3U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("Content-Type", parser.getHeaderName(0U));
+    TEST_ASSERT_EQUAL_STRING("application/json; charset=utf-8", parser.getHeaderValue(0U));
+    TEST_ASSERT_NULL(parser.getHeaderName(3U));
+
+    /* Case-insensitive names and trimmed values */
+    TEST_ASSERT_EQUAL_STRING("1234", parser.getHeader("content-length"));
+    TEST_ASSERT_EQUAL_STRING("\"abc\"", parser.getHeader("ETAG"));
+
+    /* Not needed header fields are skipped. */
+    TEST_ASSERT_NULL(parser.getHeader("X-Empty"));
+    TEST_ASSERT_NULL(parser.getHeader("Transfer-Encoding"));
+    TEST_ASSERT_NULL(parser.getHeader(nullptr));
+
+    /* Byte by byte */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseSegmented(parser, RESPONSE, len, 1U, index));
+    TEST_ASSERT_EQUAL_UINT32(bodyIdx, index);
+    TEST_ASSERT_EQUAL_UINT16(200U, parser.getStatusCode());
+    TEST_ASSERT_EQUAL_STRING("1234", parser.getHeader("Content-Length"));
+
+    /* No more data is consumed after completion. */
+    index = 0U;
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parser.parse(RESPONSE, len, index));
+    TEST_ASSERT_EQUAL_UINT32(0U, index);
+
+    return;
+}
+
+/**
+ * Test special cases, which are allowed by RFC7230.
+ */
+static void testSpecialCases()
+{
+    HttpRspParser   parser;
+    size_t          index   = 0U;
+    const char*     LF_ONLY = "HTTP/1.0 404 Not Found\nServer: test\nConnection: close\n\n";
+    const char*     FOLDED  = "HTTP/1.1 200 OK\r\nContent-Type: first  \r\n  second\r\n\tthird\r\nETag: next\r\n\r\n";
+    const char*     NO_RSN  = "HTTP/1.1 304\r\nETag: \"abc\"\r\n\r\n";
+
+    /* Single LF as line terminator */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, LF_ONLY, strlen(LF_ONLY), index));
+    TEST_ASSERT_EQUAL_UINT32(strlen(LF_ONLY), index);
+    TEST_ASSERT_EQUAL_STRING("HTTP/1.0", parser.getHttpVersion());
+    TEST_ASSERT_EQUAL_UINT16(404U, parser.getStatusCode());
+    TEST_ASSERT_EQUAL_STRING("Not Found", parser.getReasonPhrase());
+    TEST_ASSERT_EQUAL_STRING("close", parser.getHeader("Connection"));
+
+    /* Obsolete line folding */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, FOLDED, strlen(FOLDED), index));
+    TEST_ASSERT_EQUAL_UINT8(2U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("first second third", parser.getHeader("Content-Type"));
+    TEST_ASSERT_EQUAL_STRING("next", parser.getHeader("ETag"));
+
+    /* Missing reason phrase */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, NO_RSN, strlen(NO_RSN), index));
+    TEST_ASSERT_EQUAL_UINT16(304U, parser.getStatusCode());
+    TEST_ASSERT_EQUAL_STRING("", parser.getReasonPhrase());
+    TEST_ASSERT_EQUAL_STRING("\"abc\"", parser.getHeader("ETag"));
+
+    /* Incomplete */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_PENDING, parseAtOnce(parser, NO_RSN, strlen(NO_RSN) - 2U, index));
+    TEST_ASSERT_FALSE(parser.isComplete());
+
+    return;
+}
+
+/**
+ * Test that not needed header fields are skipped, even if they would not
+ * fit into the buffer.
+ */
+static void testSkippedHeaders()
+{
+    HttpRspParser   parser;
+    size_t          len     = strlen(GITHUB_RESPONSE);
+    size_t          bodyIdx = strstr(GITHUB_RESPONSE, "\r\n\r\n") - GITHUB_RESPONSE + 4U;
+    size_t          index   = 0U;
+    const char*     FOLDED  = "HTTP/1.1 200 OK\r\nX-Folded: first\r\n second\r\nETag: \"abc\"\r\n\r\n";
+    const char*     LONG    = "HTTP/1.1 200 OK\r\nX-A-Very-Long-Header-Field-Name: value\r\nConnection: close\r\n\r\n";
+
+    /* Much more header than buffer, but only the needed fields are stored. */
+    TEST_ASSERT_GREATER_THAN_UINT32(HttpRspParser::BUFFER_SIZE, bodyIdx);
+
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, GITHUB_RESPONSE, len, index));
+    TEST_ASSERT_EQUAL_UINT32(bodyIdx, index);
+    TEST_ASSERT_EQUAL_UINT16(200U, parser.getStatusCode());
+    TEST_ASSERT_EQUAL_UINT8(5U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("application/json; charset=utf-8", parser.getHeader("Content-Type"));
+    TEST_ASSERT_EQUAL_STRING("W/\"4f8b5d2c7e0a4b1d9c3e6f1a2b7d8e9f0a1b2c3d4e5f60718293a4b5c6d7e8f9\"", parser.getHeader("ETag"));
+    TEST_ASSERT_EQUAL_STRING("Sat, 17 Oct 2026 21:04:55 GMT", parser.getHeader("Last-Modified"));
+    TEST_ASSERT_EQUAL_STRING("chunked", parser.getHeader("Transfer-Encoding"));
+    TEST_ASSERT_EQUAL_STRING("keep-alive", parser.getHeader("Connection"));
+    TEST_ASSERT_NULL(parser.getHeader("Content-Length"));
+    TEST_ASSERT_NULL(parser.getHeader("Server"));
+    TEST_ASSERT_NULL(parser.getHeader("X-RateLimit-Remaining"));
+
+    /* Same result in random TCP segments. */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseSegmented(parser, GITHUB_RESPONSE, len, 0U, index));
+    TEST_ASSERT_EQUAL_UINT32(bodyIdx, index);
+    TEST_ASSERT_EQUAL_UINT8(5U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("keep-alive", parser.getHeader("Connection"));
+
+    /* Folded lines of a skipped header field are skipped too. */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, FOLDED, strlen(FOLDED), index));
+    TEST_ASSERT_EQUAL_UINT8(1U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("\"abc\"", parser.getHeader("ETag"));
+
+    /* A name longer than all needed names is skipped. */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, LONG, strlen(LONG), index));
+    TEST_ASSERT_EQUAL_UINT8(1U, parser.getHeaderCount());
+    TEST_ASSERT_EQUAL_STRING("close", parser.getHeader("Connection"));
+
+    return;
+}
+
+/**
+ * Test invalid responses.
+ */
+static void testInvalid()
+{
+    HttpRspParser   parser;
+    size_t          index   = 0U;
+    char*           big     = new char[HttpRspParser::BUFFER_SIZE + 128U];
+    size_t          idx     = 0U;
+    const char*     INVALID[] =
+    {
+        "HTTX/1.1 200 OK\r\n\r\n",              /* Wrong protocol */
+        "HTTP/1.1 20 OK\r\n\r\n",               /* Status code too short */
+        "HTTP/1.1 2000 OK\r\n\r\n",             /* Status code too long */
+        "HTTP/1.1 2x0 OK\r\n\r\n",              /* Status code not numeric */
+        "HTTP/1.1\r\n\r\n",                     /* Status line incomplete */
+        "HTTP/1.1 200 OK\r\n folded\r\n\r\n",   /* Folding without header field */
+        "HTTP/1.1 200 OK\r\nName : value\r\n\r\n", /* Whitespace before colon */
+        "HTTP/1.1 200 OK\r\nName\r\n\r\n"       /* Missing colon */
+    };
+
+    for(idx = 0U; idx < (sizeof(INVALID) / sizeof(INVALID[0])); ++idx)
+    {
+        TEST_ASSERT_EQUAL(HttpRspParser::RESULT_ERROR, parseAtOnce(parser, INVALID[idx], strlen(INVALID[idx]), index));
+    }
+
+    /* Zero byte in the header */
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_ERROR, parseAtOnce(parser, "HTTP/1.1 200 O\0K\r\n\r\n", 20U, index));
+
+    /* Header too long for the buffer */
+    TEST_ASSERT_NOT_NULL(big);
+    strcpy(big, "HTTP/1.1 200 OK\r\nETag: ");
+
+    for(idx = strlen(big); idx < (HttpRspParser::BUFFER_SIZE + 60U); ++idx)
+    {
+        big[idx] = 'a';
+    }
+
+    strcpy(&big[idx], "\r\n\r\n");
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_ERROR, parseAtOnce(parser, big, strlen(big), index));
+
+    /* Too many header fields, the further ones are skipped. */
+    strcpy(big, "HTTP/1.1 200 OK\r\n");
+
+    for(idx = 0U; idx <= HttpRspParser::MAX_HEADERS; ++idx)
+    {
+        strcat(big, "ETag: y\r\n");
+    }
+
+    strcat(big, "\r\n");
+    TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, big, strlen(big), index));
+    TEST_ASSERT_EQUAL_UINT8(HttpRspParser::MAX_HEADERS, parser.getHeaderCount());
+
+    delete[] big;
+
+    return;
+}
+
+/**
+ * Fuzz test: Mutate a valid response randomly and parse it at once and in
+ * random segments. The parser shall never read beyond the data, never
+ * crash and deliver the same result independent of the segmentation.
+ */
+static void testFuzz()
+{
+    const char      ALPHABET[]  = "HTP/1. 0:\r\n\t\0aZ";
+    const size_t    MAX_LEN     = 256U;
+    char            data[MAX_LEN];
+    size_t          len         = 0U;
+    uint32_t        run         = 0U;
+    uint32_t        completed   = 0U;
+    uint32_t        failed      = 0U;
+    HttpRspParser   parserAtOnce;
+    HttpRspParser   parserSegmented;
+
+    gRandomState = 42U;
+
+    for(run = 0U; run < FUZZ_RUNS; ++run)
+    {
+        HttpRspParser::Result   resultAtOnce    = HttpRspParser::RESULT_PENDING;
+        HttpRspParser::Result   resultSegmented = HttpRspParser::RESULT_PENDING;
+        size_t                  indexAtOnce     = 0U;
+        size_t                  indexSegmented  = 0U;
+        uint32_t                mutations       = 1U + (nextRandom() % 8U);
+        uint8_t                 idx             = 0U;
+
+        len = strlen(RESPONSE);
+        memcpy(data, RESPONSE, len);
+
+        while(0U < mutations)
+        {
+            size_t  pos         = nextRandom() % len;
+            char    c           = ALPHABET[nextRandom() % (sizeof(ALPHABET) - 1U)];
+            uint32_t operation  = nextRandom() % 3U;
+
+            /* Replace */
+            if (0U == operation)
+            {
+                data[pos] = c;
+            }
+            /* Insert */
+            else if ((1U == operation) && (MAX_LEN > len))
+            {
+                memmove(&data[pos + 1U], &data[pos], len - pos);
+                data[pos] = c;
+                ++len;
+            }
+            /* Remove */
+            else if (1U < len)
+            {
+                memmove(&data[pos], &data[pos + 1U], len - pos - 1U);
+                --len;
+            }
+
+            --mutations;
+        }
+
+        resultAtOnce    = parseAtOnce(parserAtOnce, data, len, indexAtOnce);
+        resultSegmented = parseSegmented(parserSegmented, data, len, 0U, indexSegmented);
+
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(len, indexAtOnce);
+        TEST_ASSERT_EQUAL(resultAtOnce, resultSegmented);
+
+        if (HttpRspParser::RESULT_COMPLETE == resultAtOnce)
+        {
+            TEST_ASSERT_EQUAL_UINT32(indexAtOnce, indexSegmented);
+            TEST_ASSERT_EQUAL_STRING(parserAtOnce.getHttpVersion(), parserSegmented.getHttpVersion());
+            TEST_ASSERT_EQUAL_UINT16(parserAtOnce.getStatusCode(), parserSegmented.getStatusCode());
+            TEST_ASSERT_EQUAL_STRING(parserAtOnce.getReasonPhrase(), parserSegmented.getReasonPhrase());
+            TEST_ASSERT_EQUAL_UINT8(parserAtOnce.getHeaderCount(), parserSegmented.getHeaderCount());
+
+            for(idx = 0U; idx < parserAtOnce.getHeaderCount(); ++idx)
+            {
+                TEST_ASSERT_EQUAL_STRING(parserAtOnce.getHeaderName(idx), parserSegmented.getHeaderName(idx));
+                TEST_ASSERT_EQUAL_STRING(parserAtOnce.getHeaderValue(idx), parserSegmented.getHeaderValue(idx));
+            }
+
+            ++completed;
+        }
+        else if (HttpRspParser::RESULT_ERROR == resultAtOnce)
+        {
+            ++failed;
+        }
+    }
+
+    printf("Fuzz: %u runs, %u complete, %u errors, %u pending\n",
+        FUZZ_RUNS, completed, failed, FUZZ_RUNS - completed - failed);
+
+    return;
+}
+
+/**
+ * Benchmark: Parse a typical response at once and in TCP segments.
+ */
+static void testBenchmark()
+{
+    HttpRspParser   parser;
+    size_t          len         = strlen(RESPONSE);
+    size_t          index       = 0U;
+    uint32_t        run         = 0U;
+    uint32_t        timestamp   = 0U;
+    uint32_t        atOnce      = 0U;
+    uint32_t        byteByByte  = 0U;
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseAtOnce(parser, RESPONSE, len, index));
+    }
+    atOnce = millis() - timestamp;
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        TEST_ASSERT_EQUAL(HttpRspParser::RESULT_COMPLETE, parseSegmented(parser, RESPONSE, len, 1U, index));
+    }
+    byteByByte = millis() - timestamp;
+
+    printf("%u byte header, %u runs: at once %u ms, byte by byte %u ms\n",
+        static_cast<uint32_t>(len), BENCHMARK_RUNS, atOnce, byteByByte);
+
+    return;
+}
+
+/**
+ * Parse the whole data at once.
+ *
+ * @param[in] parser    Parser
+ * @param[in] data      Response data
+ * @param[in] len       Response data size in byte
+ * @param[out] index    Data index after parsing
+ *
+ * @return Parse result
+ */
+static HttpRspParser::Result parseAtOnce(HttpRspParser& parser, const char* data, size_t len, size_t& index)
+{
+    index = 0U;
+    parser.reset();
+
+    return parser.parse(data, len, index);
+}
+
+/**
+ * Parse the data in segments of the given sizes, like received TCP segments.
+ * A segment size of 0 means a random size between 1 and 64 byte.
+ *
+ * @param[in] parser        Parser
+ * @param[in] data          Response data
+ * @param[in] len           Response data size in byte
+ * @param[in] segmentSize   Segment size in byte
+ * @param[out] index        Data index after parsing
+ *
+ * @return Parse result
+ */
+static HttpRspParser::Result parseSegmented(HttpRspParser& parser, const char* data, size_t len, size_t segmentSize, size_t& index)
+{
+    HttpRspParser::Result   result  = HttpRspParser::RESULT_PENDING;
+    size_t                  offset  = 0U;
+
+    parser.reset();
+    index = len;
+
+    while((len > offset) && (HttpRspParser::RESULT_PENDING == result))
+    {
+        size_t size         = (0U == segmentSize) ? (1U + (nextRandom() % 64U)) : segmentSize;
+        size_t segmentIndex = 0U;
+
+        if ((len - offset) < size)
+        {
+            size = len - offset;
+        }
+
+        result = parser.parse(&data[offset], size, segmentIndex);
+
+        /* The parser shall never read beyond the segment. */
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(size, segmentIndex);
+
+        if (HttpRspParser::RESULT_PENDING == result)
+        {
+            TEST_ASSERT_EQUAL_UINT32(size, segmentIndex);
+        }
+        else
+        {
+            index = offset + segmentIndex;
+        }
+
+        offset += size;
+    }
+
+    return result;
+}
+
+/**
+ * Get the next pseudo random number (linear congruential generator),
+ * to get reproducible fuzz test data.
+ *
+ * @return Pseudo random number
+ */
+static uint32_t nextRandom()
+{
+    gRandomState = (gRandomState * 1103515245U) + 12345U;
+
+    return (gRandomState >> 16U) & 0x7fffU;
+}
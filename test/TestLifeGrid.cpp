@@ -0,0 +1,432 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Game of life grid tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestLifeGrid.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <Arduino.h>
+#include <LifeGrid.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/**
+ * Reference game of life with two grids, which evaluates every cell by
+ * counting its neighbours one by one, like the game of life plugin did it.
+ */
+class RefGrid
+{
+public:
+
+    /**
+     * Constructs the reference grid.
+     *
+     * @param[in] width     Grid width in cells
+     * @param[in] height    Grid height in cells
+     */
+    RefGrid(uint16_t width, uint16_t height) :
+        m_width(width),
+        m_height(height)
+    {
+        m_cells[0] = new bool[width * height]();
+        m_cells[1] = new bool[width * height]();
+    }
+
+    /**
+     * Destroys the reference grid.
+     */
+    ~RefGrid()
+    {
+        delete[] m_cells[0];
+        delete[] m_cells[1];
+    }
+
+    /**
+     * Get cell state, considering the wrap around.
+     *
+     * @param[in] gridId    Grid id
+     * @param[in] x         x-coordinate of cell
+     * @param[in] y         y-coordinate of cell
+     *
+     * @return Alive (true) or dead (false).
+     */
+    bool getCell(uint8_t gridId, int32_t x, int32_t y) const
+    {
+        x = (x + m_width) % m_width;
+        y = (y + m_height) % m_height;
+
+        return m_cells[gridId][x + (y * m_width)];
+    }
+
+    /**
+     * Set cell state.
+     *
+     * @param[in] gridId    Grid id
+     * @param[in] x         x-coordinate of cell
+     * @param[in] y         y-coordinate of cell
+     * @param[in] isAlive   Alive (true) or dead (false).
+     */
+    void setCell(uint8_t gridId, int32_t x, int32_t y, bool isAlive)
+    {
+        m_cells[gridId][x + (y * m_width)] = isAlive;
+    }
+
+    /**
+     * Calculate the next generation from the given grid into the other one.
+     *
+     * @param[in] gridId    Grid id of the current generation
+     */
+    void step(uint8_t gridId)
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+
+        for(y = 0; y < m_height; ++y)
+        {
+            for(x = 0; x < m_width; ++x)
+            {
+                uint8_t count   = 0U;
+                int32_t dX      = 0;
+                int32_t dY      = 0;
+                bool    isAlive = getCell(gridId, x, y);
+
+                for(dY = -1; dY <= 1; ++dY)
+                {
+                    for(dX = -1; dX <= 1; ++dX)
+                    {
+                        if (((0 != dX) || (0 != dY)) &&
+                            (true == getCell(gridId, x + dX, y + dY)))
+                        {
+                            ++count;
+                        }
+                    }
+                }
+
+                setCell(1U - gridId, x, y, (3U == count) || ((true == isAlive) && (2U == count)));
+            }
+        }
+    }
+
+private:
+
+    int32_t m_width;        /**< Grid width in cells */
+    int32_t m_height;       /**< Grid height in cells */
+    bool*   m_cells[2];     /**< Two grids with one cell per element */
+
+    RefGrid(const RefGrid& grid);
+    RefGrid& operator=(const RefGrid& grid);
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testPatterns();
+static void testReference();
+static void testBenchmark();
+static uint32_t nextRandom();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Seed of the pseudo random number generator */
+static uint32_t gSeed = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the game of life grid, incl. a generation step benchmark.
+ */
+extern void testLifeGrid()
+{
+    testPatterns();
+    testReference();
+    testBenchmark();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test well-known patterns and the cycle detection.
+ */
+static void testPatterns()
+{
+    LifeGrid    grid;
+    uint8_t     gen     = 0U;
+
+    TEST_ASSERT_FALSE(grid.isCreated());
+    TEST_ASSERT_FALSE(grid.create(0U, 8U));
+    TEST_ASSERT_TRUE(grid.create(40U, 8U));
+    TEST_ASSERT_TRUE(grid.isCreated());
+    TEST_ASSERT_EQUAL_UINT16(2U, grid.getWordsPerRow());
+
+    /* Cells outside the grid width stay dead. */
+    grid.setWord(0U, 1U, UINT32_MAX);
+    TEST_ASSERT_EQUAL_HEX32(0x000000ffU, grid.getWord(0U, 1U));
+    grid.clear();
+
+    /* Block: still life */
+    grid.setCell(1U, 1U, true);
+    grid.setCell(2U, 1U, true);
+    grid.setCell(1U, 2U, true);
+    grid.setCell(2U, 2U, true);
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(1U, grid.getPeriod());
+    TEST_ASSERT_EQUAL_HEX32(0U, grid.getChangedWord(1U, 0U));
+
+    /* Blinker across the word border and the vertical wrap around: period 2 */
+    grid.clear();
+    grid.setCell(31U, 7U, true);
+    grid.setCell(31U, 0U, true);
+    grid.setCell(31U, 1U, true);
+    grid.step();
+    TEST_ASSERT_TRUE(grid.getCell(30U, 0U));
+    TEST_ASSERT_TRUE(grid.getCell(31U, 0U));
+    TEST_ASSERT_TRUE(grid.getCell(32U, 0U));
+    TEST_ASSERT_FALSE(grid.getCell(31U, 7U));
+    TEST_ASSERT_EQUAL_HEX32(0xc0000000U, grid.getChangedWord(0U, 0U) | grid.getChangedWord(7U, 0U));
+    TEST_ASSERT_EQUAL_HEX32(0x00000001U, grid.getChangedWord(0U, 1U));
+    TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(2U, grid.getPeriod());
+
+    /* Blinker across the horizontal wrap around */
+    grid.clear();
+    grid.setCell(39U, 4U, true);
+    grid.setCell(0U, 4U, true);
+    grid.setCell(1U, 4U, true);
+    grid.step();
+    TEST_ASSERT_TRUE(grid.getCell(0U, 3U));
+    TEST_ASSERT_TRUE(grid.getCell(0U, 4U));
+    TEST_ASSERT_TRUE(grid.getCell(0U, 5U));
+    TEST_ASSERT_FALSE(grid.getCell(39U, 4U));
+    TEST_ASSERT_FALSE(grid.getCell(1U, 4U));
+
+    /* Glider: Moves one cell diagonal every 4 generations, no cycle within the history. */
+    grid.clear();
+    grid.setCell(1U, 0U, true);
+    grid.setCell(2U, 1U, true);
+    grid.setCell(0U, 2U, true);
+    grid.setCell(1U, 2U, true);
+    grid.setCell(2U, 2U, true);
+    for(gen = 0U; gen < LifeGrid::HASH_HISTORY; ++gen)
+    {
+        grid.step();
+        TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+    }
+    TEST_ASSERT_TRUE(grid.getCell(5U, 4U));
+    TEST_ASSERT_TRUE(grid.getCell(6U, 5U));
+    TEST_ASSERT_TRUE(grid.getCell(4U, 6U));
+    TEST_ASSERT_TRUE(grid.getCell(5U, 6U));
+    TEST_ASSERT_TRUE(grid.getCell(6U, 6U));
+
+    /* Changing a cell restarts the cycle detection. */
+    grid.clear();
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+    grid.step();
+    TEST_ASSERT_EQUAL_UINT8(1U, grid.getPeriod());
+    grid.setCell(0U, 0U, false);
+    TEST_ASSERT_EQUAL_UINT8(0U, grid.getPeriod());
+
+    grid.destroy();
+    TEST_ASSERT_FALSE(grid.isCreated());
+
+    return;
+}
+
+/**
+ * Compare random grids of different sizes over several generations with
+ * the cell by cell reference implementation.
+ */
+static void testReference()
+{
+    const uint16_t  SIZES[][2]  =
+    {
+        { 1U, 1U }, { 3U, 1U }, { 5U, 3U }, { 31U, 7U }, { 32U, 8U }, { 33U, 9U }, { 64U, 64U }, { 70U, 5U }, { 320U, 4U }
+    };
+    const uint8_t   GENERATIONS = 24U;
+    uint8_t         sizeIdx     = 0U;
+
+    gSeed = 12345U;
+
+    for(sizeIdx = 0U; sizeIdx < (sizeof(SIZES) / sizeof(SIZES[0])); ++sizeIdx)
+    {
+        uint16_t    width   = SIZES[sizeIdx][0];
+        uint16_t    height  = SIZES[sizeIdx][1];
+        LifeGrid    grid;
+        RefGrid     ref(width, height);
+        uint16_t    x       = 0U;
+        uint16_t    y       = 0U;
+        uint8_t     gen     = 0U;
+
+        TEST_ASSERT_TRUE(grid.create(width, height));
+
+        for(y = 0U; y < height; ++y)
+        {
+            for(x = 0U; x < width; ++x)
+            {
+                bool isAlive = (0U == (nextRandom() % 3U));
+
+                grid.setCell(x, y, isAlive);
+                ref.setCell(0U, x, y, isAlive);
+            }
+        }
+
+        for(gen = 0U; gen < GENERATIONS; ++gen)
+        {
+            uint8_t refGridId = gen % 2U;
+
+            grid.step();
+            ref.step(refGridId);
+
+            for(y = 0U; y < height; ++y)
+            {
+                for(x = 0U; x < width; ++x)
+                {
+                    bool isAlive    = ref.getCell(1U - refGridId, x, y);
+                    bool isChanged  = (isAlive != ref.getCell(refGridId, x, y));
+                    bool isMarked   = (0U != (grid.getChangedWord(y, x / LifeGrid::BITS) & (1U << (x % LifeGrid::BITS))));
+
+                    TEST_ASSERT_EQUAL(isAlive, grid.getCell(x, y));
+                    TEST_ASSERT_EQUAL(isChanged, isMarked);
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * Benchmark the word parallel generation step against the cell by cell
+ * reference implementation on a 64x64 panel.
+ */
+static void testBenchmark()
+{
+    const uint16_t  WIDTH           = 64U;
+    const uint16_t  HEIGHT          = 64U;
+    const uint32_t  GENERATIONS     = 2000U;
+    LifeGrid        grid;
+    RefGrid         ref(WIDTH, HEIGHT);
+    uint16_t        x               = 0U;
+    uint16_t        y               = 0U;
+    uint32_t        gen             = 0U;
+    uint32_t        timestamp       = 0U;
+    uint32_t        gridDuration    = 0U;
+    uint32_t        refDuration     = 0U;
+
+    gSeed = 4711U;
+
+    TEST_ASSERT_TRUE(grid.create(WIDTH, HEIGHT));
+
+    for(y = 0U; y < HEIGHT; ++y)
+    {
+        for(x = 0U; x < WIDTH; ++x)
+        {
+            bool isAlive = (0U == (nextRandom() % 2U));
+
+            grid.setCell(x, y, isAlive);
+            ref.setCell(0U, x, y, isAlive);
+        }
+    }
+
+    timestamp = millis();
+    for(gen = 0U; gen < GENERATIONS; ++gen)
+    {
+        grid.step();
+    }
+    gridDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(gen = 0U; gen < GENERATIONS; ++gen)
+    {
+        ref.step(gen % 2U);
+    }
+    refDuration = millis() - timestamp;
+
+    /* Both must end in the same generation. */
+    for(y = 0U; y < HEIGHT; ++y)
+    {
+        for(x = 0U; x < WIDTH; ++x)
+        {
+            TEST_ASSERT_EQUAL(ref.getCell(GENERATIONS % 2U, x, y), grid.getCell(x, y));
+        }
+    }
+
+    printf("%ux%u cells, %u generations: word parallel %u ms, cell by cell %u ms\n",
+        WIDTH, HEIGHT, GENERATIONS, gridDuration, refDuration);
+
+    return;
+}
+
+/**
+ * Get the next pseudo random number (linear congruential generator).
+ *
+ * @return Random number
+ */
+static uint32_t nextRandom()
+{
+    gSeed = (gSeed * 1103515245U) + 12345U;
+
+    return gSeed >> 8U;
+}
\ No newline at end of file
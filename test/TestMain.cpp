@@ -50,6 +50,21 @@
 #include "TestLogging.h"
 #include "TestUtil.h"
 #include "TestBmpImgLoader.h"
+#include "TestGfxBenchmark.h"
+#include "TestFadeBlend.h"
+#include "TestFramebufferCodec.h"
+#include "TestFrameSnapshot.h"
+#include "TestStatisticHistogram.h"
+#include "TestRawImgLoader.h"
+#include "TestPayloadBuffer.h"
+#include "TestHttpRspParser.h"
+#include "TestPrefixTree.h"
+#include "TestLifeGrid.h"
+#include "TestRealFft.h"
+#include "TestOverlapFrameBuffer.h"
+#include "TestSeqLock.h"
+#include "TestSlot.h"
+#include "TestTextRun.h"
 
 /******************************************************************************
  * Macros
@@ -99,6 +114,21 @@ int main(int argc, char **argv)
     RUN_TEST(testProgressBar);
     RUN_TEST(testLogging);
     RUN_TEST(testUtil);
+    RUN_TEST(testGfxBenchmark);
+    RUN_TEST(testFadeBlend);
+    RUN_TEST(testFramebufferCodec);
+    RUN_TEST(testFrameSnapshot);
+    RUN_TEST(testStatisticHistogram);
+    RUN_TEST(testRawImgLoader);
+    RUN_TEST(testPayloadBuffer);
+    RUN_TEST(testHttpRspParser);
+    RUN_TEST(testPrefixTree);
+    RUN_TEST(testLifeGrid);
+    RUN_TEST(testRealFft);
+    RUN_TEST(testOverlapFrameBuffer);
+    RUN_TEST(testSeqLock);
+    RUN_TEST(testSlot);
+    RUN_TEST(testTextRun);
 
     return UNITY_END();
 }
@@ -0,0 +1,331 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Overlapping audio frame buffer tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestOverlapFrameBuffer.h"
+
+#include <unity.h>
+#include <math.h>
+#include <OverlapFrameBuffer.hpp>
+#include <RealFft.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/**
+ * Stand-in for the I2S driver, which provides DMA blocks with a synthetic
+ * signal. The samples are provided like the INMP441 microphone does it:
+ * 24 bit, MSB aligned in 32 bit.
+ */
+class SyntheticI2s
+{
+public:
+
+    /** Signal type */
+    enum Signal
+    {
+        SIGNAL_RAMP = 0,    /**< Sample value is the sample index, incl. negative values. */
+        SIGNAL_SINE         /**< Sine with a frequency in the middle of a frequency bin. */
+    };
+
+    /**
+     * Constructs the synthetic I2S driver.
+     *
+     * @param[in] signal    Signal type
+     */
+    SyntheticI2s(Signal signal) :
+        m_signal(signal),
+        m_sampleIdx(0U)
+    {
+    }
+
+    /**
+     * Read a DMA block, like i2s_read() does it.
+     *
+     * @param[out] block    DMA block
+     * @param[in] count     Number of samples to read
+     */
+    void read(int32_t* block, size_t count)
+    {
+        size_t idx = 0U;
+
+        for(idx = 0U; idx < count; ++idx)
+        {
+            block[idx] = static_cast<int32_t>(static_cast<uint32_t>(getSample(m_sampleIdx)) << SAMPLE_SHIFT);
+            ++m_sampleIdx;
+        }
+    }
+
+    /**
+     * Get the 24 bit value of a sample.
+     *
+     * @param[in] sampleIdx Sample index
+     *
+     * @return Sample value
+     */
+    int32_t getSample(uint32_t sampleIdx) const
+    {
+        int32_t value = 0;
+
+        if (SIGNAL_RAMP == m_signal)
+        {
+            value = static_cast<int32_t>(sampleIdx) - 1000;
+        }
+        else
+        {
+            value = static_cast<int32_t>(SINE_AMPLITUDE * sin((TWO_PI * SINE_BIN * sampleIdx) / FRAME_SIZE));
+        }
+
+        return value;
+    }
+
+    /** Shift of the 24 bit sample in the 32 bit word. */
+    static const uint8_t    SAMPLE_SHIFT    = 8U;
+
+    /** Frame size, which is the number of samples per FFT. */
+    static const uint16_t   FRAME_SIZE      = 512U;
+
+    /** Frequency bin of the sine signal. */
+    static const uint16_t   SINE_BIN        = 40U;
+
+    /** Amplitude of the sine signal. */
+    static constexpr const double SINE_AMPLITUDE = 420426.0;
+
+    /** 2 * pi */
+    static constexpr const double TWO_PI    = 6.283185307179586;
+
+private:
+
+    Signal      m_signal;       /**< Signal type */
+    uint32_t    m_sampleIdx;    /**< Index of the next sample */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testContinuousFrames(size_t blockSize);
+static void testPendingFrame();
+static void testSpectrum();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Frame buffer type under test */
+typedef OverlapFrameBuffer<SyntheticI2s::FRAME_SIZE> FrameBuffer;
+
+/** Frame buffer under test */
+static FrameBuffer                      gFrameBuffer;
+
+/** FFT, which transforms the frames */
+static RealFft<SyntheticI2s::FRAME_SIZE> gFft;
+
+/** FFT result */
+static float                            gAmplitudes[SyntheticI2s::FRAME_SIZE / 2U];
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the overlapping audio frame buffer, fed by a synthetic I2S driver.
+ */
+extern void testOverlapFrameBuffer()
+{
+    testContinuousFrames(64U);
+    testContinuousFrames(37U);
+    testPendingFrame();
+    testSpectrum();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Every frame contains the expected samples and overlaps by half with the
+ * previous frame, independent of the DMA block size.
+ *
+ * @param[in] blockSize Number of samples per DMA block
+ */
+static void testContinuousFrames(size_t blockSize)
+{
+    const uint32_t  BLOCKS      = 100U;
+    SyntheticI2s    i2s(SyntheticI2s::SIGNAL_RAMP);
+    int32_t         block[64U];
+    uint32_t        blockIdx    = 0U;
+    uint32_t        frameCnt    = 0U;
+
+    TEST_ASSERT_TRUE(sizeof(block) / sizeof(block[0]) >= blockSize);
+
+    gFrameBuffer.clear();
+    TEST_ASSERT_FALSE(gFrameBuffer.isFrameReady());
+    TEST_ASSERT_NULL(gFrameBuffer.getFrame());
+    TEST_ASSERT_EQUAL(0U, gFrameBuffer.write(nullptr, blockSize, SyntheticI2s::SAMPLE_SHIFT));
+
+    for(blockIdx = 0U; blockIdx < BLOCKS; ++blockIdx)
+    {
+        size_t idx = 0U;
+
+        i2s.read(block, blockSize);
+
+        while(blockSize > idx)
+        {
+            idx += gFrameBuffer.write(&block[idx], blockSize - idx, SyntheticI2s::SAMPLE_SHIFT);
+
+            if (true == gFrameBuffer.isFrameReady())
+            {
+                const float*    frame       = gFrameBuffer.getFrame();
+                uint32_t        firstSample = frameCnt * FrameBuffer::HOP_SIZE;
+                uint16_t        sampleIdx   = 0U;
+
+                for(sampleIdx = 0U; sampleIdx < SyntheticI2s::FRAME_SIZE; ++sampleIdx)
+                {
+                    TEST_ASSERT_FLOAT_WITHIN(0.0f, static_cast<float>(i2s.getSample(firstSample + sampleIdx)), frame[sampleIdx]);
+                }
+
+                gFrameBuffer.releaseFrame();
+                ++frameCnt;
+            }
+        }
+    }
+
+    /* The first frame needs a full frame, every further frame only a hop. */
+    TEST_ASSERT_EQUAL_UINT32(((BLOCKS * blockSize) - SyntheticI2s::FRAME_SIZE) / FrameBuffer::HOP_SIZE + 1U, frameCnt);
+
+    return;
+}
+
+/**
+ * As long as a complete frame is not released, it stays untouched and
+ * the samples are collected in the other frame buffer.
+ */
+static void testPendingFrame()
+{
+    SyntheticI2s    i2s(SyntheticI2s::SIGNAL_RAMP);
+    static int32_t  block[SyntheticI2s::FRAME_SIZE];
+    const float*    frame       = nullptr;
+    uint16_t        sampleIdx   = 0U;
+    size_t          written     = 0U;
+
+    gFrameBuffer.clear();
+
+    i2s.read(block, SyntheticI2s::FRAME_SIZE);
+    TEST_ASSERT_EQUAL(SyntheticI2s::FRAME_SIZE, gFrameBuffer.write(block, SyntheticI2s::FRAME_SIZE, SyntheticI2s::SAMPLE_SHIFT));
+    TEST_ASSERT_TRUE(gFrameBuffer.isFrameReady());
+    frame = gFrameBuffer.getFrame();
+
+    /* The next frame can be filled up, but not completed. */
+    i2s.read(block, FrameBuffer::HOP_SIZE);
+    written = gFrameBuffer.write(block, FrameBuffer::HOP_SIZE, SyntheticI2s::SAMPLE_SHIFT);
+    TEST_ASSERT_EQUAL(FrameBuffer::HOP_SIZE - 1U, written);
+    TEST_ASSERT_EQUAL(0U, gFrameBuffer.write(&block[written], 1U, SyntheticI2s::SAMPLE_SHIFT));
+    TEST_ASSERT_TRUE(frame == gFrameBuffer.getFrame());
+
+    for(sampleIdx = 0U; sampleIdx < SyntheticI2s::FRAME_SIZE; ++sampleIdx)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.0f, static_cast<float>(i2s.getSample(sampleIdx)), frame[sampleIdx]);
+    }
+
+    /* After release, the next frame completes. */
+    gFrameBuffer.releaseFrame();
+    TEST_ASSERT_EQUAL(1U, gFrameBuffer.write(&block[written], 1U, SyntheticI2s::SAMPLE_SHIFT));
+    TEST_ASSERT_TRUE(gFrameBuffer.isFrameReady());
+    frame = gFrameBuffer.getFrame();
+
+    for(sampleIdx = 0U; sampleIdx < SyntheticI2s::FRAME_SIZE; ++sampleIdx)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.0f, static_cast<float>(i2s.getSample(FrameBuffer::HOP_SIZE + sampleIdx)), frame[sampleIdx]);
+    }
+
+    return;
+}
+
+/**
+ * Every frame of a continuous sine signal is transformed in place and
+ * results in the sine amplitude in the sine frequency bin.
+ */
+static void testSpectrum()
+{
+    SyntheticI2s    i2s(SyntheticI2s::SIGNAL_SINE);
+    int32_t         block[64U];
+    uint32_t        blockIdx    = 0U;
+    uint32_t        frameCnt    = 0U;
+
+    gFrameBuffer.clear();
+
+    for(blockIdx = 0U; blockIdx < 64U; ++blockIdx)
+    {
+        size_t idx = 0U;
+
+        i2s.read(block, 64U);
+
+        while(64U > idx)
+        {
+            idx += gFrameBuffer.write(&block[idx], 64U - idx, SyntheticI2s::SAMPLE_SHIFT);
+
+            if (true == gFrameBuffer.isFrameReady())
+            {
+                gFft.computeAmplitudes(gFrameBuffer.getFrame(), gAmplitudes);
+                gFrameBuffer.releaseFrame();
+                ++frameCnt;
+
+                TEST_ASSERT_FLOAT_WITHIN(SyntheticI2s::SINE_AMPLITUDE * 0.01, SyntheticI2s::SINE_AMPLITUDE, gAmplitudes[SyntheticI2s::SINE_BIN]);
+                TEST_ASSERT_LESS_THAN(static_cast<int32_t>(SyntheticI2s::SINE_AMPLITUDE * 0.01), static_cast<int32_t>(gAmplitudes[SyntheticI2s::SINE_BIN / 2U]));
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(15U, frameCnt);
+
+    return;
+}
\ No newline at end of file
@@ -0,0 +1,333 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Payload buffer tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestPayloadBuffer.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <PayloadBuffer.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testBasics();
+static void testChunkedResponse();
+static uint32_t feed(PayloadBuffer& buffer, const uint8_t* body);
+static size_t feedExtend(const uint8_t* body);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Response body size in byte */
+static const size_t     BODY_SIZE       = 32U * 1024U;
+
+/** TCP segment size in byte (default MSS) */
+static const size_t     SEGMENT_SIZE    = 536U;
+
+/** Chunk size in byte of the chunked transfer coding */
+static const size_t     CHUNK_SIZE      = 2000U;
+
+/** Number of benchmark runs */
+static const uint32_t   BENCHMARK_RUNS  = 200U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the payload buffer, incl. a benchmark with a chunked response in TCP segments.
+ */
+extern void testPayloadBuffer()
+{
+    testBasics();
+    testChunkedResponse();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the basic behaviour.
+ */
+static void testBasics()
+{
+    PayloadBuffer   buffer;
+    const uint8_t   DATA[]  = { 1U, 2U, 3U, 4U };
+    size_t          idx     = 0U;
+
+    /* Empty */
+    TEST_ASSERT_NULL(buffer.getData());
+    TEST_ASSERT_EQUAL(0U, buffer.getSize());
+    TEST_ASSERT_EQUAL(0U, buffer.getCapacity());
+    TEST_ASSERT_FALSE(buffer.append(nullptr, 1U));
+
+    /* The first append allocates the min. capacity. */
+    TEST_ASSERT_TRUE(buffer.append(DATA, sizeof(DATA)));
+    TEST_ASSERT_EQUAL(sizeof(DATA), buffer.getSize());
+    TEST_ASSERT_EQUAL(PayloadBuffer::MIN_CAPACITY, buffer.getCapacity());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(DATA, buffer.getData(), sizeof(DATA));
+
+    /* Fill it completely, without reallocation. */
+    for(idx = sizeof(DATA); idx < PayloadBuffer::MIN_CAPACITY; idx += sizeof(DATA))
+    {
+        TEST_ASSERT_TRUE(buffer.append(DATA, sizeof(DATA)));
+    }
+
+    TEST_ASSERT_EQUAL(PayloadBuffer::MIN_CAPACITY, buffer.getSize());
+    TEST_ASSERT_EQUAL(PayloadBuffer::MIN_CAPACITY, buffer.getCapacity());
+
+    /* The capacity is doubled and the data is kept. */
+    TEST_ASSERT_TRUE(buffer.append(DATA, 1U));
+    TEST_ASSERT_EQUAL(PayloadBuffer::MIN_CAPACITY + 1U, buffer.getSize());
+    TEST_ASSERT_EQUAL(2U * PayloadBuffer::MIN_CAPACITY, buffer.getCapacity());
+
+    for(idx = 0U; idx < buffer.getSize(); ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT8(DATA[idx % sizeof(DATA)], buffer.getData()[idx]);
+    }
+
+    /* A smaller reservation is ignored. */
+    TEST_ASSERT_TRUE(buffer.reserve(1U));
+    TEST_ASSERT_EQUAL(2U * PayloadBuffer::MIN_CAPACITY, buffer.getCapacity());
+
+    /* A copy contains only the used part. */
+    {
+        PayloadBuffer copy(buffer);
+
+        TEST_ASSERT_EQUAL(buffer.getSize(), copy.getSize());
+        TEST_ASSERT_EQUAL(buffer.getSize(), copy.getCapacity());
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(buffer.getData(), copy.getData(), buffer.getSize());
+    }
+
+    buffer.clear();
+    TEST_ASSERT_NULL(buffer.getData());
+    TEST_ASSERT_EQUAL(0U, buffer.getSize());
+    TEST_ASSERT_EQUAL(0U, buffer.getCapacity());
+
+    /* A reservation is exact. */
+    TEST_ASSERT_TRUE(buffer.reserve(1000U));
+    TEST_ASSERT_EQUAL(1000U, buffer.getCapacity());
+    TEST_ASSERT_EQUAL(0U, buffer.getSize());
+
+    return;
+}
+
+/**
+ * Feed a chunked response body in TCP segments and count the reallocations.
+ * Without the Content-Length, the buffer grows geometrically. With it, the
+ * buffer is reserved once. As reference, the buffer is extended by every
+ * segment, like before.
+ */
+static void testChunkedResponse()
+{
+    PayloadBuffer   buffer;
+    PayloadBuffer   reserved;
+    uint8_t*        body                = new uint8_t[BODY_SIZE];
+    uint32_t        reallocations       = 0U;
+    uint32_t        timestamp           = 0U;
+    uint32_t        geometricDuration   = 0U;
+    uint32_t        reservedDuration    = 0U;
+    uint32_t        extendDuration      = 0U;
+    size_t          idx                 = 0U;
+    uint32_t        run                 = 0U;
+
+    TEST_ASSERT_NOT_NULL(body);
+
+    for(idx = 0U; idx < BODY_SIZE; ++idx)
+    {
+        body[idx] = static_cast<uint8_t>(idx * 7U);
+    }
+
+    /* Geometric growth */
+    reallocations = feed(buffer, body);
+    TEST_ASSERT_EQUAL(BODY_SIZE, buffer.getSize());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(body, buffer.getData(), BODY_SIZE);
+
+    /* 256 byte up to 32 KB */
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(8U, reallocations);
+
+    /* Reserved by the Content-Length */
+    TEST_ASSERT_TRUE(reserved.reserve(BODY_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0U, feed(reserved, body));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(body, reserved.getData(), BODY_SIZE);
+
+    /* Benchmark */
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        buffer.clear();
+        (void)feed(buffer, body);
+    }
+    geometricDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        reserved.clear();
+        (void)reserved.reserve(BODY_SIZE);
+        (void)feed(reserved, body);
+    }
+    reservedDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        TEST_ASSERT_EQUAL(BODY_SIZE, feedExtend(body));
+    }
+    extendDuration = millis() - timestamp;
+
+    printf("%u byte body in %u byte segments, %u runs: extend by segment %u ms, geometric %u ms (%u reallocations), reserved %u ms\n",
+        static_cast<uint32_t>(BODY_SIZE), static_cast<uint32_t>(SEGMENT_SIZE), BENCHMARK_RUNS, extendDuration, geometricDuration, reallocations, reservedDuration);
+
+    delete[] body;
+
+    return;
+}
+
+/**
+ * Feed the body as chunked transfer coding in TCP segments to the buffer.
+ *
+ * @param[in] buffer    Payload buffer
+ * @param[in] body      Body with BODY_SIZE bytes
+ *
+ * @return Number of reallocations
+ */
+static uint32_t feed(PayloadBuffer& buffer, const uint8_t* body)
+{
+    uint32_t    reallocations   = 0U;
+    size_t      index           = 0U;
+
+    /* Every segment contains parts of one or two chunks. The chunk framing
+     * is not stored in the payload, therefore only the chunk data is fed.
+     */
+    while(BODY_SIZE > index)
+    {
+        size_t segmentSize  = BODY_SIZE - index;
+        size_t chunkRest    = CHUNK_SIZE - (index % CHUNK_SIZE);
+        size_t capacity     = buffer.getCapacity();
+
+        if (SEGMENT_SIZE < segmentSize)
+        {
+            segmentSize = SEGMENT_SIZE;
+        }
+
+        if (chunkRest < segmentSize)
+        {
+            (void)buffer.append(&body[index], chunkRest);
+            (void)buffer.append(&body[index + chunkRest], segmentSize - chunkRest);
+        }
+        else
+        {
+            (void)buffer.append(&body[index], segmentSize);
+        }
+
+        if (capacity != buffer.getCapacity())
+        {
+            ++reallocations;
+        }
+
+        index += segmentSize;
+    }
+
+    return reallocations;
+}
+
+/**
+ * Feed the body like the payload buffer was handled before: it is extended
+ * by every segment and every extension copies the whole payload.
+ *
+ * @param[in] body      Body with BODY_SIZE bytes
+ *
+ * @return Payload size in byte
+ */
+static size_t feedExtend(const uint8_t* body)
+{
+    uint8_t*    payload = nullptr;
+    size_t      size    = 0U;
+    size_t      index   = 0U;
+
+    while(BODY_SIZE > index)
+    {
+        size_t      segmentSize = BODY_SIZE - index;
+        uint8_t*    tmp         = payload;
+
+        if (SEGMENT_SIZE < segmentSize)
+        {
+            segmentSize = SEGMENT_SIZE;
+        }
+
+        payload = new uint8_t[size + segmentSize];
+
+        if (nullptr != tmp)
+        {
+            memcpy(payload, tmp, size);
+            delete[] tmp;
+        }
+
+        memcpy(&payload[size], &body[index], segmentSize);
+        size += segmentSize;
+        index += segmentSize;
+    }
+
+    delete[] payload;
+
+    return size;
+}
\ No newline at end of file
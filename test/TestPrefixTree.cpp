@@ -0,0 +1,319 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Prefix tree tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestPrefixTree.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <PrefixTree.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testBasics();
+static void testRouteBenchmark();
+static uint16_t findLinear(const String* routes, const String& url);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Base URI of the plugin topics */
+static const char*      BASE_URI        = "/rest/api/v1/display/";
+
+/** Plugin topics */
+static const char*      TOPICS[]        = { "/text", "/bitmap", "/lamps" };
+
+/** Number of installed plugins */
+static const uint16_t   PLUGIN_COUNT    = 24U;
+
+/** Number of routes, every topic by UID and by alias */
+static const uint16_t   ROUTE_COUNT     = PLUGIN_COUNT * (sizeof(TOPICS) / sizeof(TOPICS[0])) * 2U;
+
+/** Number of benchmark runs */
+static const uint32_t   BENCHMARK_RUNS  = 2000U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the prefix tree, incl. a route lookup benchmark with many plugins.
+ */
+extern void testPrefixTree()
+{
+    testBasics();
+    testRouteBenchmark();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the basic behaviour.
+ */
+static void testBasics()
+{
+    PrefixTree<int>     tree;
+    int                 value       = 0;
+    uint16_t            nodeCount   = 0U;
+
+    /* Empty */
+    TEST_ASSERT_EQUAL_UINT16(0U, tree.getCount());
+    TEST_ASSERT_FALSE(tree.find("a", value));
+    TEST_ASSERT_FALSE(tree.find(nullptr, value));
+    TEST_ASSERT_FALSE(tree.remove("a"));
+    TEST_ASSERT_FALSE(tree.insert("", 1));
+    TEST_ASSERT_FALSE(tree.insert(nullptr, 1));
+
+    /* Keys, which are prefixes of each other */
+    TEST_ASSERT_TRUE(tree.insert("/uid/1/text", 1));
+    TEST_ASSERT_TRUE(tree.insert("/uid/1", 2));
+    TEST_ASSERT_TRUE(tree.insert("/uid/12/text", 3));
+    TEST_ASSERT_TRUE(tree.insert("/alias/clock/text", 4));
+    TEST_ASSERT_EQUAL_UINT16(4U, tree.getCount());
+
+    TEST_ASSERT_TRUE(tree.find("/uid/1/text", value));
+    TEST_ASSERT_EQUAL_INT(1, value);
+    TEST_ASSERT_TRUE(tree.find("/uid/1", value));
+    TEST_ASSERT_EQUAL_INT(2, value);
+    TEST_ASSERT_TRUE(tree.find("/uid/12/text", value));
+    TEST_ASSERT_EQUAL_INT(3, value);
+    TEST_ASSERT_TRUE(tree.find("/alias/clock/text", value));
+    TEST_ASSERT_EQUAL_INT(4, value);
+
+    /* Only complete keys are found. */
+    TEST_ASSERT_FALSE(tree.find("/uid/", value));
+    TEST_ASSERT_FALSE(tree.find("/uid/1/tex", value));
+    TEST_ASSERT_FALSE(tree.find("/uid/1/texts", value));
+    TEST_ASSERT_FALSE(tree.find("/uid/2/text", value));
+
+    /* Overwrite */
+    TEST_ASSERT_TRUE(tree.insert("/uid/1", 5));
+    TEST_ASSERT_EQUAL_UINT16(4U, tree.getCount());
+    TEST_ASSERT_TRUE(tree.find("/uid/1", value));
+    TEST_ASSERT_EQUAL_INT(5, value);
+
+    /* Removing a prefix key keeps the longer keys. */
+    nodeCount = tree.getNodeCount();
+    TEST_ASSERT_TRUE(tree.remove("/uid/1"));
+    TEST_ASSERT_FALSE(tree.remove("/uid/1"));
+    TEST_ASSERT_EQUAL_UINT16(nodeCount, tree.getNodeCount());
+    TEST_ASSERT_FALSE(tree.find("/uid/1", value));
+    TEST_ASSERT_TRUE(tree.find("/uid/1/text", value));
+    TEST_ASSERT_TRUE(tree.find("/uid/12/text", value));
+
+    /* Removing a longer key releases only its own nodes. */
+    TEST_ASSERT_TRUE(tree.remove("/alias/clock/text"));
+    TEST_ASSERT_EQUAL_UINT16(nodeCount - strlen("alias/clock/text"), tree.getNodeCount());
+    TEST_ASSERT_TRUE(tree.find("/uid/1/text", value));
+
+    /* Released nodes are reused. */
+    nodeCount = tree.getNodeCount();
+    TEST_ASSERT_TRUE(tree.insert("/alias/clock/text", 6));
+    TEST_ASSERT_TRUE(tree.remove("/alias/clock/text"));
+    TEST_ASSERT_EQUAL_UINT16(nodeCount, tree.getNodeCount());
+    TEST_ASSERT_TRUE(tree.insert("/alias/weather/text", 7));
+    TEST_ASSERT_TRUE(tree.find("/alias/weather/text", value));
+    TEST_ASSERT_EQUAL_INT(7, value);
+    TEST_ASSERT_EQUAL_UINT16(3U, tree.getCount());
+
+    /* Remove all, only the root node stays. */
+    TEST_ASSERT_TRUE(tree.remove("/uid/1/text"));
+    TEST_ASSERT_TRUE(tree.remove("/uid/12/text"));
+    TEST_ASSERT_TRUE(tree.remove("/alias/weather/text"));
+    TEST_ASSERT_EQUAL_UINT16(0U, tree.getCount());
+    TEST_ASSERT_EQUAL_UINT16(1U, tree.getNodeCount());
+
+    tree.clear();
+    TEST_ASSERT_EQUAL_UINT16(0U, tree.getNodeCount());
+    TEST_ASSERT_TRUE(tree.insert("x", 8));
+    TEST_ASSERT_TRUE(tree.find("x", value));
+    TEST_ASSERT_EQUAL_INT(8, value);
+
+    return;
+}
+
+/**
+ * Benchmark the route lookup of all plugin topics, registered by UID and by
+ * alias, against a linear search, like the webserver checks its handlers.
+ */
+static void testRouteBenchmark()
+{
+    PrefixTree<uint16_t>    tree;
+    String*                 routes          = new String[ROUTE_COUNT];
+    uint16_t                routeIdx        = 0U;
+    uint16_t                plugin          = 0U;
+    uint16_t                topic           = 0U;
+    uint32_t                run             = 0U;
+    uint32_t                timestamp       = 0U;
+    uint32_t                treeDuration    = 0U;
+    uint32_t                linearDuration  = 0U;
+    uint32_t                found           = 0U;
+
+    TEST_ASSERT_NOT_NULL(routes);
+
+    for(plugin = 0U; plugin < PLUGIN_COUNT; ++plugin)
+    {
+        char uid[8];
+        char alias[16];
+
+        (void)snprintf(uid, sizeof(uid), "%u", 1000U + (plugin * 37U));
+        (void)snprintf(alias, sizeof(alias), "plugin%u", plugin);
+
+        for(topic = 0U; topic < (sizeof(TOPICS) / sizeof(TOPICS[0])); ++topic)
+        {
+            routes[routeIdx] = BASE_URI;
+            routes[routeIdx] += "uid/";
+            routes[routeIdx] += uid;
+            routes[routeIdx] += TOPICS[topic];
+            TEST_ASSERT_TRUE(tree.insert(routes[routeIdx].c_str(), routeIdx));
+            ++routeIdx;
+
+            routes[routeIdx] = BASE_URI;
+            routes[routeIdx] += "alias/";
+            routes[routeIdx] += alias;
+            routes[routeIdx] += TOPICS[topic];
+            TEST_ASSERT_TRUE(tree.insert(routes[routeIdx].c_str(), routeIdx));
+            ++routeIdx;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(ROUTE_COUNT, routeIdx);
+    TEST_ASSERT_EQUAL_UINT16(ROUTE_COUNT, tree.getCount());
+
+    /* Every route is found with its own value. */
+    for(routeIdx = 0U; routeIdx < ROUTE_COUNT; ++routeIdx)
+    {
+        uint16_t value = UINT16_MAX;
+
+        TEST_ASSERT_TRUE(tree.find(routes[routeIdx].c_str(), value));
+        TEST_ASSERT_EQUAL_UINT16(routeIdx, value);
+        TEST_ASSERT_EQUAL_UINT16(routeIdx, findLinear(routes, routes[routeIdx]));
+    }
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        for(routeIdx = 0U; routeIdx < ROUTE_COUNT; ++routeIdx)
+        {
+            uint16_t value = UINT16_MAX;
+
+            if (true == tree.find(routes[routeIdx].c_str(), value))
+            {
+                ++found;
+            }
+        }
+    }
+    treeDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(run = 0U; run < BENCHMARK_RUNS; ++run)
+    {
+        for(routeIdx = 0U; routeIdx < ROUTE_COUNT; ++routeIdx)
+        {
+            if (ROUTE_COUNT > findLinear(routes, routes[routeIdx]))
+            {
+                ++found;
+            }
+        }
+    }
+    linearDuration = millis() - timestamp;
+
+    TEST_ASSERT_EQUAL_UINT32(2U * BENCHMARK_RUNS * ROUTE_COUNT, found);
+
+    printf("%u plugins, %u routes (%u nodes), %u lookups: prefix tree %u ms, linear %u ms\n",
+        PLUGIN_COUNT, ROUTE_COUNT, tree.getNodeCount(), BENCHMARK_RUNS * ROUTE_COUNT, treeDuration, linearDuration);
+
+    delete[] routes;
+
+    return;
+}
+
+/**
+ * Find the route by checking all routes one after another, like the
+ * webserver does it for its handlers.
+ *
+ * @param[in] routes    Routes
+ * @param[in] url       Requested URL
+ *
+ * @return Route index or ROUTE_COUNT if not found.
+ */
+static uint16_t findLinear(const String* routes, const String& url)
+{
+    uint16_t routeIdx = 0U;
+
+    while(ROUTE_COUNT > routeIdx)
+    {
+        String subUri = routes[routeIdx];
+
+        subUri += '/';
+
+        if ((routes[routeIdx] == url) ||
+            (0U != url.startsWith(subUri)))
+        {
+            break;
+        }
+
+        ++routeIdx;
+    }
+
+    return routeIdx;
+}
\ No newline at end of file
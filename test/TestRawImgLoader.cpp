@@ -0,0 +1,311 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Raw image loader tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestRawImgLoader.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <Arduino.h>
+#include <FS.h>
+#include <BmpImgLoader.h>
+#include <RawImgLoader.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static size_t getFileSize(const char* fileName);
+static void fillBitmap(YAGfxDynamicBitmap& bitmap, uint32_t colorMask);
+static void checkBitmap(const YAGfxDynamicBitmap& expected, const YAGfxDynamicBitmap& actual);
+static void benchmarkRawImgLoader();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Temporary raw image file. */
+static const char*  RAW_IMAGE       = "./test/test.raw";
+
+/** Raw image header size in bytes. */
+static const size_t RAW_HEADER_SIZE = 16U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the raw image loader and the bitmap image cache.
+ */
+extern void testRawImgLoader()
+{
+    RawImgLoader        rawLoader;
+    BmpImgLoader        bmpLoader;
+    FS                  localFileSystem;
+    YAGfxDynamicBitmap  bitmap;
+    YAGfxDynamicBitmap  rawBitmap;
+    const uint16_t      SIZE    = 64U;
+
+    /* Cache file name */
+    TEST_ASSERT_EQUAL_STRING("/images/hum.raw", RawImgLoader::getCacheFileName("/images/hum.bmp").c_str());
+    TEST_ASSERT_EQUAL_STRING("/config.d/icon.raw", RawImgLoader::getCacheFileName("/config.d/icon").c_str());
+
+    /* Nothing to save */
+    TEST_ASSERT_FALSE(rawLoader.save(localFileSystem, RAW_IMAGE, 1U, bitmap));
+
+    /* File not found */
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_FILE_NOT_FOUND, rawLoader.load(localFileSystem, "./test/notExisting.raw", 1U, rawBitmap));
+
+    /* Not a raw image */
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_FILE_FORMAT_UNSUPPORTED, rawLoader.load(localFileSystem, "./test/test24bpp.bmp", 1U, rawBitmap));
+    TEST_ASSERT_FALSE(rawBitmap.isAllocated());
+
+    /* Small image with a few colors, which is stored without palette,
+     * because the palette would need more space.
+     */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.load(localFileSystem, "./test/test24bpp.bmp", bitmap));
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 1U, bitmap));
+    TEST_ASSERT_EQUAL_UINT32(RAW_HEADER_SIZE + 2U * 2U * 3U, getFileSize(RAW_IMAGE));
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 1U, rawBitmap));
+    checkBitmap(bitmap, rawBitmap);
+
+    /* Created from a different source */
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_FILE_OUTDATED, rawLoader.load(localFileSystem, RAW_IMAGE, 2U, rawBitmap));
+    TEST_ASSERT_FALSE(rawBitmap.isAllocated());
+
+    /* Larger image with 48 colors is stored palettized. */
+    bitmap.release();
+    TEST_ASSERT_TRUE(bitmap.create(SIZE, SIZE));
+    fillBitmap(bitmap, 0x00c0c0c0U);
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 3U, bitmap));
+    TEST_ASSERT_EQUAL_UINT32(RAW_HEADER_SIZE + 48U * 3U + SIZE * SIZE, getFileSize(RAW_IMAGE));
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 3U, rawBitmap));
+    checkBitmap(bitmap, rawBitmap);
+
+    /* Larger image with more than 256 colors is stored without palette. */
+    fillBitmap(bitmap, 0x00ffffffU);
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 4U, bitmap));
+    TEST_ASSERT_EQUAL_UINT32(RAW_HEADER_SIZE + SIZE * SIZE * 3U, getFileSize(RAW_IMAGE));
+    TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 4U, rawBitmap));
+    checkBitmap(bitmap, rawBitmap);
+
+    (void)remove(RAW_IMAGE);
+
+    /* The bitmap image is decoded the first time and afterwards it is loaded from the cache. */
+    (void)remove("./test/test24bpp.raw");
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.loadCached(localFileSystem, "./test/test24bpp.bmp", bitmap));
+    TEST_ASSERT_NOT_EQUAL(0U, getFileSize("./test/test24bpp.raw"));
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.loadCached(localFileSystem, "./test/test24bpp.bmp", rawBitmap));
+    checkBitmap(bitmap, rawBitmap);
+    (void)remove("./test/test24bpp.raw");
+
+    /* File not found */
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_FILE_NOT_FOUND, bmpLoader.loadCached(localFileSystem, "./test/notExisting.bmp", bitmap));
+
+    benchmarkRawImgLoader();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Get file size.
+ *
+ * @param[in] fileName  Name of the file
+ *
+ * @return File size in bytes. If the file doesn't exist, it will return 0.
+ */
+static size_t getFileSize(const char* fileName)
+{
+    size_t  fileSize    = 0U;
+    FILE*   fd          = fopen(fileName, "rb");
+
+    if (nullptr != fd)
+    {
+        if (0 == fseek(fd, 0, SEEK_END))
+        {
+            fileSize = static_cast<size_t>(ftell(fd));
+        }
+
+        fclose(fd);
+    }
+
+    return fileSize;
+}
+
+/**
+ * Fill the bitmap with a pattern, which has as many different colors as the
+ * color mask allows.
+ *
+ * @param[in] bitmap    Bitmap buffer
+ * @param[in] colorMask Color mask in RGB24 format
+ */
+static void fillBitmap(YAGfxDynamicBitmap& bitmap, uint32_t colorMask)
+{
+    int16_t x = 0;
+    int16_t y = 0;
+
+    for(y = 0; y < bitmap.getHeight(); ++y)
+    {
+        for(x = 0; x < bitmap.getWidth(); ++x)
+        {
+            uint32_t color = (static_cast<uint32_t>(x) * 0x00040301U) + (static_cast<uint32_t>(y) * 0x00010305U);
+
+            bitmap.drawPixel(x, y, color & colorMask);
+        }
+    }
+}
+
+/**
+ * Check whether both bitmaps are equal.
+ *
+ * @param[in] expected  Expected bitmap
+ * @param[in] actual    Actual bitmap
+ */
+static void checkBitmap(const YAGfxDynamicBitmap& expected, const YAGfxDynamicBitmap& actual)
+{
+    int16_t x = 0;
+    int16_t y = 0;
+
+    TEST_ASSERT_EQUAL_UINT16(expected.getWidth(), actual.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(expected.getHeight(), actual.getHeight());
+
+    for(y = 0; y < expected.getHeight(); ++y)
+    {
+        for(x = 0; x < expected.getWidth(); ++x)
+        {
+            TEST_ASSERT_EQUAL_UINT32(expected.getColor(x, y), actual.getColor(x, y));
+        }
+    }
+}
+
+/**
+ * Compare the time to load a weather icon from the bitmap file and from
+ * the raw image file. Additional the raw image loading of a large image
+ * is measured.
+ */
+static void benchmarkRawImgLoader()
+{
+    RawImgLoader        rawLoader;
+    BmpImgLoader        bmpLoader;
+    FS                  localFileSystem;
+    YAGfxDynamicBitmap  bitmap;
+    const char*         ICON        = "./data/images/01d.bmp";
+    const uint32_t      ICON_LOADS  = 2000U;
+    const uint32_t      LARGE_LOADS = 200U;
+    const uint16_t      LARGE_SIZE  = 64U;
+    uint32_t            idx         = 0U;
+    uint32_t            timestamp   = 0U;
+    uint32_t            bmpDuration = 0U;
+    uint32_t            rawDuration = 0U;
+
+    TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.load(localFileSystem, ICON, bitmap));
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 1U, bitmap));
+
+    timestamp = millis();
+    for(idx = 0U; idx < ICON_LOADS; ++idx)
+    {
+        TEST_ASSERT_EQUAL(BmpImgLoader::RET_OK, bmpLoader.load(localFileSystem, ICON, bitmap));
+    }
+    bmpDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(idx = 0U; idx < ICON_LOADS; ++idx)
+    {
+        TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 1U, bitmap));
+    }
+    rawDuration = millis() - timestamp;
+
+    printf("icon %ux%u: %u loads, bmp %u ms (%u bytes), raw %u ms (%u bytes)\n",
+        bitmap.getWidth(),
+        bitmap.getHeight(),
+        ICON_LOADS,
+        bmpDuration,
+        static_cast<uint32_t>(getFileSize(ICON)),
+        rawDuration,
+        static_cast<uint32_t>(getFileSize(RAW_IMAGE)));
+
+    /* Large image, palettized and not palettized. */
+    bitmap.release();
+    TEST_ASSERT_TRUE(bitmap.create(LARGE_SIZE, LARGE_SIZE));
+    fillBitmap(bitmap, 0x00c0c0c0U);
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 1U, bitmap));
+
+    timestamp = millis();
+    for(idx = 0U; idx < LARGE_LOADS; ++idx)
+    {
+        TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 1U, bitmap));
+    }
+    rawDuration = millis() - timestamp;
+
+    printf("%ux%u palettized: %u loads, raw %u ms (%u bytes)\n",
+        LARGE_SIZE, LARGE_SIZE, LARGE_LOADS, rawDuration, static_cast<uint32_t>(getFileSize(RAW_IMAGE)));
+
+    fillBitmap(bitmap, 0x00ffffffU);
+    TEST_ASSERT_TRUE(rawLoader.save(localFileSystem, RAW_IMAGE, 1U, bitmap));
+
+    timestamp = millis();
+    for(idx = 0U; idx < LARGE_LOADS; ++idx)
+    {
+        TEST_ASSERT_EQUAL(RawImgLoader::RET_OK, rawLoader.load(localFileSystem, RAW_IMAGE, 1U, bitmap));
+    }
+    rawDuration = millis() - timestamp;
+
+    printf("%ux%u rgb888: %u loads, raw %u ms (%u bytes)\n",
+        LARGE_SIZE, LARGE_SIZE, LARGE_LOADS, rawDuration, static_cast<uint32_t>(getFileSize(RAW_IMAGE)));
+
+    (void)remove(RAW_IMAGE);
+}
\ No newline at end of file
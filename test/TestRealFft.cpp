@@ -0,0 +1,366 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Real-valued FFT tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestRealFft.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <Arduino.h>
+#include <RealFft.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testSmall();
+static void testSine();
+static void testReference();
+static void testBenchmark();
+static void fillSamples(float* samples);
+static void computeRefAmplitudes(const float* samples, double* amplitudes);
+static uint32_t nextRandom();
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Number of samples, like the spectrum analyzer uses. */
+static const uint16_t   SAMPLES     = 512U;
+
+/** 2 * pi */
+static const double     TWO_PI      = 6.283185307179586;
+
+/** FFT under test */
+static RealFft<SAMPLES> gFft;
+
+/** Samples, used as FFT working buffer */
+static float            gSamples[SAMPLES];
+
+/** FFT result */
+static float            gAmplitudes[SAMPLES / 2U];
+
+/** Seed of the pseudo random number generator */
+static uint32_t         gSeed       = 0U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the real-valued FFT, incl. a benchmark against a double precision FFT.
+ */
+extern void testRealFft()
+{
+    testSmall();
+    testSine();
+    testReference();
+    testBenchmark();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the smallest possible FFT with known results.
+ */
+static void testSmall()
+{
+    RealFft<4U> fft;
+    float       data[4U];
+    float       amplitudes[RealFft<4U>::FREQ_BINS];
+
+    /* Constant signal, weighted by the hamming window with 4 samples: 0.08, 0.77, 0.77, 0.08
+     * X[0] = 1.7
+     * X[1] = 0.08 - 0.77i - 0.77 + 0.08i = -0.69 - 0.69i
+     */
+    data[0] = 1.0f;
+    data[1] = 1.0f;
+    data[2] = 1.0f;
+    data[3] = 1.0f;
+    fft.computeAmplitudes(data, amplitudes);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 1.7f / (4.0f * 0.54f), amplitudes[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.0001f, 2.0f * 0.69f * sqrtf(2.0f) / (4.0f * 0.54f), amplitudes[1]);
+
+    /* Invalid parameters are ignored. */
+    fft.computeAmplitudes(nullptr, amplitudes);
+    fft.computeAmplitudes(data, nullptr);
+
+    return;
+}
+
+/**
+ * A sinusoidal signal, which fits exactly into a frequency bin, results in
+ * its amplitude in this bin.
+ */
+static void testSine()
+{
+    const float     AMPLITUDE   = 420426.0f;
+    const uint16_t  SINE_BIN    = 37U;
+    uint16_t        idx         = 0U;
+
+    for(idx = 0U; idx < SAMPLES; ++idx)
+    {
+        gSamples[idx] = AMPLITUDE * static_cast<float>(sin((TWO_PI * SINE_BIN * idx) / SAMPLES));
+    }
+
+    gFft.computeAmplitudes(gSamples, gAmplitudes);
+
+    TEST_ASSERT_FLOAT_WITHIN(AMPLITUDE * 0.01f, AMPLITUDE, gAmplitudes[SINE_BIN]);
+
+    /* Hamming window leaks only into the direct neighbours. */
+    for(idx = 0U; idx < (SAMPLES / 2U); ++idx)
+    {
+        if ((SINE_BIN - 1U > idx) || (SINE_BIN + 1U < idx))
+        {
+            TEST_ASSERT_LESS_THAN(static_cast<int32_t>(AMPLITUDE * 0.01f), static_cast<int32_t>(gAmplitudes[idx]));
+        }
+    }
+
+    return;
+}
+
+/**
+ * Compare with the double precision reference for signals with random noise.
+ */
+static void testReference()
+{
+    double      refAmplitudes[SAMPLES / 2U];
+    uint8_t     run     = 0U;
+    uint16_t    idx     = 0U;
+
+    gSeed = 42U;
+
+    for(run = 0U; run < 10U; ++run)
+    {
+        fillSamples(gSamples);
+        computeRefAmplitudes(gSamples, refAmplitudes);
+        gFft.computeAmplitudes(gSamples, gAmplitudes);
+
+        for(idx = 0U; idx < (SAMPLES / 2U); ++idx)
+        {
+            /* Single precision: Relative to the full scale of the 24 bit samples. */
+            TEST_ASSERT_FLOAT_WITHIN(8.0f, static_cast<float>(refAmplitudes[idx]), gAmplitudes[idx]);
+        }
+    }
+
+    return;
+}
+
+/**
+ * Benchmark the single precision real-valued FFT against the double
+ * precision complex reference.
+ */
+static void testBenchmark()
+{
+    const uint32_t  RUNS            = 2000U;
+    static double   refAmplitudes[SAMPLES / 2U];
+    static float    input[SAMPLES];
+    uint32_t        run             = 0U;
+    uint32_t        timestamp       = 0U;
+    uint32_t        fftDuration     = 0U;
+    uint32_t        refDuration     = 0U;
+
+    gSeed = 4711U;
+    fillSamples(input);
+
+    timestamp = millis();
+    for(run = 0U; run < RUNS; ++run)
+    {
+        memcpy(gSamples, input, sizeof(input));
+        gFft.computeAmplitudes(gSamples, gAmplitudes);
+    }
+    fftDuration = millis() - timestamp;
+
+    timestamp = millis();
+    for(run = 0U; run < RUNS; ++run)
+    {
+        computeRefAmplitudes(input, refAmplitudes);
+    }
+    refDuration = millis() - timestamp;
+
+    TEST_ASSERT_FLOAT_WITHIN(8.0f, static_cast<float>(refAmplitudes[10U]), gAmplitudes[10U]);
+
+    printf("%u samples, %u FFTs: float real-valued %u ms, double complex %u ms\n",
+        SAMPLES, RUNS, fftDuration, refDuration);
+
+    return;
+}
+
+/**
+ * Fill the samples with a mix of two sine signals and noise, in the range
+ * of the 24 bit microphone samples.
+ *
+ * @param[out] samples  Samples
+ */
+static void fillSamples(float* samples)
+{
+    uint16_t idx = 0U;
+
+    for(idx = 0U; idx < SAMPLES; ++idx)
+    {
+        int32_t noise = static_cast<int32_t>(nextRandom() % 200000U) - 100000;
+
+        samples[idx]  = static_cast<float>(3000000.0 * sin((TWO_PI * 12.3 * idx) / SAMPLES));
+        samples[idx] += static_cast<float>(500000.0 * sin((TWO_PI * 101.7 * idx) / SAMPLES));
+        samples[idx] += static_cast<float>(noise);
+    }
+
+    return;
+}
+
+/**
+ * Reference spectrum analysis in double precision, like the arduinoFFT does
+ * it: Window, complex FFT over all samples, magnitude and rescaling of every
+ * bin with a division.
+ *
+ * @param[in] samples       Samples
+ * @param[out] amplitudes   Amplitudes per frequency bin
+ */
+static void computeRefAmplitudes(const float* samples, double* amplitudes)
+{
+    static double   real[SAMPLES];
+    static double   imag[SAMPLES];
+    uint16_t        idx     = 0U;
+    uint16_t        j       = 0U;
+    uint16_t        len     = 0U;
+
+    for(idx = 0U; idx < SAMPLES; ++idx)
+    {
+        real[idx] = samples[idx] * (0.54 - (0.46 * cos((TWO_PI * idx) / (SAMPLES - 1U))));
+        imag[idx] = 0.0;
+    }
+
+    /* Bit reversal */
+    for(idx = 1U; idx < SAMPLES; ++idx)
+    {
+        uint16_t bit = SAMPLES >> 1U;
+
+        while(0U != (j & bit))
+        {
+            j ^= bit;
+            bit >>= 1U;
+        }
+        j |= bit;
+
+        if (idx < j)
+        {
+            double tmp = real[idx];
+
+            real[idx]   = real[j];
+            real[j]     = tmp;
+        }
+    }
+
+    /* Twiddle factors by recurrence, instead of calling the trigonometric
+     * functions for every butterfly.
+     */
+    for(len = 2U; len <= SAMPLES; len <<= 1U)
+    {
+        double  stepRe  = cos(TWO_PI / len);
+        double  stepIm  = -sin(TWO_PI / len);
+        double  wRe     = 1.0;
+        double  wIm     = 0.0;
+
+        for(j = 0U; j < (len / 2U); ++j)
+        {
+            uint16_t    start   = 0U;
+            double      tmp     = 0.0;
+
+            for(start = 0U; start < SAMPLES; start += len)
+            {
+                uint16_t    top     = start + j;
+                uint16_t    bottom  = top + (len / 2U);
+                double      tRe     = (wRe * real[bottom]) - (wIm * imag[bottom]);
+                double      tIm     = (wRe * imag[bottom]) + (wIm * real[bottom]);
+
+                real[bottom]    = real[top] - tRe;
+                imag[bottom]    = imag[top] - tIm;
+                real[top]       += tRe;
+                imag[top]       += tIm;
+            }
+
+            tmp = (wRe * stepRe) - (wIm * stepIm);
+            wIm = (wRe * stepIm) + (wIm * stepRe);
+            wRe = tmp;
+        }
+    }
+
+    for(idx = 0U; idx < (SAMPLES / 2U); ++idx)
+    {
+        amplitudes[idx] = sqrt((real[idx] * real[idx]) + (imag[idx] * imag[idx]));
+        amplitudes[idx] /= SAMPLES * 0.54;
+
+        if (0U < idx)
+        {
+            amplitudes[idx] *= 2.0;
+        }
+    }
+}
+
+/**
+ * Get the next pseudo random number (linear congruential generator).
+ *
+ * @return Random number
+ */
+static uint32_t nextRandom()
+{
+    gSeed = (gSeed * 1103515245U) + 12345U;
+
+    return gSeed >> 8U;
+}
\ No newline at end of file
@@ -0,0 +1,321 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Lock-free single writer channel tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestSeqLock.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <thread>
+#include <atomic>
+#include <Arduino.h>
+#include <SeqLock.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/** Number of levels in a value, like the octave bands of the spectrum analyzer. */
+static const uint8_t    VALUE_LEVELS    = 16U;
+
+/**
+ * Value, which is passed through the channel. Like the octave bands of the
+ * spectrum analyzer, it is too large to be copied atomically.
+ */
+struct Value
+{
+    float       levels[VALUE_LEVELS];   /**< Every level contains the write number. */
+    uint32_t    number;                 /**< Write number */
+};
+
+/**
+ * Result of a single reader in the stress test.
+ */
+struct ReaderResult
+{
+    uint32_t    reads;          /**< Number of reads, which provided a new value */
+    uint32_t    tornValues;     /**< Number of values, which contain parts of different writes */
+    uint32_t    outOfOrder;     /**< Number of values, which are older than the previous read one */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testBasics();
+static void testStress();
+static void fillValue(Value& value, uint32_t number);
+static uint32_t writerTask(SeqLock<Value>* channel, uint32_t duration, std::atomic<bool>* isDone);
+static void readerTask(const SeqLock<Value>* channel, std::atomic<uint8_t>* started, std::atomic<bool>* isDone, ReaderResult* result);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Number of readers in the stress test. */
+static const uint8_t    READERS         = 2U;
+
+/** Stress test duration in ms. */
+static const uint32_t   STRESS_DURATION = 500U;
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the lock-free single writer channel, incl. a stress test with concurrent readers.
+ */
+extern void testSeqLock()
+{
+    testBasics();
+    testStress();
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the single threaded behaviour.
+ */
+static void testBasics()
+{
+    SeqLock<Value>  channel;
+    Value           value;
+    uint8_t         idx     = 0U;
+
+    /* Nothing published yet */
+    TEST_ASSERT_EQUAL_UINT32(0U, channel.getSequence());
+    TEST_ASSERT_EQUAL_UINT32(0U, channel.read(value));
+
+    fillValue(value, 1U);
+    channel.write(value);
+    TEST_ASSERT_EQUAL_UINT32(1U, channel.getSequence());
+
+    fillValue(value, 0U);
+    TEST_ASSERT_EQUAL_UINT32(1U, channel.read(value));
+    TEST_ASSERT_EQUAL_UINT32(1U, value.number);
+
+    for(idx = 0U; idx < VALUE_LEVELS; ++idx)
+    {
+        TEST_ASSERT_FLOAT_WITHIN(0.0f, 1.0f, value.levels[idx]);
+    }
+
+    /* Only the latest value is provided. */
+    fillValue(value, 2U);
+    channel.write(value);
+    fillValue(value, 3U);
+    channel.write(value);
+
+    fillValue(value, 0U);
+    TEST_ASSERT_EQUAL_UINT32(3U, channel.getSequence());
+    TEST_ASSERT_EQUAL_UINT32(3U, channel.read(value));
+    TEST_ASSERT_EQUAL_UINT32(3U, value.number);
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, 3.0f, value.levels[VALUE_LEVELS - 1U]);
+
+    /* Reading doesn't consume the value. */
+    TEST_ASSERT_EQUAL_UINT32(3U, channel.read(value));
+
+    return;
+}
+
+/**
+ * Stress test with a single writer and concurrent readers.
+ * Every value is filled with its write number, so a reader can detect
+ * torn values.
+ */
+static void testStress()
+{
+    SeqLock<Value>          channel;
+    std::atomic<bool>       isDone(false);
+    std::atomic<uint8_t>    started(0U);
+    ReaderResult            results[READERS];
+    std::thread*            readers[READERS];
+    uint8_t                 idx         = 0U;
+    uint32_t                totalReads  = 0U;
+    uint32_t                writes      = 0U;
+
+    for(idx = 0U; idx < READERS; ++idx)
+    {
+        results[idx].reads      = 0U;
+        results[idx].tornValues = 0U;
+        results[idx].outOfOrder = 0U;
+
+        readers[idx] = new std::thread(readerTask, &channel, &started, &isDone, &results[idx]);
+    }
+
+    /* Wait until all readers are running, otherwise the writer may be finished before. */
+    while(READERS > started.load())
+    {
+        std::this_thread::yield();
+    }
+
+    writes = writerTask(&channel, STRESS_DURATION, &isDone);
+
+    for(idx = 0U; idx < READERS; ++idx)
+    {
+        readers[idx]->join();
+        delete readers[idx];
+
+        TEST_ASSERT_EQUAL_UINT32(0U, results[idx].tornValues);
+        TEST_ASSERT_EQUAL_UINT32(0U, results[idx].outOfOrder);
+
+        totalReads += results[idx].reads;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(writes, channel.getSequence());
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, totalReads);
+
+    printf("seqlock: %u values written, %u new values read by %u readers\n", writes, totalReads, READERS);
+
+    return;
+}
+
+/**
+ * Fill every part of the value with the write number.
+ *
+ * @param[out] value    Value
+ * @param[in] number    Write number
+ */
+static void fillValue(Value& value, uint32_t number)
+{
+    uint8_t idx = 0U;
+
+    for(idx = 0U; idx < VALUE_LEVELS; ++idx)
+    {
+        value.levels[idx] = static_cast<float>(number);
+    }
+
+    value.number = number;
+
+    return;
+}
+
+/**
+ * Writer, which publishes values filled with the write number.
+ *
+ * @param[in] channel   Channel
+ * @param[in] duration  Duration in ms, how long values shall be published.
+ * @param[out] isDone   Set, after the duration elapsed.
+ *
+ * @return Number of published values
+ */
+static uint32_t writerTask(SeqLock<Value>* channel, uint32_t duration, std::atomic<bool>* isDone)
+{
+    Value       value;
+    uint32_t    number  = 0U;
+    uint32_t    start   = millis();
+
+    /* Don't yield, the readers shall interrupt the writer at random positions. */
+    while(duration > (millis() - start))
+    {
+        ++number;
+
+        fillValue(value, number);
+        channel->write(value);
+    }
+
+    *isDone = true;
+
+    return number;
+}
+
+/**
+ * Reader, which checks every read value for consistency.
+ *
+ * @param[in] channel   Channel
+ * @param[out] started  Number of started readers
+ * @param[in] isDone    Stop reading, if set.
+ * @param[out] result   Reader result
+ */
+static void readerTask(const SeqLock<Value>* channel, std::atomic<uint8_t>* started, std::atomic<bool>* isDone, ReaderResult* result)
+{
+    Value       value;
+    uint32_t    lastSequence    = 0U;
+
+    ++(*started);
+
+    while(false == isDone->load())
+    {
+        uint32_t sequence = channel->read(value);
+
+        if (lastSequence != sequence)
+        {
+            uint8_t idx = 0U;
+
+            /* The sequence counts the writes, like the write number does. */
+            if (sequence != value.number)
+            {
+                ++result->tornValues;
+            }
+            else
+            {
+                for(idx = 0U; idx < VALUE_LEVELS; ++idx)
+                {
+                    if (static_cast<float>(value.number) != value.levels[idx])
+                    {
+                        ++result->tornValues;
+                        break;
+                    }
+                }
+            }
+
+            if (lastSequence > sequence)
+            {
+                ++result->outOfOrder;
+            }
+
+            lastSequence = sequence;
+            ++result->reads;
+        }
+    }
+
+    return;
+}
\ No newline at end of file
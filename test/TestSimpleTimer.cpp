@@ -107,6 +107,15 @@ extern void testSimpleTimer()
     TEST_ASSERT_FALSE(testTimer.isTimeout());
     testTimer.stop();
 
+    /* Remaining time */
+    TEST_ASSERT_EQUAL_UINT32(0U, testTimer.getRemainingTime());
+    testTimer.start(100000U);
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, testTimer.getRemainingTime());
+    TEST_ASSERT_FALSE(100000U < testTimer.getRemainingTime());
+    testTimer.start(0U);
+    TEST_ASSERT_EQUAL_UINT32(0U, testTimer.getRemainingTime());
+    testTimer.stop();
+
     return;
 }
 
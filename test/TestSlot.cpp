@@ -0,0 +1,368 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Display slot tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestSlot.h"
+
+#include <unity.h>
+#include <Arduino.h>
+#include <Slot.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+
+/**
+ * Plugin, which counts how often it is started and stopped.
+ */
+class TestPlugin : public IPluginMaintenance
+{
+public:
+
+    /**
+     * Constructs the test plugin.
+     *
+     * @param[in] uid   Unique id
+     */
+    TestPlugin(uint16_t uid) :
+        IPluginMaintenance(),
+        m_uid(uid),
+        m_slot(nullptr),
+        m_startCnt(0U),
+        m_stopCnt(0U)
+    {
+    }
+
+    /**
+     * Destroys the test plugin.
+     */
+    ~TestPlugin()
+    {
+    }
+
+    void setSlot(const ISlotPlugin* slotInterf) final
+    {
+        m_slot = slotInterf;
+    }
+
+    uint16_t getUID() const final
+    {
+        return m_uid;
+    }
+
+    void setAlias(const String& alias) final
+    {
+        (void)alias;
+    }
+
+    String getAlias() const final
+    {
+        return String();
+    }
+
+    void getTopics(JsonArray& topics) const final
+    {
+        (void)topics;
+    }
+
+    bool getTopic(const String& topic, JsonObject& value) const final
+    {
+        (void)topic;
+        (void)value;
+
+        return false;
+    }
+
+    bool setTopic(const String& topic, const JsonObject& value) final
+    {
+        (void)topic;
+        (void)value;
+
+        return false;
+    }
+
+    bool isUploadAccepted(const String& topic, const String& srcFilename, String& dstFilename) final
+    {
+        (void)topic;
+        (void)srcFilename;
+        (void)dstFilename;
+
+        return false;
+    }
+
+    const char* getName() const final
+    {
+        return "TestPlugin";
+    }
+
+    bool isEnabled() const final
+    {
+        return true;
+    }
+
+    void enable() final
+    {
+    }
+
+    void disable() final
+    {
+    }
+
+    void start(uint16_t width, uint16_t height) final
+    {
+        (void)width;
+        (void)height;
+
+        ++m_startCnt;
+    }
+
+    void stop() final
+    {
+        ++m_stopCnt;
+    }
+
+    void process() final
+    {
+    }
+
+    void active(YAGfx& gfx) final
+    {
+        (void)gfx;
+    }
+
+    void inactive() final
+    {
+    }
+
+    void update(YAGfx& gfx) final
+    {
+        (void)gfx;
+    }
+
+    uint32_t getUpdatePeriod() const final
+    {
+        return UPDATE_PERIOD_ALWAYS;
+    }
+
+    bool isUpdateRequired() const final
+    {
+        return false;
+    }
+
+    /**
+     * Get the slot interface, the plugin is plugged in.
+     *
+     * @return Slot interface
+     */
+    const ISlotPlugin* getSlot() const
+    {
+        return m_slot;
+    }
+
+    /**
+     * Get how often the plugin was started.
+     *
+     * @return Number of starts
+     */
+    uint32_t getStartCnt() const
+    {
+        return m_startCnt;
+    }
+
+    /**
+     * Get how often the plugin was stopped.
+     *
+     * @return Number of stops
+     */
+    uint32_t getStopCnt() const
+    {
+        return m_stopCnt;
+    }
+
+private:
+
+    uint16_t            m_uid;      /**< Unique id */
+    const ISlotPlugin*  m_slot;     /**< Slot interface */
+    uint32_t            m_startCnt; /**< Number of starts */
+    uint32_t            m_stopCnt;  /**< Number of stops */
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+static void activate(Slot& slot);
+static void uninstall(Slot& slot);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the display slot, especially the start state of a moved plugin.
+ */
+extern void testSlot()
+{
+    Slot        slotA;
+    Slot        slotB;
+    TestPlugin  started(1U);
+    TestPlugin  deferred(2U);
+
+    /* Plug in */
+    TEST_ASSERT_TRUE(slotA.isEmpty());
+    TEST_ASSERT_TRUE(slotA.setPlugin(&started));
+    TEST_ASSERT_TRUE(slotB.setPlugin(&deferred));
+    TEST_ASSERT_EQUAL_PTR(&slotA, started.getSlot());
+    TEST_ASSERT_FALSE(slotA.isStarted());
+    TEST_ASSERT_EQUAL_UINT32(0U, slotA.getFirstActivation());
+
+    /* Only the plugin in slot A is started and activated. */
+    activate(slotA);
+    TEST_ASSERT_TRUE(slotA.isStarted());
+    TEST_ASSERT_EQUAL_UINT32(123U, slotA.getStartDuration());
+    TEST_ASSERT_EQUAL_UINT32(1000U, slotA.getFirstActivation());
+    TEST_ASSERT_EQUAL_UINT32(1U, started.getStartCnt());
+
+    /* Move the started plugin: its start state moves with it. */
+    TEST_ASSERT_TRUE(slotB.swapPlugin(slotA));
+    TEST_ASSERT_EQUAL_PTR(&started, slotB.getPlugin());
+    TEST_ASSERT_EQUAL_PTR(&deferred, slotA.getPlugin());
+    TEST_ASSERT_EQUAL_PTR(&slotB, started.getSlot());
+    TEST_ASSERT_EQUAL_PTR(&slotA, deferred.getSlot());
+    TEST_ASSERT_TRUE(slotB.isStarted());
+    TEST_ASSERT_EQUAL_UINT32(123U, slotB.getStartDuration());
+    TEST_ASSERT_EQUAL_UINT32(1000U, slotB.getFirstActivation());
+    TEST_ASSERT_FALSE(slotA.isStarted());
+    TEST_ASSERT_EQUAL_UINT32(0U, slotA.getFirstActivation());
+
+    /* The moved plugin is not started again. */
+    activate(slotB);
+    TEST_ASSERT_EQUAL_UINT32(1U, started.getStartCnt());
+
+    /* Uninstall: the started plugin is stopped, the deferred one not. */
+    uninstall(slotB);
+    uninstall(slotA);
+    TEST_ASSERT_EQUAL_UINT32(1U, started.getStopCnt());
+    TEST_ASSERT_EQUAL_UINT32(0U, deferred.getStopCnt());
+    TEST_ASSERT_EQUAL_UINT32(0U, deferred.getStartCnt());
+    TEST_ASSERT_TRUE(slotA.isEmpty());
+    TEST_ASSERT_TRUE(slotB.isEmpty());
+    TEST_ASSERT_NULL(started.getSlot());
+
+    /* A new plugin in a slot is not started. */
+    TEST_ASSERT_TRUE(slotB.setPlugin(&started));
+    activate(slotB);
+    TEST_ASSERT_TRUE(slotB.setPlugin(&deferred));
+    TEST_ASSERT_FALSE(slotB.isStarted());
+    TEST_ASSERT_EQUAL_UINT32(0U, slotB.getFirstActivation());
+
+    /* A locked slot can not exchange its plugin. */
+    slotB.lock();
+    TEST_ASSERT_FALSE(slotA.swapPlugin(slotB));
+    TEST_ASSERT_FALSE(slotB.swapPlugin(slotA));
+    TEST_ASSERT_EQUAL_PTR(&deferred, slotB.getPlugin());
+    TEST_ASSERT_TRUE(slotA.isEmpty());
+    slotB.unlock();
+
+    /* Swap with an empty slot */
+    TEST_ASSERT_TRUE(slotA.swapPlugin(slotB));
+    TEST_ASSERT_EQUAL_PTR(&deferred, slotA.getPlugin());
+    TEST_ASSERT_TRUE(slotB.isEmpty());
+    TEST_ASSERT_EQUAL_PTR(&slotA, deferred.getSlot());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+
+/**
+ * Activate the plugin in the slot, like the display manager does:
+ * a plugin, whose start was deferred, is started on its first activation.
+ *
+ * @param[in] slot  Slot
+ */
+static void activate(Slot& slot)
+{
+    IPluginMaintenance* plugin = slot.getPlugin();
+
+    if (false == slot.isStarted())
+    {
+        plugin->start(32U, 8U);
+        slot.setStarted(123U);
+    }
+
+    slot.notifyActivation(1000U);
+}
+
+/**
+ * Uninstall the plugin in the slot, like the display manager does:
+ * only a started plugin is stopped.
+ *
+ * @param[in] slot  Slot
+ */
+static void uninstall(Slot& slot)
+{
+    IPluginMaintenance* plugin = slot.getPlugin();
+
+    if (true == slot.isStarted())
+    {
+        plugin->stop();
+    }
+
+    TEST_ASSERT_TRUE(slot.setPlugin(nullptr));
+}
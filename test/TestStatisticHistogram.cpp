@@ -0,0 +1,143 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Statistic histogram tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestStatisticHistogram.h"
+
+#include <unity.h>
+#include <StatisticHistogram.hpp>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/** Histogram under test: first limit 64, 4 buckets */
+typedef StatisticHistogram<uint32_t, 0U, 4U, 4U> TestHistogram;
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the statistic histogram.
+ */
+extern void testStatisticHistogram()
+{
+    TestHistogram   histogram(64U);
+    uint8_t         idx         = 0U;
+
+    /* Initial state */
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getCount());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getMin());
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getMax());
+
+    for(idx = 0U; idx < TestHistogram::BUCKET_CNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucketCount(idx));
+    }
+
+    /* Bucket limits double, the last bucket has no upper limit. */
+    TEST_ASSERT_EQUAL_UINT32(64U, histogram.getBucketLimit(0U));
+    TEST_ASSERT_EQUAL_UINT32(128U, histogram.getBucketLimit(1U));
+    TEST_ASSERT_EQUAL_UINT32(256U, histogram.getBucketLimit(2U));
+    TEST_ASSERT_EQUAL_UINT32(256U, histogram.getBucketLimit(3U));
+
+    /* Bucket borders: [0; 64) [64; 128) [128; 256) [256; inf) */
+    histogram.update(0U);
+    histogram.update(63U);
+    histogram.update(64U);
+    histogram.update(127U);
+    histogram.update(128U);
+    histogram.update(255U);
+    histogram.update(256U);
+    histogram.update(100000U);
+
+    TEST_ASSERT_EQUAL_UINT32(8U, histogram.getCount());
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucketCount(0U));
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucketCount(1U));
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucketCount(2U));
+    TEST_ASSERT_EQUAL_UINT32(2U, histogram.getBucketCount(3U));
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucketCount(4U));
+
+    /* The statistic value is still derived. */
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getMin());
+    TEST_ASSERT_EQUAL_UINT32(100000U, histogram.getMax());
+    TEST_ASSERT_EQUAL_UINT32(100000U, histogram.getCurrent());
+
+    /* Reset clears the buckets too. */
+    histogram.reset();
+
+    TEST_ASSERT_EQUAL_UINT32(0U, histogram.getCount());
+
+    for(idx = 0U; idx < TestHistogram::BUCKET_CNT; ++idx)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0U, histogram.getBucketCount(idx));
+    }
+
+    histogram.update(70U);
+    TEST_ASSERT_EQUAL_UINT32(1U, histogram.getBucketCount(1U));
+    TEST_ASSERT_EQUAL_UINT32(70U, histogram.getMin());
+    TEST_ASSERT_EQUAL_UINT32(70U, histogram.getMax());
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
\ No newline at end of file
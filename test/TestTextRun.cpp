@@ -0,0 +1,446 @@
+/* MIT License
+ *
+ * Copyright (c) 2019 - 2022 Andreas Merkle <web@blue-andi.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*******************************************************************************
+    DESCRIPTION
+*******************************************************************************/
+/**
+ * @brief  Pre-rasterized text run tests
+ * @author Andreas Merkle <web@blue-andi.de>
+ */
+
+/******************************************************************************
+ * Includes
+ *****************************************************************************/
+#include "TestTextRun.h"
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <Arduino.h>
+#include <YAGfx.h>
+#include <YAGfxBitmap.h>
+#include <YAGfxText.h>
+#include <YATextRun.h>
+#include <TomThumb.h>
+
+/******************************************************************************
+ * Compiler Switches
+ *****************************************************************************/
+
+/******************************************************************************
+ * Macros
+ *****************************************************************************/
+
+/******************************************************************************
+ * Types and classes
+ *****************************************************************************/
+/**
+ * Font, which is created by scaling up another font. It is used as larger
+ * font for the benchmark.
+ */
+class ScaledFont
+{
+public:
+
+    /**
+     * Constructs the scaled font.
+     *
+     * @param[in] font  Font, which to scale.
+     * @param[in] scale Scale factor
+     */
+    ScaledFont(const GFXfont& font, uint8_t scale) :
+        m_bitmap(nullptr),
+        m_glyphs(nullptr),
+        m_font()
+    {
+        const uint16_t  GLYPHS      = font.last - font.first + 1U;
+        size_t          bitmapSize  = 0U;
+        uint16_t        glyphIdx    = 0U;
+        size_t          bitIdx      = 0U;
+
+        for(glyphIdx = 0U; glyphIdx < GLYPHS; ++glyphIdx)
+        {
+            const GFXglyph& glyph = font.glyph[glyphIdx];
+
+            bitmapSize += (glyph.width * scale * glyph.height * scale + 7U) / 8U;
+        }
+
+        m_bitmap = new uint8_t[bitmapSize];
+        m_glyphs = new GFXglyph[GLYPHS];
+        memset(m_bitmap, 0, bitmapSize);
+
+        for(glyphIdx = 0U; glyphIdx < GLYPHS; ++glyphIdx)
+        {
+            const GFXglyph& glyph   = font.glyph[glyphIdx];
+            GFXglyph&       scaled  = m_glyphs[glyphIdx];
+            uint16_t        x       = 0U;
+            uint16_t        y       = 0U;
+
+            scaled.bitmapOffset = bitIdx / 8U;
+            scaled.width        = glyph.width * scale;
+            scaled.height       = glyph.height * scale;
+            scaled.xAdvance     = glyph.xAdvance * scale;
+            scaled.xOffset      = glyph.xOffset * scale;
+            scaled.yOffset      = glyph.yOffset * scale;
+
+            for(y = 0U; y < scaled.height; ++y)
+            {
+                for(x = 0U; x < scaled.width; ++x)
+                {
+                    size_t srcBit = glyph.bitmapOffset * 8U + (y / scale) * glyph.width + (x / scale);
+
+                    if (0U != (font.bitmap[srcBit / 8U] & (0x80U >> (srcBit % 8U))))
+                    {
+                        m_bitmap[bitIdx / 8U] |= (0x80U >> (bitIdx % 8U));
+                    }
+
+                    ++bitIdx;
+                }
+            }
+
+            /* Every glyph starts at a byte boundary. */
+            bitIdx = ((bitIdx + 7U) / 8U) * 8U;
+        }
+
+        m_font.bitmap   = m_bitmap;
+        m_font.glyph    = m_glyphs;
+        m_font.first    = font.first;
+        m_font.last     = font.last;
+        m_font.yAdvance = font.yAdvance * scale;
+    }
+
+    /**
+     * Destroys the scaled font.
+     */
+    ~ScaledFont()
+    {
+        delete[] m_bitmap;
+        delete[] m_glyphs;
+    }
+
+    /**
+     * Get the scaled GFXfont.
+     *
+     * @return GFXfont
+     */
+    const GFXfont* getGfxFont() const
+    {
+        return &m_font;
+    }
+
+private:
+
+    uint8_t*    m_bitmap;   /**< Scaled glyph bitmaps */
+    GFXglyph*   m_glyphs;   /**< Scaled glyphs */
+    GFXfont     m_font;     /**< Scaled font */
+
+    ScaledFont(const ScaledFont& font);
+    ScaledFont& operator=(const ScaledFont& font);
+};
+
+/******************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void testBasics();
+static void testEquality(const GFXfont* gfxFont);
+static void drawText(YAGfx& gfx, YAGfxText& gfxText, int16_t x, int16_t y, const char* text);
+static void rasterize(YATextRun& textRun, YAGfxText& gfxText, const char* text);
+static void benchmark(const char* fontName, const GFXfont* gfxFont, uint16_t width, uint16_t height);
+
+/******************************************************************************
+ * Local Variables
+ *****************************************************************************/
+/** Text, which contains characters with ascender, descender and spaces. */
+static const char*      TEXT            = "Scrolling jumps quickly over the lazy dog, 1234567890!";
+
+/** Colors, which change after every character. */
+static const uint32_t   TEXT_COLORS[]   =
+{
+    0xFF0000U,
+    0x00FF00U,
+    0x0000FFU
+};
+
+/******************************************************************************
+ * Public Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Protected Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * Private Methods
+ *****************************************************************************/
+
+/******************************************************************************
+ * External Functions
+ *****************************************************************************/
+/**
+ * Test the pre-rasterized text run, incl. a scrolling benchmark.
+ */
+extern void testTextRun()
+{
+    ScaledFont largeFont(TomThumb, 3U);
+
+    testBasics();
+    testEquality(&TomThumb);
+    testEquality(largeFont.getGfxFont());
+
+    benchmark("TomThumb", &TomThumb, 32U, 8U);
+    benchmark("TomThumb x3", largeFont.getGfxFont(), 64U, 18U);
+
+    return;
+}
+
+/******************************************************************************
+ * Local Functions
+ *****************************************************************************/
+/**
+ * Test the single pixel access and clipping.
+ */
+static void testBasics()
+{
+    YATextRun               textRun;
+    YAGfxStaticBitmap<8U, 4U> canvas;
+    const Color             RED     = 0xFF0000U;
+    const Color             BLUE    = 0x0000FFU;
+
+    /* Not created yet */
+    TEST_ASSERT_FALSE(textRun.isAllocated());
+    TEST_ASSERT_EQUAL_UINT16(0U, textRun.getWidth());
+    TEST_ASSERT_FALSE(textRun.create(0U, 4U));
+
+    TEST_ASSERT_TRUE(textRun.create(10U, 2U));
+    TEST_ASSERT_TRUE(textRun.isAllocated());
+    TEST_ASSERT_FALSE(textRun.create(10U, 2U));
+    TEST_ASSERT_EQUAL_UINT16(10U, textRun.getWidth());
+    TEST_ASSERT_EQUAL_UINT16(2U, textRun.getHeight());
+
+    /* Pixels outside are ignored. */
+    textRun.drawPixel(-1, 0, RED);
+    textRun.drawPixel(10, 0, RED);
+    textRun.drawPixel(0, 2, RED);
+
+    /* Spans with different colors and across a byte boundary. */
+    textRun.drawPixel(0, 0, RED);
+    textRun.drawPixel(1, 0, RED);
+    textRun.drawPixel(2, 0, BLUE);
+    textRun.drawPixel(7, 1, BLUE);
+    textRun.drawPixel(8, 1, BLUE);
+    TEST_ASSERT_EQUAL_UINT32(BLUE, textRun.getColor(2, 1));
+
+    canvas.fillScreen(ColorDef::BLACK);
+    textRun.draw(canvas, 0, 1);
+    TEST_ASSERT_EQUAL_UINT32(RED, canvas.getColor(0, 1));
+    TEST_ASSERT_EQUAL_UINT32(RED, canvas.getColor(1, 1));
+    TEST_ASSERT_EQUAL_UINT32(BLUE, canvas.getColor(2, 1));
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(3, 1));
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(6, 2));
+    TEST_ASSERT_EQUAL_UINT32(BLUE, canvas.getColor(7, 2));
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(0, 0));
+
+    /* Clipped on every side */
+    canvas.fillScreen(ColorDef::BLACK);
+    textRun.draw(canvas, -1, 3);
+    TEST_ASSERT_EQUAL_UINT32(RED, canvas.getColor(0, 3));
+    TEST_ASSERT_EQUAL_UINT32(BLUE, canvas.getColor(1, 3));
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(6, 3));
+
+    canvas.fillScreen(ColorDef::BLACK);
+    textRun.draw(canvas, -8, -1);
+    TEST_ASSERT_EQUAL_UINT32(BLUE, canvas.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(1, 0));
+
+    /* Clear keeps the size. */
+    textRun.clear();
+    canvas.fillScreen(ColorDef::BLACK);
+    textRun.draw(canvas, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(ColorDef::BLACK, canvas.getColor(0, 0));
+    TEST_ASSERT_EQUAL_UINT16(10U, textRun.getWidth());
+
+    textRun.release();
+    TEST_ASSERT_FALSE(textRun.isAllocated());
+    TEST_ASSERT_EQUAL_UINT16(0U, textRun.getHeight());
+
+    return;
+}
+
+/**
+ * A drawn text run shall look like the directly drawn text at every
+ * scroll position.
+ *
+ * @param[in] gfxFont   Font
+ */
+static void testEquality(const GFXfont* gfxFont)
+{
+    YAGfxText           gfxText(gfxFont, ColorDef::WHITE);
+    YATextRun           textRun;
+    const uint16_t      HEIGHT      = gfxText.getFont().getHeight();
+    const uint16_t      WIDTH       = 4U * HEIGHT;
+    YAGfxDynamicBitmap  expected(WIDTH, HEIGHT);
+    YAGfxDynamicBitmap  actual(WIDTH, HEIGHT);
+    int16_t             offset      = 0;
+
+    rasterize(textRun, gfxText, TEXT);
+    TEST_ASSERT_TRUE(textRun.isAllocated());
+
+    for(offset = WIDTH; offset > -static_cast<int16_t>(textRun.getWidth()); --offset)
+    {
+        int16_t y = 0;
+
+        expected.fillScreen(ColorDef::BLACK);
+        actual.fillScreen(ColorDef::BLACK);
+
+        drawText(expected, gfxText, offset, HEIGHT - 1, TEXT);
+        textRun.draw(actual, offset, 0);
+
+        for(y = 0; y < HEIGHT; ++y)
+        {
+            int16_t x = 0;
+
+            for(x = 0; x < WIDTH; ++x)
+            {
+                TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(expected.getColor(x, y)), static_cast<uint32_t>(actual.getColor(x, y)));
+            }
+        }
+    }
+
+    return;
+}
+
+/**
+ * Draw text directly with a color change after every character.
+ *
+ * @param[in] gfx       Graphics interface
+ * @param[in] gfxText   Text graphics
+ * @param[in] x         Cursor x-coordinate
+ * @param[in] y         Cursor y-coordinate, which is the baseline.
+ * @param[in] text      Text
+ */
+static void drawText(YAGfx& gfx, YAGfxText& gfxText, int16_t x, int16_t y, const char* text)
+{
+    size_t idx = 0U;
+
+    gfxText.setTextCursorPos(x, y);
+
+    while('\0' != text[idx])
+    {
+        gfxText.setTextColor(TEXT_COLORS[idx % (sizeof(TEXT_COLORS) / sizeof(TEXT_COLORS[0]))]);
+        gfxText.drawChar(gfx, text[idx]);
+        ++idx;
+    }
+
+    return;
+}
+
+/**
+ * Rasterize the text into the text run.
+ *
+ * @param[out] textRun  Text run
+ * @param[in] gfxText   Text graphics
+ * @param[in] text      Text
+ */
+static void rasterize(YATextRun& textRun, YAGfxText& gfxText, const char* text)
+{
+    uint16_t    textWidth   = 0U;
+    uint16_t    textHeight  = 0U;
+
+    textRun.release();
+
+    if ((true == gfxText.getTextBoundingBox(0U, 0U, text, textWidth, textHeight)) &&
+        (true == textRun.create(textWidth, textHeight)))
+    {
+        drawText(textRun, gfxText, 0, gfxText.getFont().getHeight() - 1, text);
+    }
+
+    return;
+}
+
+/**
+ * Scroll a long text over the canvas, once drawn character by character and
+ * once with the text run.
+ *
+ * @param[in] fontName  Font name, only for the output.
+ * @param[in] gfxFont   Font
+ * @param[in] width     Canvas width in pixels
+ * @param[in] height    Canvas height in pixels
+ */
+static void benchmark(const char* fontName, const GFXfont* gfxFont, uint16_t width, uint16_t height)
+{
+    const uint8_t       REPETITIONS = 4U;
+    const uint32_t      ROUNDS      = 10U;
+    YAGfxText           gfxText(gfxFont, ColorDef::WHITE);
+    YATextRun           textRun;
+    YAGfxDynamicBitmap  canvas(width, height);
+    String              text;
+    uint8_t             idx         = 0U;
+    uint32_t            round       = 0U;
+    uint32_t            start       = 0U;
+    uint32_t            durationDirect  = 0U;
+    uint32_t            durationRun     = 0U;
+    uint32_t            frames      = 0U;
+    const int16_t       BASELINE    = gfxText.getFont().getHeight() - 1;
+
+    for(idx = 0U; idx < REPETITIONS; ++idx)
+    {
+        text += TEXT;
+        text += " ";
+    }
+
+    /* The rasterization is part of the measurement, like it happens once per text. */
+    start = millis();
+    rasterize(textRun, gfxText, text.c_str());
+    TEST_ASSERT_TRUE(textRun.isAllocated());
+
+    for(round = 0U; round < ROUNDS; ++round)
+    {
+        int16_t offset = 0;
+
+        for(offset = width; offset > -static_cast<int16_t>(textRun.getWidth()); --offset)
+        {
+            canvas.fillScreen(ColorDef::BLACK);
+            textRun.draw(canvas, offset, 0);
+            ++frames;
+        }
+    }
+    durationRun = millis() - start;
+
+    start = millis();
+    for(round = 0U; round < ROUNDS; ++round)
+    {
+        int16_t offset = 0;
+
+        for(offset = width; offset > -static_cast<int16_t>(textRun.getWidth()); --offset)
+        {
+            canvas.fillScreen(ColorDef::BLACK);
+            drawText(canvas, gfxText, offset, BASELINE, text.c_str());
+        }
+    }
+    durationDirect = millis() - start;
+
+    printf("%s, %u chars, %u frames: direct %u ms, text run %u ms\n", fontName, text.length(), frames, durationDirect, durationRun);
+
+    return;
+}
\ No newline at end of file